@@ -36,6 +36,7 @@
 
 #include "dsp/support_functions.h"
 #include "dsp/fast_math_functions.h"
+#include "dsp/transform_functions.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -440,6 +441,54 @@ extern "C"
         float32_t * pDst);
 
 
+/**
+ * @brief Size in float32_t of the scratch buffer of the FFT based convolution and correlation functions.
+ * @param[in]  fftLen  length of the RFFT instance.
+ */
+#define RISCV_CONV_FFT_SCRATCH_SIZE_F32(fftLen) (3U*(uint32_t)(fftLen))
+
+
+/**
+ * @brief FFT based convolution of floating-point sequences.
+ * @param[in]  S         points to an instance of the floating-point RFFT structure.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  pScratch  points to scratch buffer of size RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT).
+ * @return  Returns RISCV_MATH_ARGUMENT_ERROR if the shorter sequence is longer than half the FFT length, RISCV_MATH_SUCCESS otherwise.
+ */
+  riscv_status riscv_conv_fft_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
+/**
+ * @brief Convolution of floating-point sequences, direct or FFT based depending on the lengths.
+ * @param[in]  S         points to an instance of the floating-point RFFT structure, or NULL.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  pScratch  points to scratch buffer of size RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT), or NULL.
+ */
+  void riscv_conv_auto_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
   /**
    * @brief Convolution of Q15 sequences.
    * @param[in]  pSrcA      points to the first input sequence.
@@ -601,6 +650,31 @@ extern "C"
         uint32_t numPoints);
 
 
+  /**
+   * @brief FFT based partial convolution of floating-point sequences.
+   * @param[in]  S           points to an instance of the floating-point RFFT structure.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @param[in]  pScratch    points to scratch buffer of size RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT).
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2] or the shorter sequence is longer than half the FFT length.
+   */
+  riscv_status riscv_conv_partial_fft_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        uint32_t firstIndex,
+        uint32_t numPoints,
+        float32_t * pScratch);
+
+
   /**
    * @brief Partial convolution of Q15 sequences.
    * @param[in]  pSrcA       points to the first input sequence.
@@ -944,6 +1018,231 @@ riscv_status riscv_fir_decimate_init_f32(
         q31_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 half-band FIR decimator.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;           /**< number of coefficients in the filter, of the form 4*K-1. */
+    const q15_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+          q15_t *pState;             /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_halfband_decimate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 half-band FIR decimator.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;           /**< number of coefficients in the filter, of the form 4*K-1. */
+    const q31_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+          q31_t *pState;             /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_halfband_decimate_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point half-band FIR decimator.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;           /**< number of coefficients in the filter, of the form 4*K-1. */
+    const float32_t *pCoeffs;        /**< points to the coefficient array. The array is of length numTaps. */
+          float32_t *pState;         /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_halfband_decimate_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 half-band FIR decimator.
+   * @param[in]  S          points to an instance of the Q15 half-band FIR decimator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call, an even number.
+   */
+  void riscv_fir_halfband_decimate_q15(
+  const riscv_fir_halfband_decimate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 half-band FIR decimator.
+   * @param[in,out] S          points to an instance of the Q15 half-band FIR decimator structure.
+   * @param[in]     numTaps    number of coefficients in the filter, of the form 4*K-1.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not of the form 4*K-1 or
+   * RISCV_MATH_LENGTH_ERROR if <code>blockSize</code> is not even.
+   */
+  riscv_status riscv_fir_halfband_decimate_init_q15(
+        riscv_fir_halfband_decimate_instance_q15 * S,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 half-band FIR decimator.
+   * @param[in]  S          points to an instance of the Q31 half-band FIR decimator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call, an even number.
+   */
+  void riscv_fir_halfband_decimate_q31(
+  const riscv_fir_halfband_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 half-band FIR decimator.
+   * @param[in,out] S          points to an instance of the Q31 half-band FIR decimator structure.
+   * @param[in]     numTaps    number of coefficients in the filter, of the form 4*K-1.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not of the form 4*K-1 or
+   * RISCV_MATH_LENGTH_ERROR if <code>blockSize</code> is not even.
+   */
+  riscv_status riscv_fir_halfband_decimate_init_q31(
+        riscv_fir_halfband_decimate_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point half-band FIR decimator.
+   * @param[in]  S          points to an instance of the floating-point half-band FIR decimator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call, an even number.
+   */
+  void riscv_fir_halfband_decimate_f32(
+  const riscv_fir_halfband_decimate_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point half-band FIR decimator.
+   * @param[in,out] S          points to an instance of the floating-point half-band FIR decimator structure.
+   * @param[in]     numTaps    number of coefficients in the filter, of the form 4*K-1.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not of the form 4*K-1 or
+   * RISCV_MATH_LENGTH_ERROR if <code>blockSize</code> is not even.
+   */
+  riscv_status riscv_fir_halfband_decimate_init_f32(
+        riscv_fir_halfband_decimate_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 CIC decimator.
+   */
+  typedef struct
+  {
+          uint8_t numStages;          /**< number of integrator and comb stages. */
+          uint8_t postShift;          /**< right shift of the comb output, ceil(numStages*log2(M)). */
+          uint16_t M;                 /**< decimation factor. */
+          q63_t *pState;              /**< points to the state variable array. The array is of length 2*numStages. */
+  } riscv_cic_decimate_instance_q15;
+
+  /**
+   * @brief Instance structure for the CIC decimator of bit-packed PDM streams.
+   */
+  typedef struct
+  {
+          uint8_t numStages;          /**< number of integrator and comb stages. */
+          int8_t postShift;           /**< right shift of the comb output, a negative value is a left shift. */
+          uint16_t M;                 /**< decimation factor, a multiple of 8. */
+          q31_t *pState;              /**< points to the state variable array. The array is of length RISCV_CIC_DECIMATE_PDM_STATE_SIZE(numStages). */
+  } riscv_cic_decimate_pdm_instance_q15;
+
+/**
+ * @brief Size in q31_t of the state buffer of a PDM CIC decimator.
+ * @param[in]  numStages  number of integrator and comb stages.
+ */
+#define RISCV_CIC_DECIMATE_PDM_STATE_SIZE(numStages) \
+  (259U*(uint32_t)(numStages))
+
+
+  /**
+   * @brief Processing function for the Q15 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q15 CIC decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call, a multiple of S->M.
+   */
+  void riscv_cic_decimate_q15(
+        riscv_cic_decimate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q15 CIC decimator structure.
+   * @param[in]     numStages  number of integrator and comb stages.
+   * @param[in]     M          decimation factor.
+   * @param[in]     pState     points to the state buffer of 2*numStages values.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if the parameters are not supported or
+   * RISCV_MATH_LENGTH_ERROR if <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+  riscv_status riscv_cic_decimate_init_q15(
+        riscv_cic_decimate_instance_q15 * S,
+        uint8_t numStages,
+        uint16_t M,
+        q63_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the CIC decimator of bit-packed PDM streams.
+   * @param[in,out] S          points to an instance of the PDM CIC decimator structure.
+   * @param[in]     pSrc       points to the packed input bits, first sample in the most significant bit.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input bits to process per call, a multiple of S->M.
+   */
+  void riscv_cic_decimate_pdm_q15(
+        riscv_cic_decimate_pdm_instance_q15 * S,
+  const uint8_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the CIC decimator of bit-packed PDM streams.
+   * @param[in,out] S          points to an instance of the PDM CIC decimator structure.
+   * @param[in]     numStages  number of integrator and comb stages.
+   * @param[in]     M          decimation factor, a multiple of 8.
+   * @param[in]     pState     points to the state buffer of RISCV_CIC_DECIMATE_PDM_STATE_SIZE(numStages) values.
+   * @param[in]     blockSize  number of input bits to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if the parameters are not supported or
+   * RISCV_MATH_LENGTH_ERROR if <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+  riscv_status riscv_cic_decimate_pdm_init_q15(
+        riscv_cic_decimate_pdm_instance_q15 * S,
+        uint8_t numStages,
+        uint16_t M,
+        q31_t * pState,
+        uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the Q15 FIR interpolator.
@@ -1080,6 +1379,167 @@ riscv_status riscv_fir_decimate_init_f32(
         float32_t * pState,
         uint32_t blockSize);
 
+/**
+ * @brief Largest number of output samples of a FIR rational resampler call.
+ * @param[in]  L          upsample factor.
+ * @param[in]  M          downsample factor.
+ * @param[in]  blockSize  number of input samples.
+ */
+#define RISCV_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize) \
+  (((uint32_t)(blockSize)*(uint32_t)(L)+(uint32_t)(M)-1U)/(uint32_t)(M))
+
+  /**
+   * @brief Instance structure for the Q15 FIR rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                    /**< upsample factor. */
+        uint16_t M;                    /**< downsample factor. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component. */
+        uint32_t phase;                /**< position of the next output in the upsampled sequence, relative to the next input block. */
+  const q15_t *pCoeffs;                  /**< points to the coefficient array. The array is of length L*phaseLength. */
+        q15_t *pState;                   /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } riscv_fir_resample_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at most <code>RISCV_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize)</code> values.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t riscv_fir_resample_q15(
+        riscv_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter. Must be a multiple of L.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  maximum number of input samples to process per call.
+   * @return        execution status
+   *                  - \ref RISCV_MATH_SUCCESS        : Operation successful
+   *                  - \ref RISCV_MATH_ARGUMENT_ERROR : L or M is zero
+   *                  - \ref RISCV_MATH_LENGTH_ERROR   : numTaps is not a multiple of L
+   */
+  riscv_status riscv_fir_resample_init_q15(
+        riscv_fir_resample_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 FIR rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                    /**< upsample factor. */
+        uint16_t M;                    /**< downsample factor. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component. */
+        uint32_t phase;                /**< position of the next output in the upsampled sequence, relative to the next input block. */
+  const q31_t *pCoeffs;                  /**< points to the coefficient array. The array is of length L*phaseLength. */
+        q31_t *pState;                   /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } riscv_fir_resample_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at most <code>RISCV_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize)</code> values.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t riscv_fir_resample_q31(
+        riscv_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter. Must be a multiple of L.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  maximum number of input samples to process per call.
+   * @return        execution status
+   *                  - \ref RISCV_MATH_SUCCESS        : Operation successful
+   *                  - \ref RISCV_MATH_ARGUMENT_ERROR : L or M is zero
+   *                  - \ref RISCV_MATH_LENGTH_ERROR   : numTaps is not a multiple of L
+   */
+  riscv_status riscv_fir_resample_init_q31(
+        riscv_fir_resample_instance_q31 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the floating-point FIR rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                    /**< upsample factor. */
+        uint16_t M;                    /**< downsample factor. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component. */
+        uint32_t phase;                /**< position of the next output in the upsampled sequence, relative to the next input block. */
+  const float32_t *pCoeffs;              /**< points to the coefficient array. The array is of length L*phaseLength. */
+        float32_t *pState;               /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } riscv_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at most <code>RISCV_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize)</code> values.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t riscv_fir_resample_f32(
+        riscv_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter. Must be a multiple of L.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  maximum number of input samples to process per call.
+   * @return        execution status
+   *                  - \ref RISCV_MATH_SUCCESS        : Operation successful
+   *                  - \ref RISCV_MATH_ARGUMENT_ERROR : L or M is zero
+   *                  - \ref RISCV_MATH_LENGTH_ERROR   : numTaps is not a multiple of L
+   */
+  riscv_status riscv_fir_resample_init_f32(
+        riscv_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
@@ -1181,59 +1641,573 @@ riscv_status riscv_fir_decimate_init_f32(
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  S          points to an instance of the filter data structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void riscv_biquad_cascade_df2T_f64(
+  const riscv_biquad_cascade_df2T_instance_f64 * S,
+  const float64_t * pSrc,
+        float64_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void riscv_biquad_cascade_df2T_init_f32(
+        riscv_biquad_cascade_df2T_instance_f32 * S,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void riscv_biquad_cascade_stereo_df2T_init_f32(
+        riscv_biquad_cascade_stereo_df2T_instance_f32 * S,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void riscv_biquad_cascade_df2T_init_f64(
+        riscv_biquad_cascade_df2T_instance_f64 * S,
+        uint8_t numStages,
+        const float64_t * pCoeffs,
+        float64_t * pState);
+
+
+  /**
+   * @brief Sample layout of the multi-channel filters.
+   */
+  typedef enum
+  {
+    RISCV_MULTICHANNEL_INTERLEAVED = 0,
+             /**< Sample n of channel c is at index <code>n*numChans + c</code> */
+    RISCV_MULTICHANNEL_PLANAR = 1
+             /**< Sample n of channel c is at index <code>c*blockSize + n</code> */
+  } riscv_multichannel_layout;
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter. N channels
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChans;         /**< number of channels filtered with the same coefficients. */
+          riscv_multichannel_layout layout;/**< layout of the input and output blocks. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChans. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } riscv_biquad_cascade_multi_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Biquad cascade filter. N channels
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChans;         /**< number of channels filtered with the same coefficients. */
+          riscv_multichannel_layout layout;/**< layout of the input and output blocks. */
+          q31_t *pState;             /**< points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    const q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+          uint8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+  } riscv_biquad_cascade_multi_df1_instance_q31;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, <code>numChans*blockSize</code> values.
+   * @param[out] pDst       points to the block of output data, <code>numChans*blockSize</code> values.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void riscv_biquad_cascade_multi_df2T_f32(
+  const riscv_biquad_cascade_multi_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. N channels
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numChans   number of channels.
+   * @param[in]     layout     layout of the input and output blocks.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void riscv_biquad_cascade_multi_df2T_init_f32(
+        riscv_biquad_cascade_multi_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 Biquad cascade filter. N channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, <code>numChans*blockSize</code> values.
+   * @param[out] pDst       points to the block of output data, <code>numChans*blockSize</code> values.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void riscv_biquad_cascade_multi_df1_q31(
+  const riscv_biquad_cascade_multi_df1_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 Biquad cascade filter. N channels
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numChans   number of channels.
+   * @param[in]     layout     layout of the input and output blocks.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+   */
+  void riscv_biquad_cascade_multi_df1_init_q31(
+        riscv_biquad_cascade_multi_df1_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        int8_t postShift);
+
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter. N channels
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChans;         /**< number of channels filtered with the same coefficients. */
+          riscv_multichannel_layout layout;/**< layout of the input and output blocks. */
+          q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    const q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+          uint8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+  } riscv_biquad_cas_multi_df1_32x64_ins_q31;
+
+
+  /**
+   * @brief Processing function for the high precision Q31 Biquad cascade filter. N channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, <code>numChans*blockSize</code> values.
+   * @param[out] pDst       points to the block of output data, <code>numChans*blockSize</code> values.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void riscv_biquad_cas_multi_df1_32x64_q31(
+  const riscv_biquad_cas_multi_df1_32x64_ins_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the high precision Q31 Biquad cascade filter. N channels
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numChans   number of channels.
+   * @param[in]     layout     layout of the input and output blocks.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+   */
+  void riscv_biquad_cas_multi_df1_32x64_init_q31(
+        riscv_biquad_cas_multi_df1_32x64_ins_q31 * S,
+        uint8_t numStages,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const q31_t * pCoeffs,
+        q63_t * pState,
+        uint8_t postShift);
+
+
+  /**
+   * @brief Instance structure for the floating-point block state-space Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t blockLen;         /**< number of outputs computed per matrix product. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    const float32_t *pBlockCoeffs;   /**< points to the block matrices.  The array is of length RISCV_BIQUAD_BLOCK_COEFFS_SIZE_F32(numStages, blockLen). */
+  } riscv_biquad_cascade_df2T_block_instance_f32;
+
+/**
+ * @brief Largest blockLen of a block state-space Biquad cascade filter.
+ */
+#define RISCV_BIQUAD_BLOCK_MAX_LEN 64U
+
+/**
+ * @brief Size in float32_t of the block matrices of a block state-space Biquad cascade filter.
+ * @param[in]  numStages  number of 2nd order stages in the filter.
+ * @param[in]  blockLen   number of outputs computed per matrix product.
+ */
+#define RISCV_BIQUAD_BLOCK_COEFFS_SIZE_F32(numStages, blockLen) \
+  ((uint32_t)(numStages)*((uint32_t)(blockLen)+2U)*((uint32_t)(blockLen)+2U))
+
+
+  /**
+   * @brief Processing function for the floating-point block state-space Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void riscv_biquad_cascade_df2T_block_f32(
+  const riscv_biquad_cascade_df2T_block_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point block state-space Biquad cascade filter.
+   * @param[in,out] S             points to an instance of the filter data structure.
+   * @param[in]     numStages     number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs       points to the filter coefficients.
+   * @param[out]    pBlockCoeffs  points to the buffer receiving the block matrices.
+   * @param[in]     pState        points to the state buffer.
+   * @param[in]     blockLen      number of outputs computed per matrix product, between 1 and RISCV_BIQUAD_BLOCK_MAX_LEN.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockLen</code> is not supported.
+   */
+  riscv_status riscv_biquad_cascade_df2T_block_init_f32(
+        riscv_biquad_cascade_df2T_block_instance_f32 * S,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pBlockCoeffs,
+        float32_t * pState,
+        uint16_t blockLen);
+
+
+  /**
+   * @brief Instance structure for the floating-point multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+          uint16_t numChans;         /**< number of channels filtered with the same coefficients. */
+          riscv_multichannel_layout layout;/**< layout of the input and output blocks. */
+          float32_t *pState;         /**< points to the state variable array, interleaved. The array is of length (numTaps+blockSize-1)*numChans. */
+    const float32_t *pCoeffs;        /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_multi_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in]  pSrc       points to the block of input data, <code>numChans*blockSize</code> values.
+   * @param[out] pDst       points to the block of output data, <code>numChans*blockSize</code> values.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void riscv_fir_multi_f32(
+  const riscv_fir_multi_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     numChans   number of channels.
+   * @param[in]     layout     layout of the input and output blocks.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of samples per channel that are processed at a time.
+   */
+  void riscv_fir_multi_init_f32(
+        riscv_fir_multi_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+          uint16_t numChans;         /**< number of channels filtered with the same coefficients. */
+          riscv_multichannel_layout layout;/**< layout of the input and output blocks. */
+          q31_t *pState;             /**< points to the state variable array, interleaved. The array is of length (numTaps+blockSize-1)*numChans. */
+    const q31_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_multi_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the Q31 multi-channel FIR structure.
+   * @param[in]  pSrc       points to the block of input data, <code>numChans*blockSize</code> values.
+   * @param[out] pDst       points to the block of output data, <code>numChans*blockSize</code> values.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void riscv_fir_multi_q31(
+  const riscv_fir_multi_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 multi-channel FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 multi-channel FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     numChans   number of channels.
+   * @param[in]     layout     layout of the input and output blocks.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of samples per channel that are processed at a time.
+   */
+  void riscv_fir_multi_init_q31(
+        riscv_fir_multi_instance_q31 * S,
+        uint16_t numTaps,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+          uint16_t numChans;         /**< number of channels filtered with the same coefficients. */
+          riscv_multichannel_layout layout;/**< layout of the input and output blocks. */
+          q15_t *pState;             /**< points to the state variable array, interleaved. The array is of length (numTaps+blockSize-1)*numChans. */
+    const q15_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_multi_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]  pSrc       points to the block of input data, <code>numChans*blockSize</code> values.
+   * @param[out] pDst       points to the block of output data, <code>numChans*blockSize</code> values.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void riscv_fir_multi_q15(
+  const riscv_fir_multi_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 multi-channel FIR filter.
+   * @param[in,out] S          points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     numChans   number of channels.
+   * @param[in]     layout     layout of the input and output blocks.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of samples per channel that are processed at a time.
+   */
+  void riscv_fir_multi_init_q15(
+        riscv_fir_multi_instance_q15 * S,
+        uint16_t numTaps,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+/**
+ * @brief Size of the state buffer of a circular state FIR filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  largest number of samples processed per call.
+ */
+#define RISCV_FIR_CIRC_STATE_SIZE(numTaps, blockSize) \
+  (2U*((uint32_t)(numTaps)+(uint32_t)(blockSize)-1U))
+
+  /**
+   * @brief Instance structure for the Q7 circular state FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;        /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;    /**< number of samples of the circular state, numTaps+blockSize-1. */
+          uint32_t stateIndex;     /**< position where the next input sample is written. */
+          q7_t *pState;            /**< points to the state variable array. The array is of length 2*stateLength. */
+    const q7_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+  } riscv_fir_circ_instance_q7;
+
+  /**
+   * @brief Processing function for the Q7 circular state FIR filter.
+   * @param[in,out] S          points to an instance of the Q7 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, at most the blockSize given at initialization.
+   */
+  void riscv_fir_circ_q7(
+        riscv_fir_circ_instance_q7 * S,
+  const q7_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 circular state FIR filter.
+   * @param[in,out] S          points to an instance of the Q7 circular state FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of RISCV_FIR_CIRC_STATE_SIZE(numTaps, blockSize) samples.
+   * @param[in]     blockSize  largest number of samples that are processed per call.
+   */
+  void riscv_fir_circ_init_q7(
+        riscv_fir_circ_instance_q7 * S,
+        uint16_t numTaps,
+  const q7_t * pCoeffs,
+        q7_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 circular state FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;        /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;    /**< number of samples of the circular state, numTaps+blockSize-1. */
+          uint32_t stateIndex;     /**< position where the next input sample is written. */
+          q15_t *pState;           /**< points to the state variable array. The array is of length 2*stateLength. */
+    const q15_t *pCoeffs;          /**< points to the coefficient array. The array is of length numTaps.*/
+  } riscv_fir_circ_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 circular state FIR filter.
+   * @param[in,out] S          points to an instance of the Q15 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, at most the blockSize given at initialization.
+   */
+  void riscv_fir_circ_q15(
+        riscv_fir_circ_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 circular state FIR filter.
+   * @param[in,out] S          points to an instance of the Q15 circular state FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of RISCV_FIR_CIRC_STATE_SIZE(numTaps, blockSize) samples.
+   * @param[in]     blockSize  largest number of samples that are processed per call.
+   */
+  void riscv_fir_circ_init_q15(
+        riscv_fir_circ_instance_q15 * S,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 circular state FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;        /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;    /**< number of samples of the circular state, numTaps+blockSize-1. */
+          uint32_t stateIndex;     /**< position where the next input sample is written. */
+          q31_t *pState;           /**< points to the state variable array. The array is of length 2*stateLength. */
+    const q31_t *pCoeffs;          /**< points to the coefficient array. The array is of length numTaps.*/
+  } riscv_fir_circ_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 circular state FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, at most the blockSize given at initialization.
    */
-  void riscv_biquad_cascade_df2T_f64(
-  const riscv_biquad_cascade_df2T_instance_f64 * S,
-  const float64_t * pSrc,
-        float64_t * pDst,
+  void riscv_fir_circ_q31(
+        riscv_fir_circ_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
         uint32_t blockSize);
 
-
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @brief  Initialization function for the Q31 circular state FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 circular state FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
    * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
+   * @param[in]     pState     points to the state buffer of RISCV_FIR_CIRC_STATE_SIZE(numTaps, blockSize) samples.
+   * @param[in]     blockSize  largest number of samples that are processed per call.
    */
-  void riscv_biquad_cascade_df2T_init_f32(
-        riscv_biquad_cascade_df2T_instance_f32 * S,
-        uint8_t numStages,
-  const float32_t * pCoeffs,
-        float32_t * pState);
-
+  void riscv_fir_circ_init_q31(
+        riscv_fir_circ_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
+   * @brief Instance structure for the floating-point circular state FIR filter.
    */
-  void riscv_biquad_cascade_stereo_df2T_init_f32(
-        riscv_biquad_cascade_stereo_df2T_instance_f32 * S,
-        uint8_t numStages,
-  const float32_t * pCoeffs,
-        float32_t * pState);
+  typedef struct
+  {
+          uint16_t numTaps;        /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;    /**< number of samples of the circular state, numTaps+blockSize-1. */
+          uint32_t stateIndex;     /**< position where the next input sample is written. */
+          float32_t *pState;       /**< points to the state variable array. The array is of length 2*stateLength. */
+    const float32_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps.*/
+  } riscv_fir_circ_instance_f32;
 
+  /**
+   * @brief Processing function for the floating-point circular state FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, at most the blockSize given at initialization.
+   */
+  void riscv_fir_circ_f32(
+        riscv_fir_circ_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @brief  Initialization function for the floating-point circular state FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point circular state FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
    * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
+   * @param[in]     pState     points to the state buffer of RISCV_FIR_CIRC_STATE_SIZE(numTaps, blockSize) samples.
+   * @param[in]     blockSize  largest number of samples that are processed per call.
    */
-  void riscv_biquad_cascade_df2T_init_f64(
-        riscv_biquad_cascade_df2T_instance_f64 * S,
-        uint8_t numStages,
-        const float64_t * pCoeffs,
-        float64_t * pState);
+  void riscv_fir_circ_init_f32(
+        riscv_fir_circ_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
 
 
   /**
@@ -1805,6 +2779,47 @@ riscv_status riscv_fir_decimate_init_f32(
         float32_t * pDst);
 
 
+  /**
+   * @brief FFT based correlation of floating-point sequences.
+   * @param[in]  S         points to an instance of the floating-point RFFT structure.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to scratch buffer of size RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT).
+   * @return  Returns RISCV_MATH_ARGUMENT_ERROR if the shorter sequence is longer than half the FFT length, RISCV_MATH_SUCCESS otherwise.
+   */
+  riscv_status riscv_correlate_fft_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
+  /**
+   * @brief Correlation of floating-point sequences, direct or FFT based depending on the lengths.
+   * @param[in]  S         points to an instance of the floating-point RFFT structure, or NULL.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to scratch buffer of size RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT), or NULL.
+   */
+  void riscv_correlate_auto_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
   /**
    * @brief Correlation of floating-point sequences.
    * @param[in]  pSrcA    points to the first input sequence.
@@ -2159,6 +3174,259 @@ void riscv_correlate_fast_q31(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point partitioned FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;                    /**< number of coefficients in the filter. */
+          uint16_t blockLen;                   /**< partition length, the number of samples processed per transform. */
+          uint16_t numParts;                   /**< number of partitions, ceil(numTaps / blockLen). */
+          uint16_t fdlIndex;                   /**< index of the most recent spectrum in the frequency-domain delay line. */
+          uint16_t fill;                       /**< number of input samples already received in the current partition. */
+          float32_t *pState;                   /**< points to the state buffer array. The array is of length RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen). */
+    const float32_t *pCoeffSpectra;            /**< points to the coefficient spectra. The array is of length RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen). */
+          riscv_rfft_fast_instance_f32 rfft;   /**< real FFT of length 2*blockLen. */
+  } riscv_fir_partitioned_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 partitioned FIR filter.
+   */
+  typedef struct
+  {
+          riscv_fir_partitioned_instance_f32 Sf32;   /**< floating-point filter processing the converted blocks. */
+  } riscv_fir_partitioned_instance_q31;
+
+/**
+ * @brief Size in float32_t of the coefficient spectra of a partitioned FIR filter.
+ * @param[in]  numTaps   number of filter coefficients.
+ * @param[in]  blockLen  partition length.
+ */
+#define RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen) \
+  (2U*(uint32_t)(blockLen)*(((uint32_t)(numTaps)+(uint32_t)(blockLen)-1U)/(uint32_t)(blockLen)))
+
+/**
+ * @brief Size in float32_t of the state buffer of a partitioned FIR filter.
+ * @param[in]  numTaps   number of filter coefficients.
+ * @param[in]  blockLen  partition length.
+ */
+#define RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen) \
+  (RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen) + 6U*(uint32_t)(blockLen))
+
+/**
+ * @brief Size in float32_t of the FFT tables of a partitioned FIR filter initialized with runtime tables.
+ * @param[in]  blockLen  partition length.
+ */
+#define RISCV_FIR_PARTITIONED_DYNAMIC_BUFFER_SIZE_F32(blockLen) \
+  RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(2U*(uint32_t)(blockLen))
+
+
+  /**
+   * @brief Processing function for the floating-point partitioned FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void riscv_fir_partitioned_f32(
+        riscv_fir_partitioned_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FIR filter.
+   * @param[in,out] S              points to an instance of the floating-point partitioned FIR structure.
+   * @param[in]     numTaps        number of filter coefficients in the filter.
+   * @param[in]     pCoeffs        points to the filter coefficients.
+   * @param[out]    pCoeffSpectra  points to the buffer receiving the coefficient spectra.
+   * @param[in]     pState         points to the state buffer.
+   * @param[in]     blockLen       partition length, a power of 2 between 16 and 2048.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockLen</code> is not supported or <code>numTaps</code> is 0.
+   */
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+  riscv_status riscv_fir_partitioned_init_f32(
+        riscv_fir_partitioned_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FIR filter with FFT tables computed at runtime.
+   * @param[in,out] S              points to an instance of the floating-point partitioned FIR structure.
+   * @param[in]     numTaps        number of filter coefficients in the filter.
+   * @param[in]     pCoeffs        points to the filter coefficients.
+   * @param[out]    pCoeffSpectra  points to the buffer receiving the coefficient spectra.
+   * @param[in]     pState         points to the state buffer.
+   * @param[in]     blockLen       partition length, a power of 2 between 16 and 2048.
+   * @param[out]    pBuffer        points to a buffer of RISCV_FIR_PARTITIONED_DYNAMIC_BUFFER_SIZE_F32(blockLen) values receiving the FFT tables.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockLen</code> is not supported or <code>numTaps</code> is 0.
+   */
+  riscv_status riscv_fir_partitioned_init_dynamic_f32(
+        riscv_fir_partitioned_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen,
+        float32_t * pBuffer);
+
+
+  /**
+   * @brief Processing function for the Q31 partitioned FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 partitioned FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void riscv_fir_partitioned_q31(
+        riscv_fir_partitioned_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 partitioned FIR filter.
+   * @param[in,out] S              points to an instance of the Q31 partitioned FIR structure.
+   * @param[in]     numTaps        number of filter coefficients in the filter.
+   * @param[in]     pCoeffs        points to the filter coefficients.
+   * @param[out]    pCoeffSpectra  points to the buffer receiving the coefficient spectra.
+   * @param[in]     pState         points to the state buffer.
+   * @param[in]     blockLen       partition length, a power of 2 between 16 and 2048.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockLen</code> is not supported or <code>numTaps</code> is 0.
+   */
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+  riscv_status riscv_fir_partitioned_init_q31(
+        riscv_fir_partitioned_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+
+  /**
+   * @brief  Initialization function for the Q31 partitioned FIR filter with FFT tables computed at runtime.
+   * @param[in,out] S              points to an instance of the Q31 partitioned FIR structure.
+   * @param[in]     numTaps        number of filter coefficients in the filter.
+   * @param[in]     pCoeffs        points to the filter coefficients.
+   * @param[out]    pCoeffSpectra  points to the buffer receiving the coefficient spectra.
+   * @param[in]     pState         points to the state buffer.
+   * @param[in]     blockLen       partition length, a power of 2 between 16 and 2048.
+   * @param[out]    pBuffer        points to a buffer of RISCV_FIR_PARTITIONED_DYNAMIC_BUFFER_SIZE_F32(blockLen) values receiving the FFT tables.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockLen</code> is not supported or <code>numTaps</code> is 0.
+   */
+  riscv_status riscv_fir_partitioned_init_dynamic_q31(
+        riscv_fir_partitioned_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen,
+        float32_t * pBuffer);
+
+
+  /**
+   * @brief Instance structure for the floating-point frequency domain block LMS filter.
+   */
+  typedef struct
+  {
+          riscv_fir_partitioned_instance_f32 Sfir;   /**< partitioned filter computing the output with the adapted coefficient spectra. */
+          float32_t *pCoeffSpectra;                  /**< points to the adapted coefficient spectra, shared with Sfir. */
+          float32_t mu;                              /**< normalized step size. */
+          float32_t lambda;                          /**< forgetting factor of the per-bin power estimate. */
+  } riscv_lms_fd_instance_f32;
+
+/**
+ * @brief Size in float32_t of the state buffer of a frequency domain block LMS filter.
+ * @param[in]  numTaps   number of filter coefficients.
+ * @param[in]  blockLen  block length.
+ */
+#define RISCV_LMS_FD_STATE_SIZE_F32(numTaps, blockLen) \
+  (RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen) + 3U*(uint32_t)(blockLen) + 1U)
+
+
+  /**
+   * @brief Processing function for floating-point frequency domain block LMS filter.
+   * @param[in,out] S          points to an instance of the floating-point frequency domain block LMS filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the block of reference data.
+   * @param[out]    pOut       points to the block of output data.
+   * @param[out]    pErr       points to the block of error data.
+   * @param[in]     blockSize  number of samples to process, a multiple of S->Sfir.blockLen.
+   */
+  void riscv_lms_fd_f32(
+        riscv_lms_fd_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for floating-point frequency domain block LMS filter.
+   * @param[in,out] S              points to an instance of the floating-point frequency domain block LMS filter structure.
+   * @param[in]     numTaps        number of filter coefficients.
+   * @param[in]     pCoeffs        points to the initial filter coefficients.
+   * @param[out]    pCoeffSpectra  points to the buffer receiving the adapted coefficient spectra.
+   * @param[in]     pState         points to the state buffer.
+   * @param[in]     blockLen       block length, a power of 2 between 16 and 2048.
+   * @param[in]     mu             normalized step size.
+   * @param[in]     lambda         forgetting factor of the per-bin power estimate.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockLen</code> is not supported or <code>numTaps</code> is 0.
+   */
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+  riscv_status riscv_lms_fd_init_f32(
+        riscv_lms_fd_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen,
+        float32_t mu,
+        float32_t lambda);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+
+  /**
+   * @brief Initialization function for floating-point frequency domain block LMS filter with FFT tables computed at runtime.
+   * @param[in,out] S              points to an instance of the floating-point frequency domain block LMS filter structure.
+   * @param[in]     numTaps        number of filter coefficients.
+   * @param[in]     pCoeffs        points to the initial filter coefficients.
+   * @param[out]    pCoeffSpectra  points to the buffer receiving the adapted coefficient spectra.
+   * @param[in]     pState         points to the state buffer.
+   * @param[in]     blockLen       block length, a power of 2 between 16 and 2048.
+   * @param[in]     mu             normalized step size.
+   * @param[in]     lambda         forgetting factor of the per-bin power estimate.
+   * @param[out]    pBuffer        points to a buffer of RISCV_FIR_PARTITIONED_DYNAMIC_BUFFER_SIZE_F32(blockLen) values receiving the FFT tables.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockLen</code> is not supported or <code>numTaps</code> is 0.
+   */
+  riscv_status riscv_lms_fd_init_dynamic_f32(
+        riscv_lms_fd_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen,
+        float32_t mu,
+        float32_t lambda,
+        float32_t * pBuffer);
+
+
 
 
  
@@ -2493,6 +3761,275 @@ void riscv_levinson_durbin_q31(const q31_t *phi,
   q31_t *err,
   int nbCoefs);
 
+
+/**
+  @brief         LPC analysis of a floating-point block.
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     pWindow    points to the window of blockSize values, or NULL for a rectangular window
+  @param[in]     blockSize  number of samples in the block
+  @param[in]     order      order of the predictor
+  @param[out]    pCoeffs    points to the order prediction coefficients
+  @param[out]    pReflect   points to the order reflection coefficients {k1, k2, ..., kN}, or NULL
+  @param[out]    pErr       points to the prediction error energy
+  @param[in,out] pScratch   points to a buffer of <code>blockSize + order + 1</code> values
+  @return        execution status
+ */
+riscv_status riscv_lpc_analysis_f32(
+  const float32_t * pSrc,
+  const float32_t * pWindow,
+        uint32_t blockSize,
+        uint16_t order,
+        float32_t * pCoeffs,
+        float32_t * pReflect,
+        float32_t * pErr,
+        float32_t * pScratch);
+
+
+/**
+  @brief         LPC analysis of a Q31 block.
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     pWindow    points to the window of blockSize values, or NULL for a rectangular window
+  @param[in]     blockSize  number of samples in the block
+  @param[in]     order      order of the predictor
+  @param[out]    pCoeffs    points to the order prediction coefficients
+  @param[out]    pReflect   points to the order reflection coefficients {k1, k2, ..., kN}, or NULL
+  @param[out]    pErr       points to the normalized prediction error
+  @param[in,out] pScratch   points to a buffer of <code>blockSize + order + 1</code> values
+  @return        execution status
+ */
+riscv_status riscv_lpc_analysis_q31(
+  const q31_t * pSrc,
+  const q31_t * pWindow,
+        uint32_t blockSize,
+        uint16_t order,
+        q31_t * pCoeffs,
+        q31_t * pReflect,
+        q31_t * pErr,
+        q31_t * pScratch);
+
+
+  /**
+   * @brief Processing function of a stage of a floating-point filter chain.
+   *
+   * The library processing functions, such as riscv_biquad_cascade_df1_f32 or riscv_fir_decimate_f32,
+   * take a pointer to their own instance type and must be called from a wrapper of
+   * this type: calling them through a cast to this type is undefined behavior.
+   */
+  typedef void (*riscv_filter_chain_process_f32)(
+  const void * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Stage of a floating-point filter chain.
+   */
+  typedef struct
+  {
+          riscv_filter_chain_process_f32 pProcess; /**< processing function of the stage. */
+    const void *pInstance;                      /**< points to the filter instance given to the processing function. */
+          uint16_t L;                           /**< upsample factor: the stage outputs blockSize*L/M samples. */
+          uint16_t M;                           /**< decimation factor: the stage outputs blockSize*L/M samples. */
+          uint64_t cycles;                      /**< cycles spent in the stage since the initialization of the chain, when the chain reads a cycle counter. */
+  } riscv_filter_chain_stage_f32;
+
+  /**
+   * @brief Instance structure for the floating-point filter chain.
+   */
+  typedef struct
+  {
+          uint16_t numStages;                   /**< number of stages of the chain. */
+          uint32_t tileSize;                    /**< number of input samples run through all the stages at once. */
+          uint32_t pingSize;                    /**< length of the first intermediate buffer, the second one follows it. */
+          riscv_filter_chain_stage_f32 *pStages; /**< points to the array of numStages stages. */
+          float32_t *pScratch;                  /**< points to the two intermediate buffers. */
+          uint64_t (*pReadCycle)(void);         /**< returns the cycle counter read around each stage, NULL disables the accounting. */
+  } riscv_filter_chain_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point filter chain.
+   * @param[in,out] S          points to an instance of the floating-point filter chain structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   */
+  void riscv_filter_chain_f32(
+        riscv_filter_chain_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point filter chain.
+   * @param[in,out] S            points to an instance of the floating-point filter chain structure.
+   * @param[in]     pStages      points to the array of stages.
+   * @param[in]     numStages    number of stages.
+   * @param[in]     tileSize     number of input samples run through all the stages at once.
+   * @param[in]     pScratch     points to the buffer receiving the intermediate blocks.
+   * @param[in]     scratchSize  length of the scratch buffer.
+   * @param[in]     pReadCycle   returns the cycle counter read around each stage, NULL disables the accounting.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if a stage has no processing function or a zero factor, or
+   * RISCV_MATH_LENGTH_ERROR if a stage would process a fractional number of samples or
+   * if the scratch buffer is too small.
+   */
+  riscv_status riscv_filter_chain_init_f32(
+        riscv_filter_chain_instance_f32 * S,
+        riscv_filter_chain_stage_f32 * pStages,
+        uint16_t numStages,
+        uint32_t tileSize,
+        float32_t * pScratch,
+        uint32_t scratchSize,
+        uint64_t (*pReadCycle)(void));
+
+  /**
+   * @brief Processing function of a stage of a Q31 filter chain.
+   *
+   * The library processing functions, such as riscv_biquad_cascade_df1_q31 or riscv_fir_decimate_q31,
+   * take a pointer to their own instance type and must be called from a wrapper of
+   * this type: calling them through a cast to this type is undefined behavior.
+   */
+  typedef void (*riscv_filter_chain_process_q31)(
+  const void * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Stage of a Q31 filter chain.
+   */
+  typedef struct
+  {
+          riscv_filter_chain_process_q31 pProcess; /**< processing function of the stage. */
+    const void *pInstance;                      /**< points to the filter instance given to the processing function. */
+          uint16_t L;                           /**< upsample factor: the stage outputs blockSize*L/M samples. */
+          uint16_t M;                           /**< decimation factor: the stage outputs blockSize*L/M samples. */
+          uint64_t cycles;                      /**< cycles spent in the stage since the initialization of the chain, when the chain reads a cycle counter. */
+  } riscv_filter_chain_stage_q31;
+
+  /**
+   * @brief Instance structure for the Q31 filter chain.
+   */
+  typedef struct
+  {
+          uint16_t numStages;                   /**< number of stages of the chain. */
+          uint32_t tileSize;                    /**< number of input samples run through all the stages at once. */
+          uint32_t pingSize;                    /**< length of the first intermediate buffer, the second one follows it. */
+          riscv_filter_chain_stage_q31 *pStages; /**< points to the array of numStages stages. */
+          q31_t *pScratch;                  /**< points to the two intermediate buffers. */
+          uint64_t (*pReadCycle)(void);         /**< returns the cycle counter read around each stage, NULL disables the accounting. */
+  } riscv_filter_chain_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 filter chain.
+   * @param[in,out] S          points to an instance of the Q31 filter chain structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   */
+  void riscv_filter_chain_q31(
+        riscv_filter_chain_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 filter chain.
+   * @param[in,out] S            points to an instance of the Q31 filter chain structure.
+   * @param[in]     pStages      points to the array of stages.
+   * @param[in]     numStages    number of stages.
+   * @param[in]     tileSize     number of input samples run through all the stages at once.
+   * @param[in]     pScratch     points to the buffer receiving the intermediate blocks.
+   * @param[in]     scratchSize  length of the scratch buffer.
+   * @param[in]     pReadCycle   returns the cycle counter read around each stage, NULL disables the accounting.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if a stage has no processing function or a zero factor, or
+   * RISCV_MATH_LENGTH_ERROR if a stage would process a fractional number of samples or
+   * if the scratch buffer is too small.
+   */
+  riscv_status riscv_filter_chain_init_q31(
+        riscv_filter_chain_instance_q31 * S,
+        riscv_filter_chain_stage_q31 * pStages,
+        uint16_t numStages,
+        uint32_t tileSize,
+        q31_t * pScratch,
+        uint32_t scratchSize,
+        uint64_t (*pReadCycle)(void));
+
+  /**
+   * @brief Processing function of a stage of a Q15 filter chain.
+   *
+   * The library processing functions, such as riscv_biquad_cascade_df1_q15 or riscv_fir_decimate_q15,
+   * take a pointer to their own instance type and must be called from a wrapper of
+   * this type: calling them through a cast to this type is undefined behavior.
+   */
+  typedef void (*riscv_filter_chain_process_q15)(
+  const void * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Stage of a Q15 filter chain.
+   */
+  typedef struct
+  {
+          riscv_filter_chain_process_q15 pProcess; /**< processing function of the stage. */
+    const void *pInstance;                      /**< points to the filter instance given to the processing function. */
+          uint16_t L;                           /**< upsample factor: the stage outputs blockSize*L/M samples. */
+          uint16_t M;                           /**< decimation factor: the stage outputs blockSize*L/M samples. */
+          uint64_t cycles;                      /**< cycles spent in the stage since the initialization of the chain, when the chain reads a cycle counter. */
+  } riscv_filter_chain_stage_q15;
+
+  /**
+   * @brief Instance structure for the Q15 filter chain.
+   */
+  typedef struct
+  {
+          uint16_t numStages;                   /**< number of stages of the chain. */
+          uint32_t tileSize;                    /**< number of input samples run through all the stages at once. */
+          uint32_t pingSize;                    /**< length of the first intermediate buffer, the second one follows it. */
+          riscv_filter_chain_stage_q15 *pStages; /**< points to the array of numStages stages. */
+          q15_t *pScratch;                  /**< points to the two intermediate buffers. */
+          uint64_t (*pReadCycle)(void);         /**< returns the cycle counter read around each stage, NULL disables the accounting. */
+  } riscv_filter_chain_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 filter chain.
+   * @param[in,out] S          points to an instance of the Q15 filter chain structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   */
+  void riscv_filter_chain_q15(
+        riscv_filter_chain_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 filter chain.
+   * @param[in,out] S            points to an instance of the Q15 filter chain structure.
+   * @param[in]     pStages      points to the array of stages.
+   * @param[in]     numStages    number of stages.
+   * @param[in]     tileSize     number of input samples run through all the stages at once.
+   * @param[in]     pScratch     points to the buffer receiving the intermediate blocks.
+   * @param[in]     scratchSize  length of the scratch buffer.
+   * @param[in]     pReadCycle   returns the cycle counter read around each stage, NULL disables the accounting.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization was successful,
+   * RISCV_MATH_ARGUMENT_ERROR if a stage has no processing function or a zero factor, or
+   * RISCV_MATH_LENGTH_ERROR if a stage would process a fractional number of samples or
+   * if the scratch buffer is too small.
+   */
+  riscv_status riscv_filter_chain_init_q15(
+        riscv_filter_chain_instance_q15 * S,
+        riscv_filter_chain_stage_q15 * pStages,
+        uint16_t numStages,
+        uint32_t tileSize,
+        q15_t * pScratch,
+        uint32_t scratchSize,
+        uint64_t (*pReadCycle)(void));
+
 #ifdef   __cplusplus
 }
 #endif
@@ -34,6 +34,8 @@
 #include "dsp/none.h"
 #include "dsp/utils.h"
 
+#include "dsp/filtering_functions.h"
+
 
 #ifdef   __cplusplus
 extern "C"
@@ -184,6 +186,48 @@ extern "C"
   const float16_t * pCoeffs,
         float16_t * pState);
 
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter. N channels
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChans;         /**< number of channels filtered with the same coefficients. */
+          riscv_multichannel_layout layout;/**< layout of the input and output blocks. */
+          float16_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChans. */
+    const float16_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } riscv_biquad_cascade_multi_df2T_instance_f16;
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data, <code>numChans*blockSize</code> values.
+   * @param[out] pDst       points to the block of output data, <code>numChans*blockSize</code> values.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void riscv_biquad_cascade_multi_df2T_f16(
+  const riscv_biquad_cascade_multi_df2T_instance_f16 * S,
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. N channels
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numChans   number of channels.
+   * @param[in]     layout     layout of the input and output blocks.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void riscv_biquad_cascade_multi_df2T_init_f16(
+        riscv_biquad_cascade_multi_df2T_instance_f16 * S,
+        uint8_t numStages,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const float16_t * pCoeffs,
+        float16_t * pState);
+
   /**
    * @brief Correlation of floating-point sequences.
    * @param[in]  pSrcA    points to the first input sequence.
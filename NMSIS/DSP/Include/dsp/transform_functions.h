@@ -241,6 +241,12 @@ void riscv_cfft_q15(
           uint8_t ifftFlag,
           uint8_t bitReverseFlag);
 
+int32_t riscv_cfft_bfp_q15(
+    const riscv_cfft_instance_q15 * S,
+          q15_t * p1,
+          uint8_t ifftFlag,
+          uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
@@ -284,6 +290,7 @@ void riscv_cfft_q31(
   } riscv_cfft_instance_f32;
 
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
 riscv_status riscv_cfft_init_4096_f32(riscv_cfft_instance_f32 * S);
 riscv_status riscv_cfft_init_2048_f32(riscv_cfft_instance_f32 * S);
 riscv_status riscv_cfft_init_1024_f32(riscv_cfft_instance_f32 * S);
@@ -297,6 +304,17 @@ riscv_status riscv_cfft_init_16_f32(riscv_cfft_instance_f32 * S);
   riscv_status riscv_cfft_init_f32(
   riscv_cfft_instance_f32 * S,
   uint16_t fftLen);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+ * @brief Size, in float32_t, of the buffer used by riscv_cfft_init_dynamic_f32.
+ */
+#define RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(fftLen) (3U * (uint32_t)(fftLen))
+
+  riscv_status riscv_cfft_init_dynamic_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer);
 
   void riscv_cfft_f32(
   const riscv_cfft_instance_f32 * S,
@@ -406,6 +424,11 @@ riscv_status riscv_rfft_init_8192_q15(
         q15_t * pSrc,
         q15_t * pDst);
 
+int32_t riscv_rfft_bfp_q15(
+  const riscv_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst);
+
   /**
    * @brief Instance structure for the Q31 RFFT/RIFFT function.
    */
@@ -543,6 +566,7 @@ typedef struct
     const float32_t * pTwiddleRFFT;        /**< Twiddle factors real stage  */
   } riscv_rfft_fast_instance_f32 ;
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
 riscv_status riscv_rfft_fast_init_32_f32( riscv_rfft_fast_instance_f32 * S );
 riscv_status riscv_rfft_fast_init_64_f32( riscv_rfft_fast_instance_f32 * S );
 riscv_status riscv_rfft_fast_init_128_f32( riscv_rfft_fast_instance_f32 * S );
@@ -555,6 +579,18 @@ riscv_status riscv_rfft_fast_init_4096_f32( riscv_rfft_fast_instance_f32 * S );
 riscv_status riscv_rfft_fast_init_f32 (
          riscv_rfft_fast_instance_f32 * S,
          uint16_t fftLen);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+ * @brief Size, in float32_t, of the buffer used by riscv_rfft_fast_init_dynamic_f32.
+ */
+#define RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(fftLen) \
+  (RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32((uint32_t)(fftLen) >> 1U) + (uint32_t)(fftLen))
+
+riscv_status riscv_rfft_fast_init_dynamic_f32 (
+         riscv_rfft_fast_instance_f32 * S,
+         uint16_t fftLen,
+         float32_t * pBuffer);
 
 
   void riscv_rfft_fast_f32(
@@ -562,6 +598,89 @@ riscv_status riscv_rfft_fast_init_f32 (
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+/**
+ * @brief Maximum number of radix stages of a mixed-radix CFFT plan.
+ */
+#define RISCV_CFFT_MIXED_MAX_STAGES 16
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                                   /**< length of the FFT. */
+          uint16_t numStages;                                /**< number of radix stages. */
+          uint8_t  pRadix[RISCV_CFFT_MIXED_MAX_STAGES];      /**< radix (2, 3, 4 or 5) of each stage, in execution order. */
+    const float32_t *pTwiddle;                               /**< points to the twiddle factor table (2*fftLen values). */
+    const uint16_t *pDigitRevTable;                          /**< points to the digit reversal table (fftLen values). */
+  } riscv_cfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in,out] S               points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]     fftLen          length of the FFT. Must be a product of 2, 3 and 5.
+   * @param[out]    pTwiddle        points to a buffer of 2*fftLen values filled with the twiddle factors.
+   * @param[out]    pDigitRevTable  points to a buffer of fftLen values filled with the digit reversal table.
+   * @return        execution status
+   */
+  riscv_status riscv_cfft_mixed_init_f32(
+        riscv_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        uint16_t * pDigitRevTable);
+
+  /**
+   * @brief  Processing function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in]  S         points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]  pSrc      points to the complex input buffer.
+   * @param[out] pDst      points to the complex output buffer. Must not overlap pSrc.
+   * @param[in]  ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void riscv_cfft_mixed_f32(
+  const riscv_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          riscv_cfft_mixed_instance_f32 Sint; /**< Internal CFFT structure. */
+          uint16_t fftLenRFFT;                /**< length of the real sequence */
+    const float32_t * pTwiddleRFFT;           /**< Twiddle factors real stage  */
+  } riscv_rfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix RFFT/RIFFT.
+   * @param[in,out] S               points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in]     fftLen          length of the real sequence. Must be even, with fftLen/2 a product of 2, 3 and 5.
+   * @param[out]    pTwiddle        points to a buffer of fftLen values filled with the twiddle factors of the internal CFFT.
+   * @param[out]    pTwiddleRFFT    points to a buffer of fftLen values filled with the twiddle factors of the real stage.
+   * @param[out]    pDigitRevTable  points to a buffer of fftLen/2 values filled with the digit reversal table of the internal CFFT.
+   * @return        execution status
+   */
+  riscv_status riscv_rfft_mixed_init_f32(
+        riscv_rfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        float32_t * pTwiddleRFFT,
+        uint16_t * pDigitRevTable);
+
+  /**
+   * @brief  Processing function for the floating-point mixed-radix RFFT/RIFFT.
+   * @param[in]  S         points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in]  p         points to the input buffer. Modified by the inverse transform.
+   * @param[out] pOut      points to the output buffer.
+   * @param[in]  ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void riscv_rfft_mixed_f32(
+  const riscv_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -699,6 +818,67 @@ riscv_status riscv_rfft_fast_init_f32 (
         q15_t * pState,
         q15_t * pInlineBuffer);
 
+  /**
+   * @brief Instance structure for the floating-point DCT2/DCT3 functions.
+   */
+  typedef struct
+  {
+          uint16_t N;                          /**< length of the DCT. */
+          float32_t normalize;                 /**< normalizing factor sqrt(2/N). */
+    const float32_t *pTwiddle;                 /**< points to the twiddle factor table (N values). */
+          riscv_rfft_fast_instance_f32 rfft;   /**< real FFT instance of length N. */
+  } riscv_dct2_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point DCT2/DCT3.
+   * @param[in,out] S          points to an instance of floating-point DCT2/DCT3 structure.
+   * @param[in]     N          length of the DCT.
+   * @param[out]    pTwiddle   points to a buffer of N values receiving the twiddle factors.
+   * @return      riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   */
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+  riscv_status riscv_dct2_init_f32(
+        riscv_dct2_instance_f32 * S,
+        uint16_t N,
+        float32_t * pTwiddle);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+  /**
+   * @brief  Initialization function for the floating-point DCT2/DCT3 with FFT tables computed at runtime.
+   * @param[in,out] S          points to an instance of floating-point DCT2/DCT3 structure.
+   * @param[in]     N          length of the DCT.
+   * @param[out]    pTwiddle   points to a buffer of N values receiving the twiddle factors.
+   * @param[out]    pBuffer    points to a buffer of RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(N) values receiving the FFT tables.
+   * @return      riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   */
+  riscv_status riscv_dct2_init_dynamic_f32(
+        riscv_dct2_instance_f32 * S,
+        uint16_t N,
+        float32_t * pTwiddle,
+        float32_t * pBuffer);
+
+  /**
+   * @brief Processing function for the floating-point DCT2.
+   * @param[in]     S             points to an instance of the floating-point DCT2/DCT3 structure.
+   * @param[in]     pState        points to state buffer.
+   * @param[in,out] pInlineBuffer points to the in-place input and output buffer.
+   */
+  void riscv_dct2_f32(
+  const riscv_dct2_instance_f32 * S,
+        float32_t * pState,
+        float32_t * pInlineBuffer);
+
+  /**
+   * @brief Processing function for the floating-point DCT3, inverse of the DCT2.
+   * @param[in]     S             points to an instance of the floating-point DCT2/DCT3 structure.
+   * @param[in]     pState        points to state buffer.
+   * @param[in,out] pInlineBuffer points to the in-place input and output buffer.
+   */
+  void riscv_dct3_f32(
+  const riscv_dct2_instance_f32 * S,
+        float32_t * pState,
+        float32_t * pInlineBuffer);
+
   /**
    * @brief Instance structure for the Floating-point MFCC function.
    */
@@ -721,6 +901,7 @@ typedef struct
 #endif
   } riscv_mfcc_instance_f32 ;
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
 riscv_status riscv_mfcc_init_32_f32(
   riscv_mfcc_instance_f32 * S,
   uint32_t nbMelFilters,
@@ -820,6 +1001,29 @@ riscv_status riscv_mfcc_init_f32(
   const float32_t *filterCoefs,
   const float32_t *windowCoefs
   );
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+ * @brief Size, in float32_t, of the buffer used by riscv_mfcc_init_dynamic_f32.
+ */
+#if defined(RISCV_MFCC_CFFT_BASED)
+#define RISCV_MFCC_DYNAMIC_BUFFER_SIZE_F32(fftLen) RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(fftLen)
+#else
+#define RISCV_MFCC_DYNAMIC_BUFFER_SIZE_F32(fftLen) RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(fftLen)
+#endif
+
+riscv_status riscv_mfcc_init_dynamic_f32(
+  riscv_mfcc_instance_f32 * S,
+  uint32_t fftLen,
+  uint32_t nbMelFilters,
+  uint32_t nbDctOutputs,
+  const float32_t *dctCoefs,
+  const uint32_t *filterPos,
+  const uint32_t *filterLengths,
+  const float32_t *filterCoefs,
+  const float32_t *windowCoefs,
+  float32_t *pBuffer
+  );
 
 
 /**
@@ -837,6 +1041,25 @@ riscv_status riscv_mfcc_init_f32(
   float32_t *pTmp
   );
 
+/**
+  @brief         MFCC F32 on a batch of overlapping frames
+  @param[in]     S         points to the mfcc instance structure
+  @param[in]     pSrc      points to the input samples
+  @param[in]     nbFrames  number of frames to compute
+  @param[in]     hopSize   distance in samples between two consecutive frames
+  @param[out]    pDst      points to the nbFrames x nbDctOutputs output matrix
+  @param[inout]  pTmp      points to a temporary buffer
+  @return        none
+ */
+  void riscv_mfcc_batch_f32(
+  const riscv_mfcc_instance_f32 * S,
+  const float32_t *pSrc,
+  uint32_t nbFrames,
+  uint32_t hopSize,
+  float32_t *pDst,
+  float32_t *pTmp
+  );
+
 typedef struct
   {
      const q31_t *dctCoefs; /**< Internal DCT coefficients */
@@ -1107,6 +1330,360 @@ riscv_status riscv_mfcc_init_q15(
   q31_t *pTmp
   );
 
+  /**
+   * @brief Instance structure for the floating-point streaming STFT (analysis).
+   */
+  typedef struct
+  {
+          riscv_rfft_fast_instance_f32 rfft; /**< Internal RFFT instance */
+          uint16_t fftLen;                   /**< FFT length, also the frame length */
+          uint16_t hopSize;                  /**< number of new samples between two frames */
+          uint16_t writeIndex;               /**< next write position in the ring buffer */
+          uint16_t fill;                     /**< number of samples received since the last frame */
+    const float32_t *pWindow;                /**< points to the analysis window (fftLen values) */
+          float32_t *pState;                 /**< points to the ring buffer (fftLen values) */
+          float32_t *pScratch;               /**< points to the windowed frame scratch buffer (fftLen values) */
+  } riscv_stft_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point streaming ISTFT (overlap-add synthesis).
+   */
+  typedef struct
+  {
+          riscv_rfft_fast_instance_f32 rfft; /**< Internal RFFT instance */
+          uint16_t fftLen;                   /**< FFT length, also the frame length */
+          uint16_t hopSize;                  /**< number of output samples per frame */
+          uint16_t readIndex;                /**< read position in the overlap-add ring buffer */
+    const float32_t *pWindow;                /**< points to the synthesis window (fftLen values) */
+          float32_t *pState;                 /**< points to the overlap-add ring buffer (fftLen values) */
+          float32_t *pScratch;               /**< points to the time frame scratch buffer (fftLen values) */
+  } riscv_istft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point streaming STFT.
+   * @param[in,out] S         points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen    length of the FFT, any length supported by riscv_rfft_fast_init_f32.
+   * @param[in]     hopSize   number of new samples between two frames, 1 <= hopSize <= fftLen.
+   * @param[in]     pWindow   points to the analysis window of fftLen values.
+   * @param[in]     pState    points to the ring buffer of fftLen values.
+   * @param[in]     pScratch  points to the scratch buffer of fftLen values.
+   * @return        execution status
+   */
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+  riscv_status riscv_stft_init_f32(
+        riscv_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pScratch);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+  /**
+   * @brief  Initialization function for the floating-point streaming STFT with FFT tables computed at runtime.
+   * @param[in,out] S         points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen    length of the FFT, any length supported by riscv_rfft_fast_init_dynamic_f32.
+   * @param[in]     hopSize   number of new samples between two frames, 1 <= hopSize <= fftLen.
+   * @param[in]     pWindow   points to the analysis window of fftLen values.
+   * @param[in]     pState    points to the ring buffer of fftLen values.
+   * @param[in]     pScratch  points to the scratch buffer of fftLen values.
+   * @param[out]    pBuffer   points to a buffer of RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(fftLen) values receiving the FFT tables.
+   * @return        execution status
+   */
+  riscv_status riscv_stft_init_dynamic_f32(
+        riscv_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pScratch,
+        float32_t * pBuffer);
+
+  /**
+   * @brief  Processing function for the floating-point streaming STFT.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of input samples, any value.
+   * @param[out]    pDst       points to the output frames, fftLen values per frame.
+   * @return        number of frames written to pDst
+   */
+  uint32_t riscv_stft_f32(
+        riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the floating-point streaming ISTFT.
+   * @param[in,out] S                points to an instance of the floating-point ISTFT structure.
+   * @param[in]     fftLen           length of the FFT, any length supported by riscv_rfft_fast_init_f32.
+   * @param[in]     hopSize          number of output samples per frame, 1 <= hopSize <= fftLen.
+   * @param[in]     pAnalysisWindow  points to the analysis window of fftLen values used by the STFT.
+   * @param[out]    pWindow          points to a buffer of fftLen values receiving the synthesis window.
+   * @param[in]     pState           points to the overlap-add buffer of fftLen values.
+   * @param[in]     pScratch         points to the scratch buffer of fftLen values.
+   * @return        execution status
+   */
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+  riscv_status riscv_istft_init_f32(
+        riscv_istft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pAnalysisWindow,
+        float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pScratch);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+  /**
+   * @brief  Initialization function for the floating-point streaming ISTFT with FFT tables computed at runtime.
+   * @param[in,out] S                points to an instance of the floating-point ISTFT structure.
+   * @param[in]     fftLen           length of the FFT, any length supported by riscv_rfft_fast_init_dynamic_f32.
+   * @param[in]     hopSize          number of output samples per frame, 1 <= hopSize <= fftLen.
+   * @param[in]     pAnalysisWindow  points to the analysis window of fftLen values used by the STFT.
+   * @param[out]    pWindow          points to a buffer of fftLen values receiving the synthesis window.
+   * @param[in]     pState           points to the overlap-add buffer of fftLen values.
+   * @param[in]     pScratch         points to the scratch buffer of fftLen values.
+   * @param[out]    pBuffer          points to a buffer of RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(fftLen) values receiving the FFT tables.
+   * @return        execution status
+   */
+  riscv_status riscv_istft_init_dynamic_f32(
+        riscv_istft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pAnalysisWindow,
+        float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pScratch,
+        float32_t * pBuffer);
+
+  /**
+   * @brief  Processing function for the floating-point streaming ISTFT.
+   * @param[in,out] S     points to an instance of the floating-point ISTFT structure.
+   * @param[in]     pSrc  points to one frame in the packed format of riscv_rfft_fast_f32. Modified by the function.
+   * @param[out]    pDst  points to the block of hopSize output samples.
+   */
+  void riscv_istft_f32(
+        riscv_istft_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst);
+
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel algorithm.
+   */
+  typedef struct
+  {
+          uint16_t numBins;         /**< number of frequencies */
+    const float32_t *pCoeffs;       /**< points to the cosine, sine and frequency tables (3*numBins values) */
+  } riscv_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel algorithm.
+   */
+  typedef struct
+  {
+          uint16_t numBins;         /**< number of frequencies */
+    const q31_t *pCoeffs;           /**< points to the cosine, sine and frequency tables (3*numBins values) */
+  } riscv_goertzel_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel algorithm.
+   */
+  typedef struct
+  {
+          uint16_t numBins;         /**< number of frequencies */
+    const q15_t *pCoeffs;           /**< points to the cosine, sine and frequency tables (3*numBins values) */
+  } riscv_goertzel_instance_q15;
+
+  void riscv_goertzel_init_f32(
+        riscv_goertzel_instance_f32 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs);
+
+  void riscv_goertzel_init_q31(
+        riscv_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        q31_t * pCoeffs);
+
+  void riscv_goertzel_init_q15(
+        riscv_goertzel_instance_q15 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        q15_t * pCoeffs);
+
+  void riscv_goertzel_f32(
+  const riscv_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst);
+
+  void riscv_goertzel_q31(
+  const riscv_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q63_t * pDst);
+
+  void riscv_goertzel_q15(
+  const riscv_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t windowLen;       /**< length of the DFT window */
+          uint16_t numBins;         /**< number of tracked bins */
+          uint16_t stateIndex;      /**< oldest sample position in the delay line */
+    const float32_t *pTwiddle;      /**< points to the cosine and sine tables (2*numBins values) */
+          float32_t *pBins;         /**< points to the complex bins (2*numBins values) */
+          float32_t *pDelay;        /**< points to the delay line (windowLen values) */
+  } riscv_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t windowLen;       /**< length of the DFT window */
+          uint16_t numBins;         /**< number of tracked bins */
+          uint16_t stateIndex;      /**< oldest sample position in the delay line */
+    const q31_t *pTwiddle;          /**< points to the cosine and sine tables (2*numBins values) */
+          q63_t *pBins;             /**< points to the complex bins in 33.31 format (2*numBins values) */
+          q31_t *pDelay;            /**< points to the delay line (windowLen values) */
+  } riscv_sdft_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t windowLen;       /**< length of the DFT window */
+          uint16_t numBins;         /**< number of tracked bins */
+          uint16_t stateIndex;      /**< oldest sample position in the delay line */
+    const q31_t *pTwiddle;          /**< points to the Q31 cosine and sine tables (2*numBins values) */
+          q31_t *pBins;             /**< points to the complex bins in 17.15 format (2*numBins values) */
+          q15_t *pDelay;            /**< points to the delay line (windowLen values) */
+  } riscv_sdft_instance_q15;
+
+  riscv_status riscv_sdft_init_f32(
+        riscv_sdft_instance_f32 * S,
+        uint16_t windowLen,
+        uint16_t numBins,
+  const uint16_t * pBinIndex,
+        float32_t * pTwiddle,
+        float32_t * pBins,
+        float32_t * pDelay);
+
+  riscv_status riscv_sdft_init_q31(
+        riscv_sdft_instance_q31 * S,
+        uint16_t windowLen,
+        uint16_t numBins,
+  const uint16_t * pBinIndex,
+        q31_t * pTwiddle,
+        q63_t * pBins,
+        q31_t * pDelay);
+
+  riscv_status riscv_sdft_init_q15(
+        riscv_sdft_instance_q15 * S,
+        uint16_t windowLen,
+        uint16_t numBins,
+  const uint16_t * pBinIndex,
+        q31_t * pTwiddle,
+        q31_t * pBins,
+        q15_t * pDelay);
+
+  void riscv_sdft_f32(
+        riscv_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  void riscv_sdft_q31(
+        riscv_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  void riscv_sdft_q15(
+        riscv_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief Number of columns transformed together by the column pass of the 2-D FFT.
+   */
+#define RISCV_CFFT2D_TILE_COLS 8U
+
+  /**
+   * @brief Size of the scratch buffer of the 2-D FFT, in scalar values.
+   */
+#define RISCV_CFFT2D_SCRATCH_SIZE(numRows) (2U * RISCV_CFFT2D_TILE_COLS * (uint32_t)(numRows))
+
+  /**
+   * @brief Instance structure for the floating-point 2-D FFT.
+   */
+  typedef struct
+  {
+          uint16_t numRows;                 /**< number of rows of the matrix */
+          uint16_t numCols;                 /**< number of columns of the matrix */
+          riscv_cfft_instance_f32 rowCfft;  /**< CFFT instance of length numCols used for the rows */
+          riscv_cfft_instance_f32 colCfft;  /**< CFFT instance of length numRows used for the columns */
+          float32_t *pScratch;              /**< points to the column tile buffer (RISCV_CFFT2D_SCRATCH_SIZE(numRows) values) */
+  } riscv_cfft2d_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 2-D FFT.
+   */
+  typedef struct
+  {
+          uint16_t numRows;                 /**< number of rows of the matrix */
+          uint16_t numCols;                 /**< number of columns of the matrix */
+          riscv_cfft_instance_q31 rowCfft;  /**< CFFT instance of length numCols used for the rows */
+          riscv_cfft_instance_q31 colCfft;  /**< CFFT instance of length numRows used for the columns */
+          q31_t *pScratch;                  /**< points to the column tile buffer (RISCV_CFFT2D_SCRATCH_SIZE(numRows) values) */
+  } riscv_cfft2d_instance_q31;
+
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+  riscv_status riscv_cfft2d_init_f32(
+        riscv_cfft2d_instance_f32 * S,
+        uint16_t numRows,
+        uint16_t numCols,
+        float32_t * pScratch);
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+  /**
+   * @brief Size, in float32_t, of the buffer used by riscv_cfft2d_init_dynamic_f32.
+   */
+#define RISCV_CFFT2D_DYNAMIC_BUFFER_SIZE_F32(numRows, numCols) \
+  (RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(numRows) + RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(numCols))
+
+  riscv_status riscv_cfft2d_init_dynamic_f32(
+        riscv_cfft2d_instance_f32 * S,
+        uint16_t numRows,
+        uint16_t numCols,
+        float32_t * pScratch,
+        float32_t * pBuffer);
+
+  riscv_status riscv_cfft2d_init_q31(
+        riscv_cfft2d_instance_q31 * S,
+        uint16_t numRows,
+        uint16_t numCols,
+        q31_t * pScratch);
+
+  void riscv_cfft2d_f32(
+  const riscv_cfft2d_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag);
+
+  void riscv_cfft2d_q31(
+  const riscv_cfft2d_instance_q31 * S,
+        q31_t * p1,
+        uint8_t ifftFlag);
+
 
 #ifdef   __cplusplus
 }
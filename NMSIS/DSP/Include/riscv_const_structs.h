@@ -53,6 +53,7 @@ extern "C"
    extern const riscv_cfft_instance_f64 riscv_cfft_sR_f64_len2048;
    extern const riscv_cfft_instance_f64 riscv_cfft_sR_f64_len4096;
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
    extern const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len16;
    extern const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len32;
    extern const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len64;
@@ -62,6 +63,7 @@ extern "C"
    extern const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len1024;
    extern const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len2048;
    extern const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len4096;
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
 
    extern const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len16;
    extern const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len32;
@@ -75,6 +75,7 @@ const riscv_cfft_instance_f64 riscv_cfft_sR_f64_len4096 = {
 /* Floating-point structs */
 
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len16 = {
   16, twiddleCoef_16, riscvBitRevIndexTable16, RISCVBITREVINDEXTABLE_16_TABLE_LENGTH
 };
@@ -111,6 +112,7 @@ const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len2048 = {
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len4096 = {
   4096, twiddleCoef_4096, riscvBitRevIndexTable4096, RISCVBITREVINDEXTABLE_4096_TABLE_LENGTH
 };
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
 /* 
 
 Those structures cannot be used to initialize the MVE version of the FFT Q31 instances.
@@ -245,6 +247,7 @@ const riscv_rfft_fast_instance_f64 riscv_rfft_fast_sR_f64_len4096 = {
 };
 
 /* Floating-point structs */
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
 const riscv_rfft_fast_instance_f32 riscv_rfft_fast_sR_f32_len32 = {
   { 16, twiddleCoef_16, riscvBitRevIndexTable16, RISCVBITREVINDEXTABLE_16_TABLE_LENGTH },
   32U,
@@ -292,6 +295,7 @@ const riscv_rfft_fast_instance_f32 riscv_rfft_fast_sR_f32_len4096 = {
   4096U,
   (float32_t *)twiddleCoef_rfft_4096
 };
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
 
 /* Fixed-point structs */
 /* q31_t */
@@ -58,6 +58,69 @@ void riscv_vlog_f32(
 
    blkCnt = blockSize;
 
+#if defined(RISCV_MATH_VECTOR)
+   /*
+    * Cephes style logf: x = m * 2^e with m in [sqrt(1/2), sqrt(2)),
+    * log(x) = e * log(2) + log(m), log(m) approximated by a polynomial.
+    */
+   size_t l;
+   vfloat32m4_t vx, vm, vz, vy, ve;
+   vuint32m4_t vu;
+   vint32m4_t vexp;
+   vbool8_t mask;
+
+   for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+   {
+      vx = __riscv_vle32_v_f32m4(pSrc, l);
+      pSrc += l;
+
+      /* Scale subnormal inputs into the normal range */
+      mask = __riscv_vmflt_vf_f32m4_b8(vx, 1.17549435e-38f, l);
+      vx = __riscv_vmerge_vvm_f32m4(vx, __riscv_vfmul_vf_f32m4(vx, 8388608.0f, l), mask, l);
+      vexp = __riscv_vmerge_vxm_i32m4(__riscv_vmv_v_x_i32m4(-126, l), -149, mask, l);
+
+      /* Split mantissa in [0.5, 1) and exponent */
+      vu = __riscv_vreinterpret_v_f32m4_u32m4(vx);
+      vexp = __riscv_vadd_vv_i32m4(vexp, __riscv_vreinterpret_v_u32m4_i32m4(__riscv_vsrl_vx_u32m4(vu, 23, l)), l);
+      vu = __riscv_vor_vx_u32m4(__riscv_vand_vx_u32m4(vu, 0x007fffffU, l), 0x3f000000U, l);
+      vm = __riscv_vreinterpret_v_u32m4_f32m4(vu);
+
+      /* Move the mantissa to [sqrt(1/2), sqrt(2)) */
+      mask = __riscv_vmflt_vf_f32m4_b8(vm, 0.707106781186547524f, l);
+      vexp = __riscv_vsub_vv_i32m4(vexp, __riscv_vmerge_vxm_i32m4(__riscv_vmv_v_x_i32m4(0, l), 1, mask, l), l);
+      vm = __riscv_vmerge_vvm_f32m4(vm, __riscv_vfadd_vv_f32m4(vm, vm, l), mask, l);
+      vm = __riscv_vfsub_vf_f32m4(vm, 1.0f, l);
+      ve = __riscv_vfcvt_f_x_v_f32m4(vexp, l);
+
+      /* Polynomial approximation */
+      vz = __riscv_vfmul_vv_f32m4(vm, vm, l);
+      vy = __riscv_vfmv_v_f_f32m4(7.0376836292E-2f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l), -1.1514610310E-1f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l),  1.1676998740E-1f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l), -1.2420140846E-1f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l),  1.4249322787E-1f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l), -1.6668057665E-1f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l),  2.0000714765E-1f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l), -2.4999993993E-1f, l);
+      vy = __riscv_vfadd_vf_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l),  3.3333331174E-1f, l);
+      vy = __riscv_vfmul_vv_f32m4(__riscv_vfmul_vv_f32m4(vy, vm, l), vz, l);
+      vy = __riscv_vfmacc_vf_f32m4(vy, -2.12194440e-4f, ve, l);
+      vy = __riscv_vfmacc_vf_f32m4(vy, -0.5f, vz, l);
+      vy = __riscv_vfadd_vv_f32m4(vm, vy, l);
+      vy = __riscv_vfmacc_vf_f32m4(vy, 0.693359375f, ve, l);
+
+      /* Special values */
+      mask = __riscv_vmfeq_vf_f32m4_b8(vx, INFINITY, l);
+      vy = __riscv_vfmerge_vfm_f32m4(vy, INFINITY, mask, l);
+      mask = __riscv_vmfeq_vf_f32m4_b8(vx, 0.0f, l);
+      vy = __riscv_vfmerge_vfm_f32m4(vy, -INFINITY, mask, l);
+      mask = __riscv_vmor_mm_b8(__riscv_vmflt_vf_f32m4_b8(vx, 0.0f, l), __riscv_vmfne_vv_f32m4_b8(vx, vx, l), l);
+      vy = __riscv_vfmerge_vfm_f32m4(vy, NAN, mask, l);
+
+      __riscv_vse32_v_f32m4(pDst, vy, l);
+      pDst += l;
+   }
+#else
    while (blkCnt > 0U)
    {
       /* C = log(A) */
@@ -68,6 +131,7 @@ void riscv_vlog_f32(
       /* Decrement loop counter */
       blkCnt--;
    }
+#endif /* defined(RISCV_MATH_VECTOR) */
 }
 
 /**
@@ -37,22 +37,37 @@
 #include "riscv_biquad_cascade_df1_init_q31.c"
 #include "riscv_biquad_cascade_df1_q15.c"
 #include "riscv_biquad_cascade_df1_q31.c"
+#include "riscv_biquad_cascade_df2T_block_f32.c"
+#include "riscv_biquad_cascade_df2T_block_init_f32.c"
 #include "riscv_biquad_cascade_df2T_f32.c"
 #include "riscv_biquad_cascade_df2T_f64.c"
 #include "riscv_biquad_cascade_df2T_init_f32.c"
 #include "riscv_biquad_cascade_df2T_init_f64.c"
+#include "riscv_biquad_cascade_multi_df1_32x64_init_q31.c"
+#include "riscv_biquad_cascade_multi_df1_32x64_q31.c"
+#include "riscv_biquad_cascade_multi_df1_init_q31.c"
+#include "riscv_biquad_cascade_multi_df1_q31.c"
+#include "riscv_biquad_cascade_multi_df2T_f32.c"
+#include "riscv_biquad_cascade_multi_df2T_init_f32.c"
 #include "riscv_biquad_cascade_stereo_df2T_f32.c"
 #include "riscv_biquad_cascade_stereo_df2T_init_f32.c"
+#include "riscv_cic_decimate_init_q15.c"
+#include "riscv_cic_decimate_pdm_init_q15.c"
+#include "riscv_cic_decimate_pdm_q15.c"
+#include "riscv_cic_decimate_q15.c"
+#include "riscv_conv_auto_f32.c"
 #include "riscv_conv_f32.c"
 #include "riscv_conv_fast_opt_q15.c"
 #include "riscv_conv_fast_q15.c"
 #include "riscv_conv_fast_q31.c"
+#include "riscv_conv_fft_f32.c"
 #include "riscv_conv_opt_q15.c"
 #include "riscv_conv_opt_q7.c"
 #include "riscv_conv_partial_f32.c"
 #include "riscv_conv_partial_fast_opt_q15.c"
 #include "riscv_conv_partial_fast_q15.c"
 #include "riscv_conv_partial_fast_q31.c"
+#include "riscv_conv_partial_fft_f32.c"
 #include "riscv_conv_partial_opt_q15.c"
 #include "riscv_conv_partial_opt_q7.c"
 #include "riscv_conv_partial_q15.c"
@@ -61,16 +76,32 @@
 #include "riscv_conv_q15.c"
 #include "riscv_conv_q31.c"
 #include "riscv_conv_q7.c"
+#include "riscv_correlate_auto_f32.c"
 #include "riscv_correlate_f32.c"
 #include "riscv_correlate_f64.c"
 #include "riscv_correlate_fast_opt_q15.c"
 #include "riscv_correlate_fast_q15.c"
 #include "riscv_correlate_fast_q31.c"
+#include "riscv_correlate_fft_f32.c"
 #include "riscv_correlate_opt_q15.c"
 #include "riscv_correlate_opt_q7.c"
 #include "riscv_correlate_q15.c"
 #include "riscv_correlate_q31.c"
 #include "riscv_correlate_q7.c"
+#include "riscv_filter_chain_f32.c"
+#include "riscv_filter_chain_init_f32.c"
+#include "riscv_filter_chain_init_q15.c"
+#include "riscv_filter_chain_init_q31.c"
+#include "riscv_filter_chain_q15.c"
+#include "riscv_filter_chain_q31.c"
+#include "riscv_fir_circ_f32.c"
+#include "riscv_fir_circ_init_f32.c"
+#include "riscv_fir_circ_init_q15.c"
+#include "riscv_fir_circ_init_q31.c"
+#include "riscv_fir_circ_init_q7.c"
+#include "riscv_fir_circ_q15.c"
+#include "riscv_fir_circ_q31.c"
+#include "riscv_fir_circ_q7.c"
 #include "riscv_fir_decimate_f32.c"
 #include "riscv_fir_decimate_fast_q15.c"
 #include "riscv_fir_decimate_fast_q31.c"
@@ -83,6 +114,12 @@
 #include "riscv_fir_f64.c"
 #include "riscv_fir_fast_q15.c"
 #include "riscv_fir_fast_q31.c"
+#include "riscv_fir_halfband_decimate_f32.c"
+#include "riscv_fir_halfband_decimate_init_f32.c"
+#include "riscv_fir_halfband_decimate_init_q15.c"
+#include "riscv_fir_halfband_decimate_init_q31.c"
+#include "riscv_fir_halfband_decimate_q15.c"
+#include "riscv_fir_halfband_decimate_q31.c"
 #include "riscv_fir_init_f32.c"
 #include "riscv_fir_init_f64.c"
 #include "riscv_fir_init_q15.c"
@@ -100,9 +137,25 @@
 #include "riscv_fir_lattice_init_q31.c"
 #include "riscv_fir_lattice_q15.c"
 #include "riscv_fir_lattice_q31.c"
+#include "riscv_fir_multi_f32.c"
+#include "riscv_fir_multi_init_f32.c"
+#include "riscv_fir_multi_init_q15.c"
+#include "riscv_fir_multi_init_q31.c"
+#include "riscv_fir_multi_q15.c"
+#include "riscv_fir_multi_q31.c"
+#include "riscv_fir_partitioned_f32.c"
+#include "riscv_fir_partitioned_init_f32.c"
+#include "riscv_fir_partitioned_init_q31.c"
+#include "riscv_fir_partitioned_q31.c"
 #include "riscv_fir_q15.c"
 #include "riscv_fir_q31.c"
 #include "riscv_fir_q7.c"
+#include "riscv_fir_resample_f32.c"
+#include "riscv_fir_resample_init_f32.c"
+#include "riscv_fir_resample_init_q15.c"
+#include "riscv_fir_resample_init_q31.c"
+#include "riscv_fir_resample_q15.c"
+#include "riscv_fir_resample_q31.c"
 #include "riscv_fir_sparse_f32.c"
 #include "riscv_fir_sparse_init_f32.c"
 #include "riscv_fir_sparse_init_q15.c"
@@ -118,6 +171,8 @@
 #include "riscv_iir_lattice_q15.c"
 #include "riscv_iir_lattice_q31.c"
 #include "riscv_lms_f32.c"
+#include "riscv_lms_fd_f32.c"
+#include "riscv_lms_fd_init_f32.c"
 #include "riscv_lms_init_f32.c"
 #include "riscv_lms_init_q15.c"
 #include "riscv_lms_init_q31.c"
@@ -132,3 +187,5 @@
 
 #include "riscv_levinson_durbin_f32.c"
 #include "riscv_levinson_durbin_q31.c"
+#include "riscv_lpc_analysis_f32.c"
+#include "riscv_lpc_analysis_q31.c"
@@ -33,5 +33,7 @@
 #include "riscv_biquad_cascade_df2T_init_f16.c"
 #include "riscv_biquad_cascade_stereo_df2T_f16.c"
 #include "riscv_biquad_cascade_stereo_df2T_init_f16.c"
+#include "riscv_biquad_cascade_multi_df2T_f16.c"
+#include "riscv_biquad_cascade_multi_df2T_init_f16.c"
 #include "riscv_correlate_f16.c"
 #include "riscv_levinson_durbin_f16.c"
@@ -167,6 +167,11 @@
                    In order to avoid overflows completely the input signal must be scaled down by 2 bits and lie in the range [-0.25 +0.25).
                    After all 5 multiply-accumulates are performed, the 2.62 accumulator is shifted by <code>postShift</code> bits and the result truncated to
                    1.31 format by discarding the low 32 bits.
+  @par
+                   With the DSP extension, the 32x64 feedback products are split into 32x32 products
+                   accumulated in 64 bits with SMAR64 and the result is bit exact with the C version.
+                   To filter several channels with the vector extension, use
+                   \ref riscv_biquad_cas_multi_df1_32x64_q31().
   @par
                    Two related functions are provided in the NMSIS DSP library.
                    - \ref riscv_biquad_cascade_df1_q31() implements a Biquad cascade with 32-bit coefficients and state variables with a Q63 accumulator.
@@ -190,10 +195,19 @@ void riscv_biquad_cas_df1_32x64_q31(
         q31_t Xn;                                      /* temporary input */
         int32_t shift = (int32_t) S->postShift + 1;    /* Shift to be applied to the output */
         uint32_t sample, stage = S->numStages;         /* loop counters */
-        q31_t acc_l, acc_h;                            /* temporary output */
         uint32_t uShift = ((uint32_t) S->postShift + 1U);
         uint32_t lShift = 32U - uShift;                /* Shift to be applied to the output */
 
+#if defined (RISCV_MATH_DSP)
+#if (__RISCV_XLEN == 64)
+        q63_t b12, a12;                                /* Packed filter coefficients */
+        q63_t x12;                                     /* Packed x[n-1], x[n-2] */
+        q63_t yh12, yl12;                              /* Packed high and low words of y[n-1], y[n-2] */
+#endif /* (__RISCV_XLEN == 64) */
+#else
+        q31_t acc_l, acc_h;                            /* temporary output */
+#endif /* defined (RISCV_MATH_DSP) */
+
   do
   {
     /* Reading the coefficients */
@@ -209,6 +223,88 @@ void riscv_biquad_cas_df1_32x64_q31(
     Yn1 = pState[2];
     Yn2 = pState[3];
 
+#if defined (RISCV_MATH_DSP)
+    /*
+     * mult32x64(y, a) is computed with 32x32 signed products: the high word of y times a,
+     * plus the high word of the product of the low word read as signed, plus a when the
+     * low word is negative, which gives the same result as the unsigned low word product.
+     */
+#if (__RISCV_XLEN == 64)
+    /* The two taps of each pair are processed together by SMAR64 */
+    b12 = __RV_PKBB32(b2, b1);
+    a12 = __RV_PKBB32(a2, a1);
+    x12 = __RV_PKBB32(Xn2, Xn1);
+    yh12 = __RV_PKBB32(Yn2 >> 32, Yn1 >> 32);
+    yl12 = __RV_PKBB32(Yn2, Yn1);
+
+    sample = blockSize;
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] */
+      acc = __RV_MULSR64(Xn, b0);
+      acc = __RV_SMAR64(acc, x12, b12);
+
+      /* acc +=  a1 * y[n-1] + a2 * y[n-2] */
+      acc = __RV_SMAR64(acc, yh12, a12);
+      acc = __RV_SMAR64(acc, __RV_SRLI32(yl12, 31), a12);
+      acc = __RV_SMAR64(acc, __RV_SMMUL(yl12, a12), 0x0000000100000001LL);
+
+      /* Update the state: x[n-1] and y[n-1] move to the high words */
+      x12 = __RV_PKBB32(x12, Xn);
+      Yn1 = acc << shift;
+      yh12 = __RV_PKBB32(yh12, Yn1 >> 32);
+      yl12 = __RV_PKBB32(yl12, Yn1);
+
+      /* Store the output in the destination buffer in 1.31 format. */
+      *pOut++ = (q31_t) (acc >> lShift);
+
+      /* decrement loop counter */
+      sample--;
+    }
+
+    Xn1 = (q31_t) x12;
+    Xn2 = (q31_t) (x12 >> 32);
+    Yn1 = (q63_t) (((uint64_t) yh12 << 32) | (uint32_t) yl12);
+    Yn2 = (q63_t) (((uint64_t) yh12 & 0xFFFFFFFF00000000ULL) | ((uint64_t) yl12 >> 32));
+#else
+    sample = blockSize;
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] */
+      acc = __RV_MULSR64(Xn, b0);
+      acc = __RV_SMAR64(acc, Xn1, b1);
+      acc = __RV_SMAR64(acc, Xn2, b2);
+
+      /* acc +=  a1 * y[n-1] */
+      acc = __RV_SMAR64(acc, (q31_t) (Yn1 >> 32), a1);
+      acc = __RV_SMAR64(acc, (uint32_t) Yn1 >> 31, a1);
+      acc += (q31_t) __RV_SMMUL((q31_t) Yn1, a1);
+
+      /* acc +=  a2 * y[n-2] */
+      acc = __RV_SMAR64(acc, (q31_t) (Yn2 >> 32), a2);
+      acc = __RV_SMAR64(acc, (uint32_t) Yn2 >> 31, a2);
+      acc += (q31_t) __RV_SMMUL((q31_t) Yn2, a2);
+
+      /* Update the state */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = acc << shift;
+
+      /* Store the output in the destination buffer in 1.31 format. */
+      *pOut++ = (q31_t) (acc >> lShift);
+
+      /* decrement loop counter */
+      sample--;
+    }
+#endif /* (__RISCV_XLEN == 64) */
+#else
 #if defined (RISCV_MATH_LOOPUNROLL)
 
     /* Apply loop unrolling and compute 4 output values simultaneously. */
@@ -437,6 +533,7 @@ void riscv_biquad_cas_df1_32x64_q31(
       /* decrement loop counter */
       sample--;
     }
+#endif /* defined (RISCV_MATH_DSP) */
 
     /* The first stage output is given as input to the second stage. */
     pIn = pDst;
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_biquad_cascade_df2T_block_f32.c
+ * Description:  Processing function for floating-point block state-space Biquad cascade filter
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+*/
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point block state-space Biquad cascade filter.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data
+  @param[out]    pDst      points to the block of output data
+  @param[in]     blockSize number of samples to process
+  @return        none
+
+  @par           Description
+                   The function computes the same filter as \ref riscv_biquad_cascade_df2T_f32
+                   but does not run the feedback loop sample by sample. Each stage is written
+                   as a state-space system and, for a block of <code>blockLen</code> inputs,
+                   the outputs and the state at the end of the block are a linear function
+                   of the state at the start of the block and of the inputs:
+  <pre>
+      [y[n] .. y[n+blockLen-1], d1', d2'] = G * [d1, d2, x[n] .. x[n+blockLen-1]]
+  </pre>
+                   The <code>(blockLen+2)x(blockLen+2)</code> matrix <code>G</code> of each stage
+                   is computed once by \ref riscv_biquad_cascade_df2T_block_init_f32, so a block
+                   costs one matrix-vector product whose rows are independent and fill the vector
+                   unit. The only serial dependency left is from one block to the next.
+  @par
+                   When <code>blockSize</code> is not a multiple of <code>blockLen</code>, the last
+                   samples are processed with the direct recursion. The processing may be done in-place.
+  @par           Precision
+                   The matrices are computed in double precision. For stable filters the outputs
+                   match the direct form within the single precision rounding noise. Filters with
+                   poles close to the unit circle need a small <code>blockLen</code> because the
+                   coefficients of <code>G</code> grow with the powers of the state matrix.
+ */
+void riscv_biquad_cascade_df2T_block_f32(
+  const riscv_biquad_cascade_df2T_block_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pOut;                               /* Destination pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const float32_t *pG = S->pBlockCoeffs;               /* Block matrix of the current stage */
+  const float32_t *pCol;                               /* Column pointer */
+        float32_t z[RISCV_BIQUAD_BLOCK_MAX_LEN + 2U];  /* Outputs and state at the end of a block */
+        float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+        float32_t Xn1, acc1;                           /* Temporary input and accumulator */
+        float32_t d1, d2;                              /* State variables */
+        uint32_t M = S->blockLen;                      /* Block length */
+        uint32_t nRows = M + 2U;                       /* Size of the block matrix */
+        uint32_t blkCnt, sample, j, stage = S->numStages;   /* Loop counters */
+
+#if defined (RISCV_MATH_VECTOR)
+        size_t l;
+        uint32_t rows, r;
+        vfloat32m8_t v_acc;
+#else
+        uint32_t r;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5U;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    pOut = pDst;
+    blkCnt = blockSize / M;
+    while (blkCnt > 0U)
+    {
+      /* z = G * [d1, d2, x[n] .. x[n+M-1]], G is stored column by column */
+#if defined (RISCV_MATH_VECTOR)
+      rows = nRows;
+      r = 0U;
+      for (; (l = __riscv_vsetvl_e32m8(rows)) > 0; rows -= l)
+      {
+        pCol = pG + r;
+        v_acc = __riscv_vfmul_vf_f32m8(__riscv_vle32_v_f32m8(pCol, l), d1, l);
+        pCol += nRows;
+        v_acc = __riscv_vfmacc_vf_f32m8(v_acc, d2, __riscv_vle32_v_f32m8(pCol, l), l);
+        pCol += nRows;
+        for (j = 0U; j < M; j++)
+        {
+          v_acc = __riscv_vfmacc_vf_f32m8(v_acc, pIn[j], __riscv_vle32_v_f32m8(pCol, l), l);
+          pCol += nRows;
+        }
+        __riscv_vse32_v_f32m8(z + r, v_acc, l);
+        r += l;
+      }
+#else
+      pCol = pG;
+      for (r = 0U; r < nRows; r++)
+      {
+        z[r] = pCol[r] * d1;
+      }
+      pCol += nRows;
+      for (r = 0U; r < nRows; r++)
+      {
+        z[r] += pCol[r] * d2;
+      }
+      pCol += nRows;
+      for (j = 0U; j < M; j++)
+      {
+        Xn1 = pIn[j];
+        for (r = 0U; r < nRows; r++)
+        {
+          z[r] += pCol[r] * Xn1;
+        }
+        pCol += nRows;
+      }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+      /* The input block is fully read, so the outputs may overwrite it */
+      for (j = 0U; j < M; j++)
+      {
+        pOut[j] = z[j];
+      }
+      d1 = z[M];
+      d2 = z[M + 1U];
+
+      pIn += M;
+      pOut += M;
+      blkCnt--;
+    }
+
+    /* Remaining samples with the direct form recursion */
+    sample = blockSize % M;
+    while (sample > 0U)
+    {
+      Xn1 = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc1 = (b0 * Xn1) + d1;
+      *pOut++ = acc1;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = (b2 * Xn1) + (a2 * acc1);
+
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    pState[0] = d1;
+    pState[1] = d2;
+    pState += 2U;
+    pG += nRows * nRows;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_biquad_cascade_df2T_block_init_f32.c
+ * Description:  Initialization function for floating-point block state-space Biquad cascade filter
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point block state-space Biquad cascade filter.
+  @param[in,out] S             points to an instance of the filter data structure.
+  @param[in]     numStages     number of 2nd order stages in the filter.
+  @param[in]     pCoeffs       points to the filter coefficients.
+  @param[out]    pBlockCoeffs  points to a buffer of <code>RISCV_BIQUAD_BLOCK_COEFFS_SIZE_F32(numStages, blockLen)</code>
+                               values receiving the block matrices.
+  @param[in]     pState        points to the state buffer.
+  @param[in]     blockLen      number of outputs computed per matrix product, between 1 and \ref RISCV_BIQUAD_BLOCK_MAX_LEN.
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>blockLen</code> is not supported
+
+  @par           Coefficient and State Ordering
+                   The coefficients and the state have the same order as for \ref riscv_biquad_cascade_df2T_init_f32:
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+  @par
+                   Column <code>i</code> of the block matrix of a stage is the response of the stage,
+                   over <code>blockLen</code> samples, to a unit initial state <code>d1</code> (i = 0),
+                   <code>d2</code> (i = 1) or to a unit input at sample <code>i-2</code>. Its rows
+                   are the <code>blockLen</code> outputs followed by the final <code>d1</code> and <code>d2</code>.
+                   The buffer must stay valid for the lifetime of the instance.
+  @par
+                   A <code>blockLen</code> equal to the vector length in 32-bit elements, or a small
+                   multiple of it, gives the best throughput.
+ */
+riscv_status riscv_biquad_cascade_df2T_block_init_f32(
+        riscv_biquad_cascade_df2T_block_instance_f32 * S,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pBlockCoeffs,
+        float32_t * pState,
+        uint16_t blockLen)
+{
+  const float32_t *pC = pCoeffs;
+        float32_t *pG = pBlockCoeffs;
+        float64_t b0, b1, b2, a1, a2;
+        float64_t d1, d2, x, y;
+        uint32_t nRows, stage, i, n;
+
+  if ((blockLen == 0U) || (blockLen > RISCV_BIQUAD_BLOCK_MAX_LEN) || (pBlockCoeffs == NULL))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  nRows = (uint32_t) blockLen + 2U;
+  for (stage = 0U; stage < numStages; stage++)
+  {
+    b0 = pC[0];
+    b1 = pC[1];
+    b2 = pC[2];
+    a1 = pC[3];
+    a2 = pC[4];
+    pC += 5U;
+
+    /* Each column is the response to one unit initial state or unit input, computed in double precision */
+    for (i = 0U; i < nRows; i++)
+    {
+      d1 = (i == 0U) ? 1.0 : 0.0;
+      d2 = (i == 1U) ? 1.0 : 0.0;
+      for (n = 0U; n < blockLen; n++)
+      {
+        x = ((n + 2U) == i) ? 1.0 : 0.0;
+        y = b0 * x + d1;
+        d1 = b1 * x + a1 * y + d2;
+        d2 = b2 * x + a2 * y;
+        pG[n] = (float32_t) y;
+      }
+      pG[blockLen] = (float32_t) d1;
+      pG[blockLen + 1U] = (float32_t) d2;
+      pG += nRows;
+    }
+  }
+
+  S->numStages = numStages;
+  S->blockLen = blockLen;
+  S->pCoeffs = pCoeffs;
+  S->pBlockCoeffs = pBlockCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages */
+  memset(pState, 0, (2U * (uint32_t) numStages) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
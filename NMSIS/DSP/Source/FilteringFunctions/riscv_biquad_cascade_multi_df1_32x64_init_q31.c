@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_biquad_cascade_multi_df1_32x64_init_q31.c
+ * Description:  Initialization function for the high precision Q31 Biquad cascade filter. N channels
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1_32x64
+  @{
+ */
+
+/**
+  @brief         Initialization function for the high precision Q31 Biquad cascade filter. N channels
+  @param[in,out] S           points to an instance of the high precision Q31 Biquad cascade filter structure
+  @param[in]     numStages   number of 2nd order stages in the filter
+  @param[in]     numChans    number of channels
+  @param[in]     layout      layout of the input and output blocks
+                   - \ref RISCV_MULTICHANNEL_INTERLEAVED : sample n of channel c at index <code>n*numChans + c</code>
+                   - \ref RISCV_MULTICHANNEL_PLANAR : sample n of channel c at index <code>c*blockSize + n</code>
+  @param[in]     pCoeffs     points to the filter coefficients
+  @param[in]     pState      points to the state buffer
+  @param[in]     postShift   Shift to be applied after the accumulator.  Varies according to the coefficients format
+  @return        none
+
+  @par           Coefficient and State Ordering
+                   The coefficients are shared by all the channels and stored in the array
+                   <code>pCoeffs</code> in the same order as for \ref riscv_biquad_cas_df1_32x64_init_q31:
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+  @par
+                   For each stage, the state array holds <code>x[n-1]</code> of all the channels,
+                   then <code>x[n-2]</code>, <code>y[n-1]</code> and <code>y[n-2]</code> of all the channels,
+                   each in 1.63 format.
+                   The state array has a total length of <code>4*numStages*numChans</code> values.
+                   The state variables are updated after each block of data is processed; the coefficients are untouched.
+ */
+void riscv_biquad_cas_multi_df1_32x64_init_q31(
+        riscv_biquad_cas_multi_df1_32x64_ins_q31 * S,
+        uint8_t numStages,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const q31_t * pCoeffs,
+        q63_t * pState,
+        uint8_t postShift)
+{
+  /* Assign filter stages, channels and layout */
+  S->numStages = numStages;
+  S->numChans = numChans;
+  S->layout = layout;
+
+  /* Assign postShift to be applied to the output */
+  S->postShift = postShift;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 4 * numStages * numChans */
+  memset(pState, 0, (4U * (uint32_t) numStages * numChans) * sizeof(q63_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of BiquadCascadeDF1_32x64 group
+ */
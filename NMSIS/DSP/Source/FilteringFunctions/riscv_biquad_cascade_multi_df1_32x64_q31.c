@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_biquad_cascade_multi_df1_32x64_q31.c
+ * Description:  Processing function for the high precision Q31 Biquad cascade filter. N channels
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1_32x64
+  @{
+ */
+
+/**
+  @brief         Processing function for the high precision Q31 Biquad cascade filter. N channels
+  @param[in]     S         points to an instance of the high precision Q31 Biquad cascade filter structure
+  @param[in]     pSrc      points to the block of input data, <code>numChans*blockSize</code> values
+  @param[out]    pDst      points to the block of output data, <code>numChans*blockSize</code> values
+  @param[in]     blockSize number of samples to process per channel
+  @return        none
+
+  @par           Description
+                   All the channels are filtered with the same coefficients, each channel
+                   with its own 1.63 state, stored interleaved or planar as selected at
+                   initialization. The output has the layout of the input and the
+                   processing may be done in-place.
+  @par
+                   The recursion of a single channel cannot be vectorized. The vector version
+                   processes one channel per 64-bit vector lane instead, so each channel gives
+                   the same result as \ref riscv_biquad_cas_df1_32x64_q31.
+
+  @par           Scaling and Overflow Behavior
+                   The function has the same scaling and overflow behavior as
+                   \ref riscv_biquad_cas_df1_32x64_q31: the 2.62 accumulator wraps around,
+                   the input must be scaled down by 2 bits and lie in the range [-0.25 +0.25).
+ */
+void riscv_biquad_cas_multi_df1_32x64_q31(
+  const riscv_biquad_cas_multi_df1_32x64_ins_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pIn = pSrc;                             /* Source pointer */
+        q31_t *pOut;                                   /* Destination pointer */
+        q63_t *pState = S->pState;                     /* pState pointer */
+  const q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q31_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+        uint32_t shift = (uint32_t) S->postShift + 1U; /* Shift to be applied to the state */
+        uint32_t lShift = 32U - shift;                 /* Shift to be applied to the output */
+        uint32_t numChans = S->numChans;               /* Number of channels */
+        uint32_t chanStride, sampleStride;             /* Distance between channels and between samples */
+  const q31_t *px;                                     /* Channel input pointer */
+        uint32_t sample, stage = S->numStages;         /* Loop counters */
+        uint32_t ch;
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+        size_t l;
+        uint32_t blkCnt;
+        ptrdiff_t bstride;
+        vint32m2_t v_x, v_x1, v_x2;
+        vint64m4_t v_y1, v_y2, v_acc;
+#else
+        q63_t acc;                                     /* Accumulator */
+        q31_t Xn, Xn1, Xn2;                            /* Input state variables */
+        q63_t Yn1, Yn2;                                /* Output state variables */
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  if (S->layout == RISCV_MULTICHANNEL_INTERLEAVED)
+  {
+    chanStride = 1U;
+    sampleStride = numChans;
+  }
+  else
+  {
+    chanStride = blockSize;
+    sampleStride = 1U;
+  }
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5U;
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+    bstride = (ptrdiff_t) chanStride * 4;
+    blkCnt = numChans;
+    ch = 0U;
+    for (; (l = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= l)
+    {
+      /* x[n-1], x[n-2], y[n-1] and y[n-2] of all the channels are stored one after the other */
+      v_x1 = __riscv_vncvt_x_x_w_i32m2(__riscv_vle64_v_i64m4(pState + ch, l), l);
+      v_x2 = __riscv_vncvt_x_x_w_i32m2(__riscv_vle64_v_i64m4(pState + numChans + ch, l), l);
+      v_y1 = __riscv_vle64_v_i64m4(pState + 2U * numChans + ch, l);
+      v_y2 = __riscv_vle64_v_i64m4(pState + 3U * numChans + ch, l);
+
+      px = pIn + ch * chanStride;
+      pOut = pDst + ch * chanStride;
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        if (chanStride == 1U)
+        {
+          v_x = __riscv_vle32_v_i32m2(px, l);
+        }
+        else
+        {
+          v_x = __riscv_vlse32_v_i32m2(px, bstride, l);
+        }
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] */
+        v_acc = __riscv_vwmul_vx_i64m4(v_x, b0, l);
+        v_acc = __riscv_vwmacc_vx_i64m4(v_acc, b1, v_x1, l);
+        v_acc = __riscv_vwmacc_vx_i64m4(v_acc, b2, v_x2, l);
+
+        /* acc +=  mult32x64(y[n-1], a1) + mult32x64(y[n-2], a2): low words as unsigned, then high words */
+        v_acc = __riscv_vadd_vv_i64m4(v_acc, __riscv_vsra_vx_i64m4(__riscv_vmul_vx_i64m4(
+                  __riscv_vand_vx_i64m4(v_y1, 0xFFFFFFFF, l), a1, l), 32U, l), l);
+        v_acc = __riscv_vmacc_vx_i64m4(v_acc, a1, __riscv_vsra_vx_i64m4(v_y1, 32U, l), l);
+        v_acc = __riscv_vadd_vv_i64m4(v_acc, __riscv_vsra_vx_i64m4(__riscv_vmul_vx_i64m4(
+                  __riscv_vand_vx_i64m4(v_y2, 0xFFFFFFFF, l), a2, l), 32U, l), l);
+        v_acc = __riscv_vmacc_vx_i64m4(v_acc, a2, __riscv_vsra_vx_i64m4(v_y2, 32U, l), l);
+
+        /* Every time after the output is computed state should be updated. */
+        v_x2 = v_x1;
+        v_x1 = v_x;
+        v_y2 = v_y1;
+
+        /* The state is kept in 1.63 format, the output is converted to 1.31 */
+        v_y1 = __riscv_vsll_vx_i64m4(v_acc, shift, l);
+
+        if (chanStride == 1U)
+        {
+          __riscv_vse32_v_i32m2(pOut, __riscv_vnsra_wx_i32m2(v_acc, lShift, l), l);
+        }
+        else
+        {
+          __riscv_vsse32_v_i32m2(pOut, bstride, __riscv_vnsra_wx_i32m2(v_acc, lShift, l), l);
+        }
+        px += sampleStride;
+        pOut += sampleStride;
+      }
+
+      __riscv_vse64_v_i64m4(pState + ch, __riscv_vsext_vf2_i64m4(v_x1, l), l);
+      __riscv_vse64_v_i64m4(pState + numChans + ch, __riscv_vsext_vf2_i64m4(v_x2, l), l);
+      __riscv_vse64_v_i64m4(pState + 2U * numChans + ch, v_y1, l);
+      __riscv_vse64_v_i64m4(pState + 3U * numChans + ch, v_y2, l);
+      ch += l;
+    }
+#else
+    for (ch = 0U; ch < numChans; ch++)
+    {
+      /* x[n-1], x[n-2], y[n-1] and y[n-2] of all the channels are stored one after the other */
+      Xn1 = (q31_t) pState[ch];
+      Xn2 = (q31_t) pState[numChans + ch];
+      Yn1 = pState[2U * numChans + ch];
+      Yn2 = pState[3U * numChans + ch];
+
+      px = pIn + ch * chanStride;
+      pOut = pDst + ch * chanStride;
+      sample = blockSize;
+      while (sample > 0U)
+      {
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = ((q63_t) b0 * Xn) + ((q63_t) b1 * Xn1) + ((q63_t) b2 * Xn2);
+        acc += mult32x64(Yn1, a1);
+        acc += mult32x64(Yn2, a2);
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+
+        /* The state is kept in 1.63 format, the output is converted to 1.31 */
+        Yn1 = acc << shift;
+        *pOut = (q31_t) (acc >> lShift);
+
+        px += sampleStride;
+        pOut += sampleStride;
+        sample--;
+      }
+
+      pState[ch] = (q63_t) Xn1;
+      pState[numChans + ch] = (q63_t) Xn2;
+      pState[2U * numChans + ch] = Yn1;
+      pState[3U * numChans + ch] = Yn2;
+    }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+    pState += 4U * numChans;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadCascadeDF1_32x64 group
+ */
@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_biquad_cascade_multi_df2T_f16.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter. N channels
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions_f16.h"
+
+#if defined(RISCV_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupFilters
+*/
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point transposed direct form II Biquad cascade filter. N channels
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of input data, <code>numChans*blockSize</code> values
+  @param[out]    pDst      points to the block of output data, <code>numChans*blockSize</code> values
+  @param[in]     blockSize number of samples to process per channel
+  @return        none
+
+  @par           Description
+                   All the channels are filtered with the same coefficients, each channel
+                   with its own state. This generalizes \ref riscv_biquad_cascade_stereo_df2T_f16
+                   to <code>numChans</code> channels stored interleaved or planar, as selected
+                   at initialization. The output has the layout of the input and the
+                   processing may be done in-place.
+  @par
+                   The recursion is serial along the samples of a channel, so the vector
+                   version processes one channel per vector lane and runs a whole block
+                   of samples through each stage before moving to the next one.
+ */
+void riscv_biquad_cascade_multi_df2T_f16(
+  const riscv_biquad_cascade_multi_df2T_instance_f16 * S,
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize)
+{
+  const float16_t *pIn = pSrc;                         /* Source pointer */
+        float16_t *pOut;                               /* Destination pointer */
+        float16_t *pState = S->pState;                 /* State pointer */
+  const float16_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        _Float16 b0, b1, b2, a1, a2;                   /* Filter coefficients */
+        uint32_t numChans = S->numChans;               /* Number of channels */
+        uint32_t chanStride, sampleStride;             /* Distance between channels and between samples */
+  const float16_t *px;                                 /* Channel input pointer */
+        uint32_t sample, stage = S->numStages;         /* Loop counters */
+        uint32_t ch;
+
+#if defined (RISCV_MATH_VECTOR)
+        size_t l;
+        uint32_t blkCnt;
+        ptrdiff_t bstride;
+        vfloat16m4_t v_x, v_y, v_d1, v_d2;
+#else
+        _Float16 Xn1, acc1;                            /* Temporary input and accumulator */
+        _Float16 d1, d2;                               /* State variables */
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  if (S->layout == RISCV_MULTICHANNEL_INTERLEAVED)
+  {
+    chanStride = 1U;
+    sampleStride = numChans;
+  }
+  else
+  {
+    chanStride = blockSize;
+    sampleStride = 1U;
+  }
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5U;
+
+#if defined (RISCV_MATH_VECTOR)
+    bstride = (ptrdiff_t) chanStride * 2;
+    blkCnt = numChans;
+    ch = 0U;
+    for (; (l = __riscv_vsetvl_e16m4(blkCnt)) > 0; blkCnt -= l)
+    {
+      /* The d1 state of all the channels is stored first, then the d2 state */
+      v_d1 = __riscv_vle16_v_f16m4(pState + ch, l);
+      v_d2 = __riscv_vle16_v_f16m4(pState + numChans + ch, l);
+
+      px = pIn + ch * chanStride;
+      pOut = pDst + ch * chanStride;
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        if (chanStride == 1U)
+        {
+          v_x = __riscv_vle16_v_f16m4(px, l);
+        }
+        else
+        {
+          v_x = __riscv_vlse16_v_f16m4(px, bstride, l);
+        }
+
+        /* y[n] = b0 * x[n] + d1 */
+        v_y = __riscv_vfmacc_vf_f16m4(v_d1, b0, v_x, l);
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        v_d1 = __riscv_vfmacc_vf_f16m4(__riscv_vfmacc_vf_f16m4(v_d2, b1, v_x, l), a1, v_y, l);
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        v_d2 = __riscv_vfmacc_vf_f16m4(__riscv_vfmul_vf_f16m4(v_x, b2, l), a2, v_y, l);
+
+        if (chanStride == 1U)
+        {
+          __riscv_vse16_v_f16m4(pOut, v_y, l);
+        }
+        else
+        {
+          __riscv_vsse16_v_f16m4(pOut, bstride, v_y, l);
+        }
+        px += sampleStride;
+        pOut += sampleStride;
+      }
+
+      __riscv_vse16_v_f16m4(pState + ch, v_d1, l);
+      __riscv_vse16_v_f16m4(pState + numChans + ch, v_d2, l);
+      ch += l;
+    }
+#else
+    for (ch = 0U; ch < numChans; ch++)
+    {
+      /* The d1 state of all the channels is stored first, then the d2 state */
+      d1 = pState[ch];
+      d2 = pState[numChans + ch];
+
+      px = pIn + ch * chanStride;
+      pOut = pDst + ch * chanStride;
+      sample = blockSize;
+      while (sample > 0U)
+      {
+        Xn1 = *px;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1 = (b0 * Xn1) + d1;
+        *pOut = acc1;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn1) + (a2 * acc1);
+
+        px += sampleStride;
+        pOut += sampleStride;
+        sample--;
+      }
+
+      pState[ch] = d1;
+      pState[numChans + ch] = d2;
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+    pState += 2U * numChans;
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
+
+#endif /* #if defined(RISCV_FLOAT16_SUPPORTED) */
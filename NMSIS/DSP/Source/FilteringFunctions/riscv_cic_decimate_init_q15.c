@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cic_decimate_init_q15.c
+ * Description:  Initialization function for the Q15 cascaded integrator-comb decimator
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CIC_decimate
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 CIC decimator.
+  @param[in,out] S          points to an instance of the Q15 CIC decimator structure
+  @param[in]     numStages  number of integrator and comb stages
+  @param[in]     M          decimation factor
+  @param[in]     pState     points to the state buffer of <code>2*numStages</code> values
+  @param[in]     blockSize  number of input samples to process per call
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>numStages</code> is 0, <code>M</code> is less than 2 or
+                                                      the gain <code>M^numStages</code> is larger than <code>2^48</code>
+                   - \ref RISCV_MATH_LENGTH_ERROR   : <code>blockSize</code> is not a multiple of <code>M</code>
+
+  @par           Details
+                   The state buffer holds the integrators followed by the comb delays.
+                   The gain bound keeps the 64-bit registers large enough for Q15 inputs,
+                   for example 8 stages for <code>M = 64</code>.
+ */
+riscv_status riscv_cic_decimate_init_q15(
+        riscv_cic_decimate_instance_q15 * S,
+        uint8_t numStages,
+        uint16_t M,
+        q63_t * pState,
+        uint32_t blockSize)
+{
+  uint64_t gain = 1U;
+  uint32_t gainBits = 0U;
+  uint32_t k;
+
+  if ((numStages == 0U) || (M < 2U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Number of bits of the gain M^numStages, rounded up */
+  for (k = 0U; k < numStages; k++)
+  {
+    gain *= M;
+    if (gain > ((uint64_t) 1U << 48))
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+  }
+  while (((uint64_t) 1U << gainBits) < gain)
+  {
+    gainBits++;
+  }
+
+  /* The size of the input block must be a multiple of the decimation factor */
+  if ((blockSize % M) != 0U)
+  {
+    return RISCV_MATH_LENGTH_ERROR;
+  }
+
+  S->numStages = numStages;
+  S->postShift = (uint8_t) gainBits;
+  S->M = M;
+  S->pState = pState;
+
+  /* Clear the integrators and comb delays */
+  memset(pState, 0, 2U * numStages * sizeof(q63_t));
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of CIC_decimate group
+ */
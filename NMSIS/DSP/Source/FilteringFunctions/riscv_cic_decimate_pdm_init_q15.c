@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cic_decimate_pdm_init_q15.c
+ * Description:  Initialization function for the PDM cascaded integrator-comb decimator
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CIC_decimate
+  @{
+ */
+
+/**
+  @brief         Initialization function for the CIC decimator of bit-packed PDM streams.
+  @param[in,out] S          points to an instance of the PDM CIC decimator structure
+  @param[in]     numStages  number of integrator and comb stages
+  @param[in]     M          decimation factor, a multiple of 8
+  @param[in]     pState     points to the state buffer of <code>RISCV_CIC_DECIMATE_PDM_STATE_SIZE(numStages)</code> values
+  @param[in]     blockSize  number of input bits to process per call
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>numStages</code> is 0, <code>M</code> is not a multiple of 8 or
+                                                      the gain <code>M^numStages</code> is larger than <code>2^31</code>
+                   - \ref RISCV_MATH_LENGTH_ERROR   : <code>blockSize</code> is not a multiple of <code>M</code>
+
+  @par           Details
+                   The state buffer holds the integrators, the comb delays, the binomial
+                   coefficients and the byte table used to advance the integrators. The gain
+                   bound keeps the 32-bit registers large enough for the +1/-1 input, for
+                   example 5 stages for <code>M = 64</code>.
+ */
+riscv_status riscv_cic_decimate_pdm_init_q15(
+        riscv_cic_decimate_pdm_instance_q15 * S,
+        uint8_t numStages,
+        uint16_t M,
+        q31_t * pState,
+        uint32_t blockSize)
+{
+  uint32_t *pBinom, *pTable, *pT;
+  uint64_t gain = 1U;
+  uint32_t gainBits = 0U;
+  uint32_t b, d, i, k;
+  uint32_t acc;
+
+  if ((numStages == 0U) || (M == 0U) || ((M & 7U) != 0U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Number of bits of the gain M^numStages, rounded up */
+  for (k = 0U; k < numStages; k++)
+  {
+    gain *= M;
+    if (gain > ((uint64_t) 1U << 31))
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+  }
+  while (((uint64_t) 1U << gainBits) < gain)
+  {
+    gainBits++;
+  }
+
+  /* The size of the input block must be a multiple of the decimation factor */
+  if ((blockSize % M) != 0U)
+  {
+    return RISCV_MATH_LENGTH_ERROR;
+  }
+
+  S->numStages = numStages;
+  S->postShift = (int8_t) ((int32_t) gainBits - 15);
+  S->M = M;
+  S->pState = pState;
+
+  /* Clear the integrators and comb delays */
+  memset(pState, 0, 2U * numStages * sizeof(q31_t));
+
+  /* Binomial coefficients C(7 + d, d) of 8 integration steps */
+  pBinom = (uint32_t *) pState + 2U * numStages;
+  pBinom[0] = 1U;
+  for (d = 1U; d < numStages; d++)
+  {
+    pBinom[d] = pBinom[d - 1U] * (7U + d) / d;
+  }
+
+  /* Response of the integrators, starting from zero, to each byte of input */
+  pTable = pBinom + numStages;
+  for (b = 0U; b < 256U; b++)
+  {
+    pT = pTable + b * numStages;
+    memset(pT, 0, numStages * sizeof(uint32_t));
+    for (i = 0U; i < 8U; i++)
+    {
+      acc = ((b >> (7U - i)) & 1U) ? 1U : (uint32_t) -1;
+      for (k = 0U; k < numStages; k++)
+      {
+        acc += pT[k];
+        pT[k] = acc;
+      }
+    }
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of CIC_decimate group
+ */
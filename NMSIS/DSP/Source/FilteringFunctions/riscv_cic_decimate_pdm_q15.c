@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cic_decimate_pdm_q15.c
+ * Description:  Cascaded integrator-comb decimator of bit-packed PDM streams
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CIC_decimate
+  @{
+ */
+
+/**
+  @brief         Processing function for the CIC decimator of bit-packed PDM streams.
+  @param[in,out] S          points to an instance of the PDM CIC decimator structure
+  @param[in]     pSrc       points to the block of packed input bits
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input bits to process, a multiple of <code>S->M</code>
+  @return        none
+
+  @par           Input format
+                   Each byte holds 8 consecutive PDM samples, the first one in the most
+                   significant bit. A bit set to 1 is the sample +1 and a bit set to 0 is
+                   the sample -1.
+
+  @par           Algorithm
+                   The integrators are advanced by a whole byte at a time. Without input, 8 steps
+                   of the integrator cascade are a linear map of the registers with binomial
+                   coefficients:
+  <pre>
+      I_k' = sum_{j <= k} C(7 + k - j, k - j) * I_j
+  </pre>
+                   and the contribution of the 8 input bits is read from a table of
+                   <code>256*numStages</code> values built by the initialization function. This costs
+                   <code>numStages*(numStages+1)/2</code> multiply-accumulates per byte instead of
+                   <code>8*numStages</code> additions and bit extractions.
+
+  @par           Scaling and Overflow Behavior
+                   The integrators and combs use 32-bit registers with wrap around arithmetic.
+                   A full scale input, all bits set, gives the Q15 value 1.0, saturated to
+                   <code>0x7FFF</code>.
+ */
+void riscv_cic_decimate_pdm_q15(
+        riscv_cic_decimate_pdm_instance_q15 * S,
+  const uint8_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t numStages = S->numStages;
+        uint32_t *pInteg = (uint32_t *) S->pState;        /* Integrator registers */
+        uint32_t *pComb = pInteg + numStages;             /* Comb delay registers */
+  const uint32_t *pBinom = pComb + numStages;             /* C(7 + d, d) */
+  const uint32_t *pTable = pBinom + numStages;            /* Contribution of each byte */
+  const uint32_t *pT;
+        uint32_t byteCnt = S->M >> 3U;
+        uint32_t blkCnt, i, j, k;
+        uint32_t acc, prev;
+        int32_t out;
+
+  blkCnt = blockSize / S->M;
+
+  while (blkCnt > 0U)
+  {
+    /* Integrators, 8 input samples at a time */
+    for (i = 0U; i < byteCnt; i++)
+    {
+      pT = pTable + (uint32_t) (*pSrc++) * numStages;
+      /* Last stage first, so that the lower stages still hold their previous values */
+      for (k = numStages; k > 0U; k--)
+      {
+        acc = pT[k - 1U];
+        for (j = 0U; j < k; j++)
+        {
+          acc += pBinom[k - 1U - j] * pInteg[j];
+        }
+        pInteg[k - 1U] = acc;
+      }
+    }
+
+    /* Combs at the output rate */
+    acc = pInteg[numStages - 1U];
+    for (k = 0U; k < numStages; k++)
+    {
+      prev = pComb[k];
+      pComb[k] = acc;
+      acc -= prev;
+    }
+
+    out = (int32_t) acc;
+    if (S->postShift >= 0)
+    {
+      out >>= S->postShift;
+    }
+    else
+    {
+      out = (int32_t) ((uint32_t) out << -S->postShift);
+    }
+    *pDst++ = (q15_t) __SSAT(out, 16);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of CIC_decimate group
+ */
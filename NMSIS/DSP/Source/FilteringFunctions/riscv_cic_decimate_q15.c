@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cic_decimate_q15.c
+ * Description:  Q15 cascaded integrator-comb decimator
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup CIC_decimate Cascaded Integrator-Comb (CIC) Decimator
+
+  These functions implement a cascaded integrator-comb decimator, the multiplier-less
+  filter used for the first stages of high ratio sample rate reductions, for example
+  to bring a 1-bit PDM or sigma-delta microphone stream down to audio rates.
+  The filter is equivalent to <code>numStages</code> moving averages of length
+  <code>M</code> followed by a decimation by <code>M</code>:
+  <pre>
+      H(z) = ((1 - z^-M) / (1 - z^-1))^numStages
+  </pre>
+                   The integrators run at the input rate and the combs, with a differential delay of 1,
+                   run at the output rate, so the cost per input sample is <code>numStages</code> additions
+                   whatever the decimation factor.
+                   <code>pSrc</code> points to an array of <code>blockSize</code> input values and
+                   <code>pDst</code> points to an array of <code>blockSize/M</code> output values.
+                   <code>blockSize</code> must be a multiple of the decimation factor <code>M</code>.
+
+  @par           Chaining with the FIR decimator
+                   The CIC response droops in the passband and only attenuates the bands folded
+                   onto the baseband. The usual chain decimates by most of the ratio with the CIC,
+                   then by 2 with \ref riscv_fir_halfband_decimate_q15 and ends with a short
+                   \ref riscv_fir_decimate_q15 that compensates the droop and sets the final
+                   bandwidth. For a PDM stream decimated by 64:
+  <pre>
+      PDM bits --> riscv_cic_decimate_pdm_q15 (M = 16) --> riscv_fir_halfband_decimate_q15
+               --> riscv_fir_decimate_q15 (M = 2, droop compensation) --> audio
+  </pre>
+                   The outputs are Q15 values, so the output buffer of a stage is the input
+                   buffer of the next one.
+
+  @par           Gain and register width
+                   The DC gain of the filter is <code>M^numStages</code>. The integrators wrap around
+                   and the final comb output is exact as long as the registers hold
+                   <code>inputBits + ceil(numStages*log2(M))</code> bits. The Q15 decimator uses 64-bit
+                   registers and the PDM decimator 32-bit registers. The output is divided by
+                   <code>2^ceil(numStages*log2(M))</code>, so the gain is 1 when <code>M</code> is a
+                   power of 2 and slightly less than 1 otherwise.
+
+  @par           Instance Structure
+                   The parameters and state variables of a decimator are stored in an instance
+                   data structure. A separate instance structure must be defined for each decimator.
+
+  @par           Initialization Functions
+                   The initialization functions check the parameters, compute the output scaling
+                   and zero out the state buffer.
+ */
+
+/**
+  @addtogroup CIC_decimate
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 CIC decimator.
+  @param[in,out] S          points to an instance of the Q15 CIC decimator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, a multiple of <code>S->M</code>
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The integrators and combs use 64-bit registers with wrap around arithmetic.
+                   The comb output is shifted right by <code>S->postShift</code> bits, truncated and
+                   saturated to the 1.15 format.
+ */
+void riscv_cic_decimate_q15(
+        riscv_cic_decimate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  uint64_t *pInteg = (uint64_t *) S->pState;              /* Integrator registers */
+  uint64_t *pComb = pInteg + S->numStages;                /* Comb delay registers */
+  uint32_t numStages = S->numStages;
+  uint32_t M = S->M;
+  uint32_t blkCnt, i, k;
+  uint64_t acc, prev;
+
+  blkCnt = blockSize / M;
+
+  while (blkCnt > 0U)
+  {
+    /* Integrators at the input rate */
+    for (i = 0U; i < M; i++)
+    {
+      acc = (uint64_t) (int64_t) *pSrc++;
+      for (k = 0U; k < numStages; k++)
+      {
+        acc += pInteg[k];
+        pInteg[k] = acc;
+      }
+    }
+
+    /* Combs at the output rate */
+    acc = pInteg[numStages - 1U];
+    for (k = 0U; k < numStages; k++)
+    {
+      prev = pComb[k];
+      pComb[k] = acc;
+      acc -= prev;
+    }
+
+    *pDst++ = (q15_t) __SSAT((q31_t) ((int64_t) acc >> S->postShift), 16);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of CIC_decimate group
+ */
@@ -0,0 +1,245 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_conv_fft_f32.c
+ * Description:  FFT based convolution of floating-point sequences
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/support_functions.h"
+
+/*
+ * Cost of one overlap-add block (forward RFFT, spectrum product and inverse RFFT)
+ * in multiply-accumulates of the direct form, for fftLen = 32 .. 4096. Measured as
+ * the time of riscv_conv_fft_f32 per block over the time of riscv_conv_f32 per
+ * multiply-accumulate, with the scalar functions.
+ */
+static const uint32_t riscv_conv_fft_crossover_f32[8] = {
+  115U, 250U, 510U, 1180U, 2490U, 4830U, 10990U, 23300U
+};
+
+/*
+ * Copies n samples to pDst, reading pSrc backwards when reverse is set,
+ * and zero pads the buffer up to fftLen samples.
+ */
+static void riscv_conv_fft_load_f32(
+  const float32_t * pSrc,
+        uint32_t n,
+        uint8_t reverse,
+        float32_t * pDst,
+        uint32_t fftLen)
+{
+  if (reverse == 0U)
+  {
+    riscv_copy_f32(pSrc, pDst, n);
+  }
+  else
+  {
+#if defined (RISCV_MATH_VECTOR)
+    uint32_t blkCnt = n;
+    float32_t *pOut = pDst;
+    size_t l;
+
+    for (; (l = __riscv_vsetvl_e32m8(blkCnt)) > 0; blkCnt -= l)
+    {
+      __riscv_vse32_v_f32m8(pOut, __riscv_vlse32_v_f32m8(pSrc, -(ptrdiff_t) sizeof(float32_t), l), l);
+      pSrc -= l;
+      pOut += l;
+    }
+#else
+    uint32_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+      pDst[i] = *pSrc--;
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+  }
+  riscv_fill_f32(0.0f, pDst + n, fftLen - n);
+}
+
+/*
+ * Returns 1 when the overlap-add FFT convolution of sigLen samples with a
+ * kernel of kerLen samples is expected to be faster than the direct form.
+ */
+uint32_t riscv_conv_fft_select_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+        uint32_t sigLen,
+        uint32_t kerLen)
+{
+  uint32_t fftLen, step, nbBlocks, k;
+
+  if ((S == NULL) || (2U * kerLen > S->fftLenRFFT))
+  {
+    return 0U;
+  }
+
+  fftLen = S->fftLenRFFT;
+  step = fftLen - kerLen + 1U;
+  nbBlocks = (sigLen + step - 1U) / step;
+  for (k = 0U; (32U << k) < fftLen; k++);
+
+  return ((uint64_t) (nbBlocks + 1U) * riscv_conv_fft_crossover_f32[k] <
+          (uint64_t) sigLen * kerLen) ? 1U : 0U;
+}
+
+/*
+ * Overlap-add convolution of a signal with a kernel of at most fftLen/2 samples.
+ * Either sequence is time reversed when its reverse flag is set, in which case
+ * its pointer addresses its last sample. The samples [firstIndex, firstIndex + numPoints)
+ * of the result are written to pDst[0 .. numPoints - 1].
+ * pScratch holds 3 * fftLen values: kernel spectrum, time block and block spectrum.
+ */
+void riscv_conv_fft_core_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSig,
+        uint32_t sigLen,
+        uint8_t sigReverse,
+  const float32_t * pKer,
+        uint32_t kerLen,
+        uint8_t kerReverse,
+        uint32_t firstIndex,
+        uint32_t numPoints,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  uint32_t fftLen = S->fftLenRFFT;
+  uint32_t step = fftLen - kerLen + 1U;          /* Signal samples per block */
+  uint32_t lastIndex = firstIndex + numPoints;
+  uint32_t pos, blkLen, start, end;
+  float32_t *pKerSpec = pScratch;
+  float32_t *pBlock = pScratch + fftLen;
+  float32_t *pSpec = pScratch + 2U * fftLen;
+
+  riscv_fill_f32(0.0f, pDst, numPoints);
+
+  /* Kernel spectrum, computed once */
+  riscv_conv_fft_load_f32(pKer, kerLen, kerReverse, pBlock, fftLen);
+  riscv_rfft_fast_f32(S, pBlock, pKerSpec, 0);
+
+  for (pos = 0U; (pos < sigLen) && (pos < lastIndex); pos += step)
+  {
+    blkLen = MIN(step, sigLen - pos);
+
+    /* Skip the blocks which do not contribute to the requested samples */
+    if ((pos + blkLen + kerLen - 1U) <= firstIndex)
+    {
+      continue;
+    }
+
+    riscv_conv_fft_load_f32(sigReverse ? (pSig - pos) : (pSig + pos), blkLen, sigReverse, pBlock, fftLen);
+    riscv_rfft_fast_f32(S, pBlock, pSpec, 0);
+
+    /* Product of the packed spectra: DC and Nyquist terms are real */
+    pSpec[0] *= pKerSpec[0];
+    pSpec[1] *= pKerSpec[1];
+    riscv_cmplx_mult_cmplx_f32(pSpec + 2, pKerSpec + 2, pSpec + 2, (fftLen >> 1U) - 1U);
+
+    riscv_rfft_fast_f32(S, pSpec, pBlock, 1);
+
+    /* Overlap-add of the block result, clipped to the requested samples */
+    start = MAX(pos, firstIndex);
+    end = MIN(pos + blkLen + kerLen - 1U, lastIndex);
+    riscv_add_f32(pDst + (start - firstIndex), pBlock + (start - pos),
+                  pDst + (start - firstIndex), end - start);
+  }
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Conv
+  @{
+ */
+
+/**
+  @brief         FFT based convolution of floating-point sequences.
+  @param[in]     S         points to an instance of the floating-point RFFT structure
+  @param[in]     pSrcA     points to the first input sequence
+  @param[in]     srcALen   length of the first input sequence
+  @param[in]     pSrcB     points to the second input sequence
+  @param[in]     srcBLen   length of the second input sequence
+  @param[out]    pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+  @param[in]     pScratch  points to scratch buffer of size <code>RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT)</code>
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : the shorter sequence is longer than half the FFT length
+
+  @par           Algorithm
+                   The shorter sequence is used as kernel and its spectrum is computed once.
+                   The longer sequence is split in blocks of <code>fftLen - kernelLen + 1</code>
+                   samples which are convolved with the kernel using \ref riscv_rfft_fast_f32
+                   and overlap-added to the output. The cost grows as
+                   <code>(srcALen + srcBLen) * log2(fftLen)</code> instead of
+                   <code>srcALen * srcBLen</code> for \ref riscv_conv_f32.
+  @par
+                   The RFFT instance can be initialized with \ref riscv_rfft_fast_init_f32
+                   or \ref riscv_rfft_fast_init_dynamic_f32. Its length must be at least
+                   twice the length of the shorter sequence. Longer transforms need fewer
+                   blocks: the smallest power of 2 larger than <code>srcALen + srcBLen - 1</code>
+                   computes the result with a single block.
+  @par
+                   Results differ from \ref riscv_conv_f32 by the rounding errors of the FFT.
+ */
+riscv_status riscv_conv_fft_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  const float32_t *pSig = pSrcA;                 /* Longer sequence */
+  const float32_t *pKer = pSrcB;                 /* Shorter sequence, used as kernel */
+        uint32_t sigLen = srcALen;
+        uint32_t kerLen = srcBLen;
+
+  if (srcALen < srcBLen)
+  {
+    pSig = pSrcB;
+    pKer = pSrcA;
+    sigLen = srcBLen;
+    kerLen = srcALen;
+  }
+
+  if ((kerLen == 0U) || (2U * kerLen > S->fftLenRFFT))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  riscv_conv_fft_core_f32(S, pSig, sigLen, 0U, pKer, kerLen, 0U,
+                          0U, sigLen + kerLen - 1U, pDst, pScratch);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of Conv group
+ */
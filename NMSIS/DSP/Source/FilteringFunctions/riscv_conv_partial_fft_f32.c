@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_conv_partial_fft_f32.c
+ * Description:  FFT based partial convolution of floating-point sequences
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void riscv_conv_fft_core_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSig,
+        uint32_t sigLen,
+        uint8_t sigReverse,
+  const float32_t * pKer,
+        uint32_t kerLen,
+        uint8_t kerReverse,
+        uint32_t firstIndex,
+        uint32_t numPoints,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup PartialConv
+  @{
+ */
+
+/**
+  @brief         FFT based partial convolution of floating-point sequences.
+  @param[in]     S           points to an instance of the floating-point RFFT structure
+  @param[in]     pSrcA       points to the first input sequence
+  @param[in]     srcALen     length of the first input sequence
+  @param[in]     pSrcB       points to the second input sequence
+  @param[in]     srcBLen     length of the second input sequence
+  @param[out]    pDst        points to the location where the output result is written
+  @param[in]     firstIndex  is the first output sample to start with
+  @param[in]     numPoints   is the number of output points to be computed
+  @param[in]     pScratch    points to scratch buffer of size <code>RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT)</code>
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : requested subset is not in the range [0 srcALen+srcBLen-2]
+                                                      or the shorter sequence is longer than half the FFT length
+
+  @par           Description
+                   The output is written to <code>pDst[firstIndex .. firstIndex+numPoints-1]</code>
+                   as with \ref riscv_conv_partial_f32. Only the blocks of \ref riscv_conv_fft_f32
+                   contributing to the requested samples are computed.
+ */
+riscv_status riscv_conv_partial_fft_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        uint32_t firstIndex,
+        uint32_t numPoints,
+        float32_t * pScratch)
+{
+  const float32_t *pSig = pSrcA;                 /* Longer sequence */
+  const float32_t *pKer = pSrcB;                 /* Shorter sequence, used as kernel */
+        uint32_t sigLen = srcALen;
+        uint32_t kerLen = srcBLen;
+
+  if (srcALen < srcBLen)
+  {
+    pSig = pSrcB;
+    pKer = pSrcA;
+    sigLen = srcBLen;
+    kerLen = srcALen;
+  }
+
+  if ((kerLen == 0U) || (2U * kerLen > S->fftLenRFFT) ||
+      ((firstIndex + numPoints) > (sigLen + (kerLen - 1U))))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  riscv_conv_fft_core_f32(S, pSig, sigLen, 0U, pKer, kerLen, 0U,
+                          firstIndex, numPoints, pDst + firstIndex, pScratch);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of PartialConv group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_correlate_auto_f32.c
+ * Description:  Direct or FFT based correlation of floating-point sequences
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+uint32_t riscv_conv_fft_select_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+        uint32_t sigLen,
+        uint32_t kerLen);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Corr
+  @{
+ */
+
+/**
+  @brief         Correlation of floating-point sequences with the fastest algorithm.
+  @param[in]     S         points to an instance of the floating-point RFFT structure, or NULL
+  @param[in]     pSrcA     points to the first input sequence
+  @param[in]     srcALen   length of the first input sequence
+  @param[in]     pSrcB     points to the second input sequence
+  @param[in]     srcBLen   length of the second input sequence
+  @param[out]    pDst      points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+  @param[in]     pScratch  points to scratch buffer of size <code>RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT)</code>
+  @return        none
+
+  @par           Description
+                   Selects between \ref riscv_correlate_f32 and \ref riscv_correlate_fft_f32. The FFT is used
+                   when the shorter sequence fits in half of the RFFT length and the estimated
+                   cost of the overlap-add blocks, taken from a crossover table indexed by the
+                   RFFT length, is lower than the <code>srcALen * srcBLen</code> multiply-accumulates
+                   of the direct form. For short kernels the direct form is kept.
+  @par
+                   With <code>S</code> or <code>pScratch</code> set to NULL the direct form is
+                   always used.
+  @note
+                   When the direct form is selected, <code>pDst</code> should be initialized
+                   to all zeros as for \ref riscv_correlate_f32.
+ */
+void riscv_correlate_auto_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  if ((pScratch != NULL) &&
+      riscv_conv_fft_select_f32(S, MAX(srcALen, srcBLen), MIN(srcALen, srcBLen)))
+  {
+    (void) riscv_correlate_fft_f32(S, pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch);
+  }
+  else
+  {
+    riscv_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+  }
+}
+
+/**
+  @} end of Corr group
+ */
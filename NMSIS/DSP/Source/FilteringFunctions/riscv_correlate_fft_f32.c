@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_correlate_fft_f32.c
+ * Description:  FFT based correlation of floating-point sequences
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void riscv_conv_fft_core_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSig,
+        uint32_t sigLen,
+        uint8_t sigReverse,
+  const float32_t * pKer,
+        uint32_t kerLen,
+        uint8_t kerReverse,
+        uint32_t firstIndex,
+        uint32_t numPoints,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Corr
+  @{
+ */
+
+/**
+  @brief         FFT based correlation of floating-point sequences.
+  @param[in]     S         points to an instance of the floating-point RFFT structure
+  @param[in]     pSrcA     points to the first input sequence
+  @param[in]     srcALen   length of the first input sequence
+  @param[in]     pSrcB     points to the second input sequence
+  @param[in]     srcBLen   length of the second input sequence
+  @param[out]    pDst      points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+  @param[in]     pScratch  points to scratch buffer of size <code>RISCV_CONV_FFT_SCRATCH_SIZE_F32(S->fftLenRFFT)</code>
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : the shorter sequence is longer than half the FFT length
+
+  @par           Description
+                   The output has the same layout as \ref riscv_correlate_f32: the correlation is
+                   computed as the convolution of <code>pSrcA</code> with the time reversed
+                   <code>pSrcB</code> with the overlap-add algorithm of \ref riscv_conv_fft_f32.
+                   The zero padded samples of the output are written by this function, so
+                   <code>pDst</code> does not need to be initialized.
+ */
+riscv_status riscv_correlate_fft_f32(
+  const riscv_rfft_fast_instance_f32 * S,
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  uint32_t kerLen = MIN(srcALen, srcBLen);
+  uint32_t outLen = srcALen + srcBLen - 1U;
+
+  if ((kerLen == 0U) || (2U * kerLen > S->fftLenRFFT))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  if (srcALen >= srcBLen)
+  {
+    /* Leading zeros of the output, srcB is zero padded to srcALen */
+    riscv_fill_f32(0.0f, pDst, srcALen - srcBLen);
+    riscv_conv_fft_core_f32(S, pSrcA, srcALen, 0U, pSrcB + (srcBLen - 1U), srcBLen, 1U,
+                            0U, outLen, pDst + (srcALen - srcBLen), pScratch);
+  }
+  else
+  {
+    /* CORR(x, y) = Reverse order(CORR(y, x)), followed by the zero padding */
+    riscv_conv_fft_core_f32(S, pSrcB + (srcBLen - 1U), srcBLen, 1U, pSrcA, srcALen, 0U,
+                            0U, outLen, pDst, pScratch);
+    riscv_fill_f32(0.0f, pDst + outLen, srcBLen - srcALen);
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of Corr group
+ */
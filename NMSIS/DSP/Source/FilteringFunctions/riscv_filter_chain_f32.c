@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_filter_chain_f32.c
+ * Description:  Chain of floating-point filters processed by tiles
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FilterChain Filter Chain
+
+  Runs several filters one after the other without a full block buffer
+  between each of them.
+
+  Each stage of the chain is a filter instance with its processing function,
+  for example \ref riscv_biquad_cascade_df1_f32 for an equalizer or a DC removal,
+  \ref riscv_fir_decimate_f32 or \ref riscv_fir_interpolate_f32 for a rate change,
+  or a function of the application such as an automatic gain control. A stage
+  receiving <code>blockSize</code> samples produces <code>blockSize * L / M</code> samples.
+
+  @par           Algorithm
+                   The input block is split into tiles of <code>tileSize</code> samples and each
+                   tile runs through all the stages before the next one. The first stage reads the
+                   input buffer and the last stage writes the output buffer directly. The blocks
+                   between the stages are written to two intermediate buffers used in turn, sized
+                   for the largest intermediate block of a tile. Choosing a tile that keeps these
+                   buffers in the L1 cache or in a local memory avoids writing the whole block
+                   to the main memory between two stages.
+
+  @par           Cycle Accounting
+                   When the instance is initialized with a cycle counter function, the counter is
+                   read before and after each stage and the difference is added to the
+                   <code>cycles</code> field of the stage. With NULL the accounting is disabled.
+                   The function is provided by the application because the counter that can be
+                   read depends on the privilege mode: <code>mcycle</code> traps outside of machine
+                   mode, where for example <code>__get_rv_cycle()</code> can be used.
+
+  @par           Initialization Functions
+                   The stages are described by an array of stage structures. A library processing
+                   function takes a pointer to its own instance type, so it must not be cast to the
+                   stage function type and called through it: calling a function through a pointer
+                   of an incompatible type is undefined behavior and is rejected by control flow
+                   integrity checks. Each stage is given a small wrapper instead, for example:
+  <pre>
+      static void biquad_stage(const void *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+      {
+          riscv_biquad_cascade_df1_f32((const riscv_biquad_casd_df1_inst_f32 *) S, pSrc, pDst, blockSize);
+      }
+
+      static void decimate_stage(const void *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+      {
+          riscv_fir_decimate_f32((const riscv_fir_decimate_instance_f32 *) S, pSrc, pDst, blockSize);
+      }
+
+      riscv_filter_chain_stage_f32 stages[2] = {
+          {biquad_stage, &biquad, 1, 1, 0},
+          {decimate_stage, &decimator, 1, 4, 0}
+      };
+  </pre>
+                   The initialization function checks that every stage processes a whole number of
+                   samples for a tile, computes the size of the intermediate buffers and resets
+                   the cycle counts. The instance of a stage must accept the number of samples
+                   it receives for a tile, for example a decimator must be initialized with a
+                   block size at least as large.
+ */
+
+/**
+  @addtogroup FilterChain
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point filter chain.
+  @param[in,out] S          points to an instance of the floating-point filter chain structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        none
+
+  @par           Details
+                   When <code>blockSize</code> is not a multiple of <code>tileSize</code>, the last
+                   tile is shorter and each stage must still process a whole number of samples for it.
+ */
+void riscv_filter_chain_f32(
+        riscv_filter_chain_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        riscv_filter_chain_stage_f32 *pStage;          /* Current stage */
+        float32_t *pPing = S->pScratch;                 /* Output of the even stages */
+        float32_t *pPong = S->pScratch + S->pingSize;   /* Output of the odd stages */
+  const float32_t *pIn;                                 /* Input of the current stage */
+        float32_t *pOut;                                /* Output of the current stage */
+        uint32_t tileSize;                             /* Number of input samples of the tile */
+        uint32_t numSamples;                           /* Number of samples between two stages */
+        uint64_t start;
+        uint16_t i;
+
+  while (blockSize > 0U)
+  {
+    tileSize = MIN(blockSize, S->tileSize);
+
+    pIn = pSrc;
+    numSamples = tileSize;
+    for (i = 0U; i < S->numStages; i++)
+    {
+      pStage = &S->pStages[i];
+
+      /* The last stage writes to the destination, the other ones to the intermediate buffers in turn */
+      if (i == S->numStages - 1U)
+      {
+        pOut = pDst;
+      }
+      else if ((i & 1U) != 0U)
+      {
+        pOut = pPong;
+      }
+      else
+      {
+        pOut = pPing;
+      }
+
+      if (S->pReadCycle != NULL)
+      {
+        start = S->pReadCycle();
+        pStage->pProcess(pStage->pInstance, pIn, pOut, numSamples);
+        pStage->cycles += S->pReadCycle() - start;
+      }
+      else
+      {
+        pStage->pProcess(pStage->pInstance, pIn, pOut, numSamples);
+      }
+
+      numSamples = numSamples * pStage->L / pStage->M;
+      pIn = pOut;
+    }
+
+    pSrc += tileSize;
+    pDst += numSamples;
+    blockSize -= tileSize;
+  }
+}
+
+/**
+  @} end of FilterChain group
+ */
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_filter_chain_init_q31.c
+ * Description:  Q31 filter chain initialization function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FilterChain
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 filter chain.
+  @param[in,out] S            points to an instance of the Q31 filter chain structure
+  @param[in]     pStages      points to the array of stages
+  @param[in]     numStages    number of stages
+  @param[in]     tileSize     number of input samples run through all the stages at once
+  @param[in]     pScratch     points to the buffer receiving the intermediate blocks, may be NULL for a single stage
+  @param[in]     scratchSize  length of the scratch buffer
+  @param[in]     pReadCycle   returns the cycle counter read before and after each stage, NULL disables the accounting
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : a stage has no processing function or a zero factor
+                   - \ref RISCV_MATH_LENGTH_ERROR   : a stage would process a fractional number of samples
+                                                      for a tile, or the scratch buffer is too small
+
+  @par           Details
+                   The outputs of the stages 0, 2, 4, ... are written to the first intermediate
+                   buffer and the outputs of the stages 1, 3, 5, ... to the second one. The scratch
+                   buffer must hold the largest block of both, which is at most twice the largest
+                   intermediate block of a tile.
+ */
+riscv_status riscv_filter_chain_init_q31(
+        riscv_filter_chain_instance_q31 * S,
+        riscv_filter_chain_stage_q31 * pStages,
+        uint16_t numStages,
+        uint32_t tileSize,
+        q31_t * pScratch,
+        uint32_t scratchSize,
+        uint64_t (*pReadCycle)(void))
+{
+  uint32_t numSamples, pingSize, pongSize;
+  uint16_t i;
+
+  if ((numStages == 0U) || (tileSize == 0U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Size of the block written by each stage for a tile */
+  numSamples = tileSize;
+  pingSize = 0U;
+  pongSize = 0U;
+  for (i = 0U; i < numStages; i++)
+  {
+    if ((pStages[i].pProcess == NULL) || (pStages[i].L == 0U) || (pStages[i].M == 0U))
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+
+    if (((numSamples * pStages[i].L) % pStages[i].M) != 0U)
+    {
+      return RISCV_MATH_LENGTH_ERROR;
+    }
+    numSamples = numSamples * pStages[i].L / pStages[i].M;
+
+    if (i < numStages - 1U)
+    {
+      if ((i & 1U) != 0U)
+      {
+        pongSize = MAX(pongSize, numSamples);
+      }
+      else
+      {
+        pingSize = MAX(pingSize, numSamples);
+      }
+    }
+    pStages[i].cycles = 0U;
+  }
+
+  if ((pingSize + pongSize > 0U) && ((pScratch == NULL) || (scratchSize < pingSize + pongSize)))
+  {
+    return RISCV_MATH_LENGTH_ERROR;
+  }
+
+  S->numStages = numStages;
+  S->tileSize = tileSize;
+  S->pingSize = pingSize;
+  S->pStages = pStages;
+  S->pScratch = pScratch;
+  S->pReadCycle = pReadCycle;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of FilterChain group
+ */
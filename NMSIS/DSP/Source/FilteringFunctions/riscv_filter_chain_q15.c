@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_filter_chain_q15.c
+ * Description:  Chain of Q15 filters processed by tiles
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FilterChain
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 filter chain.
+  @param[in,out] S          points to an instance of the Q15 filter chain structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        none
+
+  @par           Details
+                   When <code>blockSize</code> is not a multiple of <code>tileSize</code>, the last
+                   tile is shorter and each stage must still process a whole number of samples for it.
+ */
+void riscv_filter_chain_q15(
+        riscv_filter_chain_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        riscv_filter_chain_stage_q15 *pStage;          /* Current stage */
+        q15_t *pPing = S->pScratch;                 /* Output of the even stages */
+        q15_t *pPong = S->pScratch + S->pingSize;   /* Output of the odd stages */
+  const q15_t *pIn;                                 /* Input of the current stage */
+        q15_t *pOut;                                /* Output of the current stage */
+        uint32_t tileSize;                             /* Number of input samples of the tile */
+        uint32_t numSamples;                           /* Number of samples between two stages */
+        uint64_t start;
+        uint16_t i;
+
+  while (blockSize > 0U)
+  {
+    tileSize = MIN(blockSize, S->tileSize);
+
+    pIn = pSrc;
+    numSamples = tileSize;
+    for (i = 0U; i < S->numStages; i++)
+    {
+      pStage = &S->pStages[i];
+
+      /* The last stage writes to the destination, the other ones to the intermediate buffers in turn */
+      if (i == S->numStages - 1U)
+      {
+        pOut = pDst;
+      }
+      else if ((i & 1U) != 0U)
+      {
+        pOut = pPong;
+      }
+      else
+      {
+        pOut = pPing;
+      }
+
+      if (S->pReadCycle != NULL)
+      {
+        start = S->pReadCycle();
+        pStage->pProcess(pStage->pInstance, pIn, pOut, numSamples);
+        pStage->cycles += S->pReadCycle() - start;
+      }
+      else
+      {
+        pStage->pProcess(pStage->pInstance, pIn, pOut, numSamples);
+      }
+
+      numSamples = numSamples * pStage->L / pStage->M;
+      pIn = pOut;
+    }
+
+    pSrc += tileSize;
+    pDst += numSamples;
+    blockSize -= tileSize;
+  }
+}
+
+/**
+  @} end of FilterChain group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_circ_q31.c
+ * Description:  Q31 FIR filter with circular state
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 FIR filter with circular state.
+  @param[in,out] S          points to an instance of the Q31 circular state FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given at initialization
+  @return        none
+
+  @par           Details
+                   The output is the same as \ref riscv_fir_q31, but the state is a circular buffer
+                   of <code>stateLength=numTaps+blockSize-1</code> samples stored twice: each input
+                   sample is written at <code>stateIndex</code> and <code>stateIndex+stateLength</code>.
+                   The <code>numTaps+blockSize-1</code> samples used by a block are then always
+                   contiguous in the buffer and the <code>numTaps-1</code> samples of state are not
+                   moved at the end of the call, so the overhead per block does not depend on the
+                   number of taps. This helps with small blocks and long filters.
+
+  @par           Scaling and Overflow Behavior
+                   The function uses the same 64-bit accumulator and truncation to 1.31 format as \ref riscv_fir_q31.
+ */
+void riscv_fir_circ_q31(
+        riscv_fir_circ_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                 /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const q31_t *px;                                 /* Start of the samples used by the block */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t stateLen = S->stateLength;            /* Length of the circular state */
+        uint32_t stateIdx = S->stateIndex;             /* Write position in the circular state */
+        uint32_t i, j, blkCnt;                         /* Loop counters */
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  size_t l;
+  vint32m4_t vx;
+  vint64m8_t vres0m8;
+#else
+  const q31_t *pb, *pw;                               /* Temporary pointers for coefficient and state buffers */
+  q63_t acc0;
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* Write the new samples in both copies of the circular state, in two parts when the end of the buffer is reached */
+  blkCnt = MIN(blockSize, stateLen - stateIdx);
+  riscv_copy_q31(pSrc, pState + stateIdx, blkCnt);
+  riscv_copy_q31(pSrc, pState + stateIdx + stateLen, blkCnt);
+  if (blkCnt < blockSize)
+  {
+    riscv_copy_q31(pSrc + blkCnt, pState, blockSize - blkCnt);
+    riscv_copy_q31(pSrc + blkCnt, pState + stateLen, blockSize - blkCnt);
+  }
+
+  stateIdx += blockSize;
+  if (stateIdx >= stateLen)
+  {
+    stateIdx -= stateLen;
+  }
+  S->stateIndex = stateIdx;
+
+  /* The numTaps - 1 previous samples and the new block end just before stateIdx + stateLen */
+  px = pState + stateIdx + stateLen - (numTaps - 1U + blockSize);
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  for (i = blockSize; i > 0; i -= l)
+  {
+    l = __riscv_vsetvl_e32m4(i);
+    vx = __riscv_vle32_v_i32m4(px, l);
+    px += l;
+    vres0m8 = __riscv_vmv_v_x_i64m8(0, l);
+    for (j = 0; j < numTaps; j++) {
+      vres0m8 = __riscv_vwmacc_vx_i64m8(vres0m8, *(pCoeffs + j), vx, l);
+      vx = __riscv_vslide1down_vx_i32m4(vx, *(px + j), l);
+    }
+    __riscv_vse32_v_i32m4(pDst, __riscv_vnsra_wx_i32m4(vres0m8, 31, l), l);
+    pDst += l;
+  }
+#else
+  for (i = 0U; i < blockSize; i++)
+  {
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    pb = pCoeffs;
+    pw = px + i;
+    j = numTaps;
+
+    /* Perform the multiply-accumulates */
+    while (j > 0U)
+    {
+      acc0 += (q63_t) *pb++ * *pw++;
+
+      /* Decrement loop counter */
+      j--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = (q31_t) (acc0 >> 31);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_circ_q7.c
+ * Description:  Q7 FIR filter with circular state
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q7 FIR filter with circular state.
+  @param[in,out] S          points to an instance of the Q7 circular state FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given at initialization
+  @return        none
+
+  @par           Details
+                   The output is the same as \ref riscv_fir_q7, but the state is a circular buffer
+                   of <code>stateLength=numTaps+blockSize-1</code> samples stored twice: each input
+                   sample is written at <code>stateIndex</code> and <code>stateIndex+stateLength</code>.
+                   The <code>numTaps+blockSize-1</code> samples used by a block are then always
+                   contiguous in the buffer and the <code>numTaps-1</code> samples of state are not
+                   moved at the end of the call, so the overhead per block does not depend on the
+                   number of taps. This helps with small blocks and long filters.
+
+  @par           Scaling and Overflow Behavior
+                   The function uses the same 32-bit accumulator, truncation and saturation to 1.7 format as \ref riscv_fir_q7.
+ */
+void riscv_fir_circ_q7(
+        riscv_fir_circ_instance_q7 * S,
+  const q7_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize)
+{
+        q7_t *pState = S->pState;                 /* State pointer */
+  const q7_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const q7_t *px;                                 /* Start of the samples used by the block */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t stateLen = S->stateLength;            /* Length of the circular state */
+        uint32_t stateIdx = S->stateIndex;             /* Write position in the circular state */
+        uint32_t i, j, blkCnt;                         /* Loop counters */
+
+#if defined (RISCV_MATH_VECTOR)
+  size_t l;
+  vint8m2_t vx;
+  vint32m8_t vres0m8;
+#else
+  const q7_t *pb, *pw;                               /* Temporary pointers for coefficient and state buffers */
+  q31_t acc0;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Write the new samples in both copies of the circular state, in two parts when the end of the buffer is reached */
+  blkCnt = MIN(blockSize, stateLen - stateIdx);
+  riscv_copy_q7(pSrc, pState + stateIdx, blkCnt);
+  riscv_copy_q7(pSrc, pState + stateIdx + stateLen, blkCnt);
+  if (blkCnt < blockSize)
+  {
+    riscv_copy_q7(pSrc + blkCnt, pState, blockSize - blkCnt);
+    riscv_copy_q7(pSrc + blkCnt, pState + stateLen, blockSize - blkCnt);
+  }
+
+  stateIdx += blockSize;
+  if (stateIdx >= stateLen)
+  {
+    stateIdx -= stateLen;
+  }
+  S->stateIndex = stateIdx;
+
+  /* The numTaps - 1 previous samples and the new block end just before stateIdx + stateLen */
+  px = pState + stateIdx + stateLen - (numTaps - 1U + blockSize);
+
+#if defined (RISCV_MATH_VECTOR)
+  for (i = blockSize; i > 0; i -= l)
+  {
+    l = __riscv_vsetvl_e8m2(i);
+    vx = __riscv_vle8_v_i8m2(px, l);
+    px += l;
+    vres0m8 = __riscv_vmv_v_x_i32m8(0, l);
+    for (j = 0; j < numTaps; j++) {
+      vres0m8 = __riscv_vwmacc_vx_i32m8(vres0m8, *(pCoeffs + j), __riscv_vwadd_vx_i16m4(vx, 0, l), l);
+      vx = __riscv_vslide1down_vx_i8m2(vx, *(px + j), l);
+    }
+    __riscv_vse8_v_i8m2(pDst, __riscv_vnclip_wx_i8m2(__riscv_vnsra_wx_i16m4(vres0m8, 7, l), 0, __RISCV_VXRM_RNU, l), l);
+    pDst += l;
+  }
+#else
+  for (i = 0U; i < blockSize; i++)
+  {
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    pb = pCoeffs;
+    pw = px + i;
+    j = numTaps;
+
+    /* Perform the multiply-accumulates */
+    while (j > 0U)
+    {
+      acc0 += (q15_t) *pb++ * *pw++;
+
+      /* Decrement loop counter */
+      j--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = (q7_t) (__SSAT((acc0 >> 7U), 8));
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_halfband_decimate_f32.c
+ * Description:  floating-point half-band FIR decimator
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_halfband_decimate Half-Band FIR Decimator
+
+  These functions decimate by 2 with a half-band lowpass filter. A half-band filter
+  has its cutoff at a quarter of the input sample rate and every other coefficient,
+  except the center one, is zero. With a linear phase design the coefficients are
+  also symmetric. Compared to \ref riscv_fir_decimate_f32 with <code>M = 2</code>, the
+  zero coefficients are skipped and the symmetric pairs share a multiplication, so an
+  output sample costs about <code>numTaps/4</code> multiplications instead of <code>numTaps</code>.
+
+  The functions operate on blocks of input and output data.
+  <code>pSrc</code> points to an array of <code>blockSize</code> input values and
+  <code>pDst</code> points to an array of <code>blockSize/2</code> output values.
+  <code>blockSize</code> must be even. The output is the one of \ref riscv_fir_decimate_f32
+  with the same coefficients and <code>M = 2</code>, so the functions fit in a decimation
+  chain between a \ref CIC_decimate stage and a final \ref FIR_decimate stage.
+
+  @par           Algorithm
+                   The filter length is <code>numTaps = 4*K - 1</code> and the center coefficient
+                   is <code>b[2*K-1]</code>. The coefficients <code>b[n]</code> with <code>n</code> odd,
+                   other than the center one, are zero and <code>b[n] = b[numTaps-1-n]</code>:
+  <pre>
+      y[m] = b[2K-1] * x[2m-2K+1] + sum_{j=0}^{K-1} b[2j] * (x[2m-2j] + x[2m-numTaps+1+2j])
+  </pre>
+                   Only the coefficients <code>b[0], b[2], ..., b[2K-2]</code> and <code>b[2K-1]</code>
+                   are read: the zero and mirrored coefficients of the array are not used.
+  @par
+                   <code>pState</code> points to a state array of size <code>numTaps + blockSize - 1</code>,
+                   with the same layout as for \ref riscv_fir_decimate_f32.
+
+  @par           Instance Structure
+                   The coefficients and state variables for a filter are stored together in an instance data structure.
+                   A separate instance structure must be defined for each filter.
+                   Coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+
+  @par           Initialization Functions
+                   The initialization function checks the filter length and the block size, sets
+                   the values of the internal structure fields and zeros out the state buffer.
+ */
+
+/**
+  @addtogroup FIR_halfband_decimate
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point half-band FIR decimator.
+  @param[in]     S          points to an instance of the floating-point half-band FIR decimator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process per call, an even number
+  @return        none
+ */
+void riscv_fir_halfband_decimate_f32(
+  const riscv_fir_halfband_decimate_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                  /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;                /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;                  /* Number of filter coefficients in the filter */
+        uint32_t center = (numTaps - 1U) >> 1U;         /* Index of the center coefficient */
+        uint32_t numPairs = (numTaps + 1U) >> 2U;       /* Number of non-zero symmetric pairs */
+        uint32_t outBlockSize = blockSize >> 1U;
+        uint32_t j;
+
+  /* The new input samples follow the last numTaps - 1 samples of the previous frame */
+  riscv_copy_f32(pSrc, pState + (numTaps - 1U), blockSize);
+
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt = outBlockSize;
+  size_t l;
+  float32_t *px = pState;
+  vfloat32m8_t v_acc, v_a, v_b;
+
+  /* One output per lane, the windows of consecutive outputs start 2 samples apart */
+  for (; (l = __riscv_vsetvl_e32m8(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_acc = __riscv_vfmul_vf_f32m8(__riscv_vlse32_v_f32m8(px + center, 2 * sizeof(float32_t), l), pCoeffs[center], l);
+    for (j = 0U; j < numPairs; j++)
+    {
+      v_a = __riscv_vlse32_v_f32m8(px + 2U * j, 2 * sizeof(float32_t), l);
+      v_b = __riscv_vlse32_v_f32m8(px + numTaps - 1U - 2U * j, 2 * sizeof(float32_t), l);
+      v_acc = __riscv_vfmacc_vf_f32m8(v_acc, pCoeffs[2U * j], __riscv_vfadd_vv_f32m8(v_a, v_b, l), l);
+    }
+    __riscv_vse32_v_f32m8(pDst, v_acc, l);
+    px += 2U * l;
+    pDst += l;
+  }
+#else
+  uint32_t i;
+  float32_t *px;
+  float32_t acc;
+
+  for (i = 0U; i < outBlockSize; i++)
+  {
+    px = pState + 2U * i;
+    acc = pCoeffs[center] * px[center];
+    for (j = 0U; j < numPairs; j++)
+    {
+      acc += pCoeffs[2U * j] * (px[2U * j] + px[numTaps - 1U - 2U * j]);
+    }
+    *pDst++ = acc;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer for the next call */
+  riscv_copy_f32(pState + blockSize, pState, numTaps - 1U);
+}
+
+/**
+  @} end of FIR_halfband_decimate group
+ */
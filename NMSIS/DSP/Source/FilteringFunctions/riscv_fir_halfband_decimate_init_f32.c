@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_halfband_decimate_init_f32.c
+ * Description:  Initialization function for the floating-point half-band FIR decimator
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_halfband_decimate
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point half-band FIR decimator.
+  @param[in,out] S          points to an instance of the floating-point half-band FIR decimator structure
+  @param[in]     numTaps    number of coefficients in the filter, of the form <code>4*K - 1</code>
+  @param[in]     pCoeffs    points to the filter coefficients
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  number of input samples to process per call
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>numTaps</code> is not of the form <code>4*K - 1</code>
+                   - \ref RISCV_MATH_LENGTH_ERROR   : <code>blockSize</code> is not even
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of <code>numTaps</code> coefficients of a
+                   symmetric half-band filter, as for \ref riscv_fir_decimate_init_f32.
+                   The zero coefficients are not read and need not be exactly zero.
+  @par
+                   <code>pState</code> points to the array of state variables.
+                   <code>pState</code> is of length <code>numTaps+blockSize-1</code> words where <code>blockSize</code> is the number of input samples
+                   to the call <code>riscv_fir_halfband_decimate_f32()</code>.
+ */
+riscv_status riscv_fir_halfband_decimate_init_f32(
+        riscv_fir_halfband_decimate_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  if ((numTaps & 3U) != 3U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* The size of the input block must be a multiple of the decimation factor */
+  if ((blockSize & 1U) != 0U)
+  {
+    return RISCV_MATH_LENGTH_ERROR;
+  }
+
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the state buffer. The size is always (blockSize + numTaps - 1) */
+  memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_halfband_decimate group
+ */
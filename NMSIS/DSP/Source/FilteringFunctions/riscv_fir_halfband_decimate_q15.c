@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_halfband_decimate_q15.c
+ * Description:  Q15 half-band FIR decimator
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_halfband_decimate
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 half-band FIR decimator.
+  @param[in]     S          points to an instance of the Q15 half-band FIR decimator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process per call, an even number
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   The sum of two state variables is exact in 32 bits and the products with the
+                   1.15 coefficients are accumulated in 34.30 format, as for \ref riscv_fir_decimate_q15.
+                   The accumulator is then truncated to 34.15 format by discarding the low 15 bits
+                   and saturated to 1.15 format.
+                   The result is bit exact with \ref riscv_fir_decimate_q15 for <code>M = 2</code>.
+ */
+void riscv_fir_halfband_decimate_q15(
+  const riscv_fir_halfband_decimate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                      /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                    /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;                  /* Number of filter coefficients in the filter */
+        uint32_t center = (numTaps - 1U) >> 1U;         /* Index of the center coefficient */
+        uint32_t numPairs = (numTaps + 1U) >> 2U;       /* Number of non-zero symmetric pairs */
+        uint32_t outBlockSize = blockSize >> 1U;
+        uint32_t j;
+
+  /* The new input samples follow the last numTaps - 1 samples of the previous frame */
+  riscv_copy_q15(pSrc, pState + (numTaps - 1U), blockSize);
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  uint32_t blkCnt = outBlockSize;
+  size_t l;
+  q15_t *px = pState;
+  vint64m8_t v_acc;
+  vint16m2_t v_a, v_b;
+
+  /* One output per lane, the windows of consecutive outputs start 2 samples apart */
+  for (; (l = __riscv_vsetvl_e16m2(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_a = __riscv_vlse16_v_i16m2(px + center, 2 * sizeof(q15_t), l);
+    v_acc = __riscv_vwmul_vx_i64m8(__riscv_vsext_vf2_i32m4(v_a, l), pCoeffs[center], l);
+    for (j = 0U; j < numPairs; j++)
+    {
+      v_a = __riscv_vlse16_v_i16m2(px + 2U * j, 2 * sizeof(q15_t), l);
+      v_b = __riscv_vlse16_v_i16m2(px + numTaps - 1U - 2U * j, 2 * sizeof(q15_t), l);
+      v_acc = __riscv_vwmacc_vx_i64m8(v_acc, pCoeffs[2U * j], __riscv_vwadd_vv_i32m4(v_a, v_b, l), l);
+    }
+    __riscv_vse16_v_i16m2(pDst, __riscv_vnclip_wx_i16m2(__riscv_vnsra_wx_i32m4(v_acc, 15U, l), 0U, __RISCV_VXRM_RNU, l), l);
+    px += 2U * l;
+    pDst += l;
+  }
+#else
+  uint32_t i;
+  q15_t *px;
+  q63_t acc;
+
+  for (i = 0U; i < outBlockSize; i++)
+  {
+    px = pState + 2U * i;
+    acc = (q63_t) pCoeffs[center] * px[center];
+    for (j = 0U; j < numPairs; j++)
+    {
+      acc += (q63_t) pCoeffs[2U * j] * ((q31_t) px[2U * j] + px[numTaps - 1U - 2U * j]);
+    }
+    *pDst++ = (q15_t) __SSAT((q31_t) (acc >> 15), 16);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer for the next call */
+  riscv_copy_q15(pState + blockSize, pState, numTaps - 1U);
+}
+
+/**
+  @} end of FIR_halfband_decimate group
+ */
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_halfband_decimate_q31.c
+ * Description:  Q31 half-band FIR decimator
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_halfband_decimate
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 half-band FIR decimator.
+  @param[in]     S          points to an instance of the Q31 half-band FIR decimator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process per call, an even number
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The sum of two state variables is exact in 64 bits and the products with the
+                   1.31 coefficients are accumulated in 2.62 format, as for \ref riscv_fir_decimate_q31.
+                   The accumulator is then truncated to 1.31 format by discarding the low 31 bits.
+                   The result is bit exact with \ref riscv_fir_decimate_q31 for <code>M = 2</code>.
+ */
+void riscv_fir_halfband_decimate_q31(
+  const riscv_fir_halfband_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                      /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;                    /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;                  /* Number of filter coefficients in the filter */
+        uint32_t center = (numTaps - 1U) >> 1U;         /* Index of the center coefficient */
+        uint32_t numPairs = (numTaps + 1U) >> 2U;       /* Number of non-zero symmetric pairs */
+        uint32_t outBlockSize = blockSize >> 1U;
+        uint32_t j;
+
+  /* The new input samples follow the last numTaps - 1 samples of the previous frame */
+  riscv_copy_q31(pSrc, pState + (numTaps - 1U), blockSize);
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  uint32_t blkCnt = outBlockSize;
+  size_t l;
+  q31_t *px = pState;
+  vint64m8_t v_acc;
+  vint32m4_t v_a, v_b;
+
+  /* One output per lane, the windows of consecutive outputs start 2 samples apart */
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_acc = __riscv_vwmul_vx_i64m8(__riscv_vlse32_v_i32m4(px + center, 2 * sizeof(q31_t), l), pCoeffs[center], l);
+    for (j = 0U; j < numPairs; j++)
+    {
+      v_a = __riscv_vlse32_v_i32m4(px + 2U * j, 2 * sizeof(q31_t), l);
+      v_b = __riscv_vlse32_v_i32m4(px + numTaps - 1U - 2U * j, 2 * sizeof(q31_t), l);
+      v_acc = __riscv_vmacc_vx_i64m8(v_acc, pCoeffs[2U * j], __riscv_vwadd_vv_i64m8(v_a, v_b, l), l);
+    }
+    __riscv_vse32_v_i32m4(pDst, __riscv_vnsra_wx_i32m4(v_acc, 31U, l), l);
+    px += 2U * l;
+    pDst += l;
+  }
+#else
+  uint32_t i;
+  q31_t *px;
+  q63_t acc;
+
+  for (i = 0U; i < outBlockSize; i++)
+  {
+    px = pState + 2U * i;
+    acc = (q63_t) pCoeffs[center] * px[center];
+    for (j = 0U; j < numPairs; j++)
+    {
+      acc += (q63_t) pCoeffs[2U * j] * ((q63_t) px[2U * j] + px[numTaps - 1U - 2U * j]);
+    }
+    *pDst++ = (q31_t) (acc >> 31);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer for the next call */
+  riscv_copy_q31(pState + blockSize, pState, numTaps - 1U);
+}
+
+/**
+  @} end of FIR_halfband_decimate group
+ */
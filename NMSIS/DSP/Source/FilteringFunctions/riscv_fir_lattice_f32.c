@@ -142,6 +142,71 @@ void riscv_fir_lattice_f32(
         float32_t fcurr3, fnext3, gnext3;              /* Temporary variables for fourth sample in loop unrolling */
 #endif
 
+#if defined (RISCV_MATH_VECTOR)
+        size_t l;
+        uint32_t step, numSteps;                       /* Wavefront step counters */
+        uint32_t firstLane, lastLane;                  /* Stages working on a sample of the block */
+        float32_t in;                                  /* Input sample entering the first stage */
+        vfloat32m8_t v_k, v_fin, v_gin, v_fout, v_gout, v_gprev;
+        vuint32m8_t v_idx;
+        vbool4_t v_mask;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+#if defined (RISCV_MATH_VECTOR)
+  /*
+   * Wavefront across stages and samples: lane m computes stage m+1 and, at step s,
+   * works on sample s-m. Each step shifts the f and g outputs one lane up, so all
+   * the stages run in parallel once numStages-1 samples have entered the lattice.
+   * Filters longer than one vector register group use the scalar code below.
+   */
+  l = __riscv_vsetvl_e32m8(numStages);
+  if (l == numStages)
+  {
+    v_k = __riscv_vle32_v_f32m8(pCoeffs, l);
+    /* g(m)[n-1] of the sample each stage processes next */
+    v_gprev = __riscv_vle32_v_f32m8(pState, l);
+    v_fout = __riscv_vfmv_v_f_f32m8(0.0f, l);
+    v_gout = __riscv_vfmv_v_f_f32m8(0.0f, l);
+    v_idx = __riscv_vid_v_u32m8(l);
+
+    numSteps = blockSize + numStages - 1U;
+    for (step = 0U; step < numSteps; step++)
+    {
+      /* f0(n) = g0(n) = x(n) */
+      in = (step < blockSize) ? pSrc[step] : 0.0f;
+      v_fin = __riscv_vfslide1up_vf_f32m8(v_fout, in, l);
+      v_gin = __riscv_vfslide1up_vf_f32m8(v_gout, in, l);
+
+      /* fm(n) = fm-1(n) + km * gm-1(n-1), gm(n) = km * fm-1(n) + gm-1(n-1) */
+      v_fout = __riscv_vfmacc_vv_f32m8(v_fin, v_k, v_gprev, l);
+      v_gout = __riscv_vfmacc_vv_f32m8(v_gprev, v_k, v_fin, l);
+
+      if ((step < numStages - 1U) || (step >= blockSize))
+      {
+        /* Filling and draining the lattice: only the lanes firstLane..lastLane work on a sample of the block */
+        firstLane = (step >= blockSize) ? (step - blockSize + 1U) : 0U;
+        lastLane = (step < numStages - 1U) ? step : (numStages - 1U);
+        v_mask = __riscv_vmsltu_vx_u32m8_b4(__riscv_vsub_vx_u32m8(v_idx, firstLane, l), lastLane + 1U - firstLane, l);
+        v_gprev = __riscv_vmerge_vvm_f32m8(v_gprev, v_gin, v_mask, l);
+      }
+      else
+      {
+        v_gprev = v_gin;
+      }
+
+      /* y(n) = fM(n), leaving the last stage */
+      if (step >= numStages - 1U)
+      {
+        pDst[step - (numStages - 1U)] = __riscv_vfmv_f_s_f32m8_f32(__riscv_vslidedown_vx_f32m8(v_fout, numStages - 1U, l));
+      }
+    }
+
+    /* g(m)[n] of the last sample is the new state */
+    __riscv_vse32_v_f32m8(pState, v_gprev, l);
+    return;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
   gcurr0 = 0.0f;
 
 #if defined (RISCV_MATH_LOOPUNROLL)
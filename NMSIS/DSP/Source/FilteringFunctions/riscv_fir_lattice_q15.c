@@ -69,6 +69,71 @@ void riscv_fir_lattice_q15(
   q31_t fcurr3, fnext3, gnext3;                  /* Temporary variables for fourth sample in loop unrolling */
 #endif
 
+#if defined (RISCV_MATH_VECTOR)
+        size_t l;
+        uint32_t step, numSteps;                       /* Wavefront step counters */
+        uint32_t firstLane, lastLane;                  /* Stages working on a sample of the block */
+        q15_t in;                                      /* Input sample entering the first stage */
+        vint16m4_t v_k, v_fin, v_gin, v_fout, v_gout, v_gprev;
+        vuint16m4_t v_idx;
+        vbool4_t v_mask;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+#if defined (RISCV_MATH_VECTOR)
+  /*
+   * Wavefront across stages and samples: lane m computes stage m+1 and, at step s,
+   * works on sample s-m. Each step shifts the f and g outputs one lane up, so all
+   * the stages run in parallel once numStages-1 samples have entered the lattice.
+   * Filters longer than one vector register group use the scalar code below.
+   */
+  l = __riscv_vsetvl_e16m4(numStages);
+  if (l == numStages)
+  {
+    v_k = __riscv_vle16_v_i16m4(pCoeffs, l);
+    /* g(m)[n-1] of the sample each stage processes next */
+    v_gprev = __riscv_vle16_v_i16m4(pState, l);
+    v_fout = __riscv_vmv_v_x_i16m4(0, l);
+    v_gout = __riscv_vmv_v_x_i16m4(0, l);
+    v_idx = __riscv_vid_v_u16m4(l);
+
+    numSteps = blockSize + numStages - 1U;
+    for (step = 0U; step < numSteps; step++)
+    {
+      /* f0(n) = g0(n) = x(n) */
+      in = (step < blockSize) ? pSrc[step] : 0;
+      v_fin = __riscv_vslide1up_vx_i16m4(v_fout, in, l);
+      v_gin = __riscv_vslide1up_vx_i16m4(v_gout, in, l);
+
+      /* fm(n) = fm-1(n) + km * gm-1(n-1), gm(n) = km * fm-1(n) + gm-1(n-1) */
+      v_fout = __riscv_vnclip_wx_i16m4(__riscv_vwadd_wv_i32m8(__riscv_vsra_vx_i32m8(__riscv_vwmul_vv_i32m8(v_gprev, v_k, l), 15U, l), v_fin, l), 0U, __RISCV_VXRM_RNU, l);
+      v_gout = __riscv_vnclip_wx_i16m4(__riscv_vwadd_wv_i32m8(__riscv_vsra_vx_i32m8(__riscv_vwmul_vv_i32m8(v_fin, v_k, l), 15U, l), v_gprev, l), 0U, __RISCV_VXRM_RNU, l);
+
+      if ((step < numStages - 1U) || (step >= blockSize))
+      {
+        /* Filling and draining the lattice: only the lanes firstLane..lastLane work on a sample of the block */
+        firstLane = (step >= blockSize) ? (step - blockSize + 1U) : 0U;
+        lastLane = (step < numStages - 1U) ? step : (numStages - 1U);
+        v_mask = __riscv_vmsltu_vx_u16m4_b4(__riscv_vsub_vx_u16m4(v_idx, firstLane, l), lastLane + 1U - firstLane, l);
+        v_gprev = __riscv_vmerge_vvm_i16m4(v_gprev, v_gin, v_mask, l);
+      }
+      else
+      {
+        v_gprev = v_gin;
+      }
+
+      /* y(n) = fM(n), leaving the last stage */
+      if (step >= numStages - 1U)
+      {
+        pDst[step - (numStages - 1U)] = __riscv_vmv_x_s_i16m4_i16(__riscv_vslidedown_vx_i16m4(v_fout, numStages - 1U, l));
+      }
+    }
+
+    /* g(m)[n] of the last sample is the new state */
+    __riscv_vse16_v_i16m4(pState, v_gprev, l);
+    return;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
   gcurr0 = 0;
 
 #if defined (RISCV_MATH_LOOPUNROLL)
@@ -0,0 +1,206 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_multi_f32.c
+ * Description:  floating-point multi-channel FIR filter processing function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point multi-channel FIR filter.
+  @param[in]     S          points to an instance of the floating-point multi-channel FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+
+  @par           Details
+                   The <code>numChans</code> channels are filtered with the same coefficients.
+                   <code>pSrc</code> and <code>pDst</code> hold <code>numChans*blockSize</code> values,
+                   interleaved or one channel after the other depending on the layout
+                   selected at initialization. Each channel gives the same result as
+                   \ref riscv_fir_f32 applied to it.
+  @par
+                   The state buffer is interleaved, so the vector version processes several
+                   channels at once with unit-stride loads of the state and one scalar
+                   coefficient per tap, the coefficient stream being read once per output sample.
+ */
+void riscv_fir_multi_f32(
+  const riscv_fir_multi_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;            /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;          /* Coefficient pointer */
+        float32_t *pStateCurnt;                   /* Points to the current sample of the state */
+  const float32_t *px;                            /* Temporary pointer for state buffer */
+        uint32_t numTaps = S->numTaps;            /* Number of filter coefficients in the filter */
+        uint32_t numChans = S->numChans;          /* Number of channels */
+        uint32_t chanStride, sampleStride;        /* Strides of the input and output blocks */
+        uint32_t n, ch, k;                        /* Loop counters */
+
+#if defined (RISCV_MATH_VECTOR)
+  size_t l;
+  uint32_t blkCnt;
+  vfloat32m4_t v_x;
+  vfloat32m4_t v_acc;
+#else
+  float32_t acc0, acc1, acc2, acc3;               /* Accumulators of a group of four channels */
+  float32_t c;                                    /* Filter coefficient */
+  float32_t *pOut;                                /* Output pointer of the current sample */
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  if (S->layout == RISCV_MULTICHANNEL_INTERLEAVED)
+  {
+    chanStride = 1U;
+    sampleStride = numChans;
+  }
+  else
+  {
+    chanStride = blockSize;
+    sampleStride = 1U;
+  }
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples of each channel */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = pState + (numTaps - 1U) * numChans;
+
+  /* Copy the new input samples to the state buffer, interleaved */
+  if (chanStride == 1U)
+  {
+    riscv_copy_f32(pSrc, pStateCurnt, blockSize * numChans);
+  }
+  else
+  {
+    for (ch = 0U; ch < numChans; ch++)
+    {
+#if defined (RISCV_MATH_VECTOR)
+      blkCnt = blockSize;
+      n = 0U;
+      for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+        v_x = __riscv_vle32_v_f32m4(pSrc + ch * blockSize + n, l);
+        __riscv_vsse32_v_f32m4(pStateCurnt + n * numChans + ch, (ptrdiff_t) numChans * 4, v_x, l);
+        n += l;
+      }
+#else
+      for (n = 0U; n < blockSize; n++)
+      {
+        pStateCurnt[n * numChans + ch] = pSrc[ch * blockSize + n];
+      }
+#endif /* defined (RISCV_MATH_VECTOR) */
+    }
+  }
+
+#if defined (RISCV_MATH_VECTOR)
+  /* Channels are processed in groups of vector length, each tap is a vector times scalar accumulation */
+  blkCnt = numChans;
+  ch = 0U;
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    for (n = 0U; n < blockSize; n++)
+    {
+      px = pState + n * numChans + ch;
+      v_acc = __riscv_vfmv_v_f_f32m4(0.0f, l);
+      for (k = 0U; k < numTaps; k++)
+      {
+        v_acc = __riscv_vfmacc_vf_f32m4(v_acc, pCoeffs[k], __riscv_vle32_v_f32m4(px, l), l);
+        px += numChans;
+      }
+      if (chanStride == 1U)
+      {
+        __riscv_vse32_v_f32m4(pDst + n * sampleStride + ch, v_acc, l);
+      }
+      else
+      {
+        __riscv_vsse32_v_f32m4(pDst + n + ch * chanStride, (ptrdiff_t) chanStride * 4, v_acc, l);
+      }
+    }
+    ch += l;
+  }
+#else
+  /* Channels are processed in groups of four, each coefficient is loaded once per group */
+  for (n = 0U; n < blockSize; n++)
+  {
+    pOut = pDst + n * sampleStride;
+
+    for (ch = 0U; (ch + 4U) <= numChans; ch += 4U)
+    {
+      px = pState + n * numChans + ch;
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+      for (k = 0U; k < numTaps; k++)
+      {
+        c = pCoeffs[k];
+        acc0 += c * px[0];
+        acc1 += c * px[1];
+        acc2 += c * px[2];
+        acc3 += c * px[3];
+        px += numChans;
+      }
+      pOut[ch * chanStride] = acc0;
+      pOut[(ch + 1U) * chanStride] = acc1;
+      pOut[(ch + 2U) * chanStride] = acc2;
+      pOut[(ch + 3U) * chanStride] = acc3;
+    }
+
+    /* Remaining channels */
+    for (; ch < numChans; ch++)
+    {
+      px = pState + n * numChans + ch;
+      acc0 = 0.0f;
+      for (k = 0U; k < numTaps; k++)
+      {
+        acc0 += pCoeffs[k] * *px;
+        px += numChans;
+      }
+      pOut[ch * chanStride] = acc0;
+    }
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples of each channel to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+  riscv_copy_f32(pState + blockSize * numChans, pState, (numTaps - 1U) * numChans);
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_multi_init_q31.c
+ * Description:  Q31 multi-channel FIR filter initialization function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 multi-channel FIR filter.
+  @param[in,out] S          points to an instance of the Q31 multi-channel FIR filter structure
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     numChans   number of channels filtered with the same coefficients
+  @param[in]     layout     layout of the input and output blocks
+                   - \ref RISCV_MULTICHANNEL_INTERLEAVED : sample n of channel c at index <code>n*numChans+c</code>
+                   - \ref RISCV_MULTICHANNEL_PLANAR      : sample n of channel c at index <code>c*blockSize+n</code>
+  @param[in]     pCoeffs    points to the filter coefficients buffer
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  number of samples per channel processed
+  @return        none
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+                   as for \ref riscv_fir_init_q31. The same coefficients are used for all the channels.
+  @par
+                   <code>pState</code> points to the array of state variables.
+                   <code>pState</code> is of length <code>(numTaps+blockSize-1)*numChans</code> samples.
+                   The state is always stored interleaved, whatever the layout of the
+                   input and output blocks, so that the samples of all the channels at a
+                   given time are contiguous.
+ */
+
+void riscv_fir_multi_init_q31(
+        riscv_fir_multi_instance_q31 * S,
+        uint16_t numTaps,
+        uint16_t numChans,
+        riscv_multichannel_layout layout,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize)
+{
+  /* Assign filter taps, channels and layout */
+  S->numTaps = numTaps;
+  S->numChans = numChans;
+  S->layout = layout;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer. The size is always (blockSize + numTaps - 1) * numChans */
+  memset(pState, 0, (numTaps + (blockSize - 1U)) * numChans * sizeof(q31_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,256 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_partitioned_f32.c
+ * Description:  Uniformly partitioned frequency domain FIR filter for floating-point data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Partitioned Partitioned Frequency Domain FIR Filters
+
+  This group of functions implements long FIR filters with a uniformly partitioned
+  overlap-save algorithm. The processing functions have the same block interface
+  as \ref riscv_fir_f32 and give the same output, but the cost per sample grows
+  with <code>log2(blockLen)</code> and <code>numTaps / blockLen</code> instead of
+  <code>numTaps</code>.
+
+  @par           Algorithm
+                   The impulse response is split in <code>numParts = ceil(numTaps / blockLen)</code>
+                   partitions of <code>blockLen</code> taps. The spectrum of each partition,
+                   zero padded to <code>2*blockLen</code>, is computed once by the initialization
+                   function. For each block of <code>blockLen</code> input samples:
+                   - the last <code>2*blockLen</code> input samples are transformed with
+                     \ref riscv_rfft_fast_f32 and the spectrum is stored in a frequency-domain
+                     delay line holding the spectra of the last <code>numParts</code> blocks;
+                   - the spectra of the delay line are multiplied by the partition spectra and summed;
+                   - the inverse transform of the sum gives <code>blockLen</code> output samples
+                     in its second half.
+  @par
+                   The input-output latency is the one of \ref riscv_fir_f32: each call
+                   produces the output samples of its own input samples, for any
+                   <code>blockSize</code>. When a call ends inside a partition, the samples
+                   received so far are filtered with the rest of the partition taken as zeros,
+                   which gives their exact output since the filter is causal, and the partition
+                   is transformed again once complete. A <code>blockSize</code> multiple of
+                   <code>blockLen</code> avoids these extra transforms. Smaller partitions lower
+                   the latency of the calling application and larger partitions lower the cost
+                   per sample.
+
+  @par           Instance Structure
+                   The coefficient spectra and state variables for a filter are stored together
+                   in an instance data structure. The coefficient spectra can be shared by
+                   several instances with the same <code>numTaps</code> and <code>blockLen</code>.
+
+  @par           Initialization Functions
+                   The initialization function computes the coefficient spectra, initializes the
+                   real FFT and zeros out the state buffer. Supported values of <code>blockLen</code>
+                   are 16, 32, 64, ..., 2048. The buffers are sized with
+                   <code>RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen)</code> and
+                   <code>RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen)</code>.
+
+  @par           Fixed-Point Behavior
+                   The Q31 functions convert each block to floating-point and use the same
+                   floating-point algorithm: Q31 transforms scale their output down by the FFT
+                   length and the product of two of them would keep too few significant bits
+                   for long filters. The output is saturated to the Q31 range.
+ */
+
+/*
+ * Filters the partition stored in the second half of the input window, without
+ * advancing the filter. Returns a pointer to the blockLen output samples.
+ *
+ * State layout: input window (2*blockLen), frequency-domain delay line
+ * (numParts spectra of 2*blockLen), spectrum accumulator (2*blockLen) and
+ * working buffer (2*blockLen).
+ */
+float32_t * riscv_fir_partitioned_filter_f32(
+  riscv_fir_partitioned_instance_f32 * S)
+{
+  uint32_t fftLen = 2U * S->blockLen;
+  uint32_t numParts = S->numParts;
+  float32_t *pWindow = S->pState;
+  float32_t *pFdl = pWindow + fftLen;
+  float32_t *pAcc = pFdl + numParts * fftLen;
+  float32_t *pWork = pAcc + fftLen;
+  const float32_t *pX, *pH;
+  uint32_t k, slot;
+  float32_t acc0, acc1;
+
+  /* Spectrum of the last 2*blockLen input samples, stored at the head of the delay line */
+  riscv_copy_f32(pWindow, pWork, fftLen);
+  riscv_rfft_fast_f32(&(S->rfft), pWork, pFdl + S->fdlIndex * fftLen, 0);
+
+  /* DC and Nyquist terms are real */
+  acc0 = 0.0f;
+  acc1 = 0.0f;
+  slot = S->fdlIndex;
+  for (k = 0U; k < numParts; k++)
+  {
+    pX = pFdl + slot * fftLen;
+    pH = S->pCoeffSpectra + k * fftLen;
+    acc0 += pX[0] * pH[0];
+    acc1 += pX[1] * pH[1];
+    slot = (slot == 0U) ? (numParts - 1U) : (slot - 1U);
+  }
+
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt, offset;
+  size_t l;
+  vfloat32m4x2_t v_x, v_h;
+  vfloat32m4_t v_xr, v_xi, v_hr, v_hi, v_re, v_im;
+
+  /* Complex multiply-accumulate over the partitions, with the accumulator kept in registers */
+  offset = 2U;
+  blkCnt = S->blockLen - 1U;
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_re = __riscv_vfmv_v_f_f32m4(0.0f, l);
+    v_im = __riscv_vfmv_v_f_f32m4(0.0f, l);
+    slot = S->fdlIndex;
+    for (k = 0U; k < numParts; k++)
+    {
+      v_x = __riscv_vlseg2e32_v_f32m4x2(pFdl + slot * fftLen + offset, l);
+      v_h = __riscv_vlseg2e32_v_f32m4x2(S->pCoeffSpectra + k * fftLen + offset, l);
+      v_xr = __riscv_vget_v_f32m4x2_f32m4(v_x, 0);
+      v_xi = __riscv_vget_v_f32m4x2_f32m4(v_x, 1);
+      v_hr = __riscv_vget_v_f32m4x2_f32m4(v_h, 0);
+      v_hi = __riscv_vget_v_f32m4x2_f32m4(v_h, 1);
+      v_re = __riscv_vfmacc_vv_f32m4(v_re, v_xr, v_hr, l);
+      v_re = __riscv_vfnmsac_vv_f32m4(v_re, v_xi, v_hi, l);
+      v_im = __riscv_vfmacc_vv_f32m4(v_im, v_xr, v_hi, l);
+      v_im = __riscv_vfmacc_vv_f32m4(v_im, v_xi, v_hr, l);
+      slot = (slot == 0U) ? (numParts - 1U) : (slot - 1U);
+    }
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 0, v_re);
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 1, v_im);
+    __riscv_vsseg2e32_v_f32m4x2(pAcc + offset, v_x, l);
+    offset += 2U * l;
+  }
+#else
+  uint32_t i;
+  float32_t xr, xi, hr, hi;
+
+  riscv_fill_f32(0.0f, pAcc + 2, fftLen - 2U);
+  slot = S->fdlIndex;
+  for (k = 0U; k < numParts; k++)
+  {
+    pX = pFdl + slot * fftLen;
+    pH = S->pCoeffSpectra + k * fftLen;
+    for (i = 2U; i < fftLen; i += 2U)
+    {
+      xr = pX[i];
+      xi = pX[i + 1U];
+      hr = pH[i];
+      hi = pH[i + 1U];
+      pAcc[i]      += xr * hr - xi * hi;
+      pAcc[i + 1U] += xr * hi + xi * hr;
+    }
+    slot = (slot == 0U) ? (numParts - 1U) : (slot - 1U);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+  pAcc[0] = acc0;
+  pAcc[1] = acc1;
+
+  /* Overlap-save: the second half of the inverse transform is the output */
+  riscv_rfft_fast_f32(&(S->rfft), pAcc, pWork, 1);
+
+  return pWork + S->blockLen;
+}
+
+/*
+ * Filters one complete block of blockLen samples, stored in the second half of
+ * the input window, and advances the filter. Returns a pointer to the blockLen
+ * output samples.
+ */
+float32_t * riscv_fir_partitioned_block_f32(
+  riscv_fir_partitioned_instance_f32 * S)
+{
+  float32_t *pOut = riscv_fir_partitioned_filter_f32(S);
+
+  /* Slide the input window and advance the delay line */
+  riscv_copy_f32(S->pState + S->blockLen, S->pState, S->blockLen);
+  S->fdlIndex = (S->fdlIndex + 1U == S->numParts) ? 0U : (S->fdlIndex + 1U);
+
+  return pOut;
+}
+
+/**
+  @addtogroup FIR_Partitioned
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point partitioned FIR filter.
+  @param[in,out] S          points to an instance of the floating-point partitioned FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void riscv_fir_partitioned_f32(
+        riscv_fir_partitioned_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blockLen = S->blockLen;
+  float32_t *pIn = S->pState + blockLen;       /* Current partition, second half of the input window */
+  uint32_t fill, n;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the current partition */
+    fill = S->fill;
+    n = MIN(blockLen - fill, blockSize);
+    riscv_copy_f32(pSrc, pIn + fill, n);
+
+    if (fill + n == blockLen)
+    {
+      riscv_copy_f32(riscv_fir_partitioned_block_f32(S) + fill, pDst, n);
+      S->fill = 0U;
+    }
+    else
+    {
+      riscv_fill_f32(0.0f, pIn + fill + n, blockLen - fill - n);
+      riscv_copy_f32(riscv_fir_partitioned_filter_f32(S) + fill, pDst, n);
+      S->fill = (uint16_t) (fill + n);
+    }
+
+    pSrc += n;
+    pDst += n;
+    blockSize -= n;
+  }
+}
+
+/**
+  @} end of FIR_Partitioned group
+ */
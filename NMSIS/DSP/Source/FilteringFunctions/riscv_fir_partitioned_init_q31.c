@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_partitioned_init_q31.c
+ * Description:  Q31 partitioned FIR filter initialization function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+riscv_status riscv_fir_partitioned_setup_f32(
+        riscv_fir_partitioned_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t blockLen,
+  const float32_t * pCoeffSpectra,
+        float32_t * pState,
+        float32_t * pBuffer);
+
+/*
+ * Computes the spectrum of each partition of the converted b[n], zero padded
+ * to 2*blockLen, using the end of the state buffer as working memory.
+ */
+static void riscv_fir_partitioned_spectra_q31(
+        riscv_fir_partitioned_instance_f32 * Sf,
+  const q31_t * pCoeffs,
+        float32_t * pCoeffSpectra)
+{
+  float32_t *pWork;
+  uint32_t k, i, n, fftLen;
+  uint32_t numTaps = Sf->numTaps;
+  uint32_t blockLen = Sf->blockLen;
+
+  fftLen = 2U * blockLen;
+  pWork = Sf->pState + (Sf->numParts + 2U) * fftLen;
+
+  for (k = 0U; k < Sf->numParts; k++)
+  {
+    n = MIN(blockLen, numTaps - k * blockLen);
+    for (i = 0U; i < n; i++)
+    {
+      pWork[i] = (float32_t) pCoeffs[numTaps - 1U - k * blockLen - i] / 2147483648.0f;
+    }
+    riscv_fill_f32(0.0f, pWork + n, fftLen - n);
+    riscv_rfft_fast_f32(&(Sf->rfft), pWork, pCoeffSpectra + k * fftLen, 0);
+  }
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Partitioned
+  @{
+ */
+
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
+/**
+  @brief         Initialization function for the Q31 partitioned FIR filter.
+  @param[in,out] S              points to an instance of the Q31 partitioned FIR structure
+  @param[in]     numTaps        number of filter coefficients in the filter
+  @param[in]     pCoeffs        points to the filter coefficients buffer
+  @param[out]    pCoeffSpectra  points to a buffer of <code>RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen)</code>
+                                values receiving the coefficient spectra
+  @param[in]     pState         points to a state buffer of <code>RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen)</code> values
+  @param[in]     blockLen       partition length, a power of 2 between 16 and 2048
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>blockLen</code> is not a supported length or <code>numTaps</code> is 0
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of Q31 filter coefficients stored in time
+                   reversed order, as for \ref riscv_fir_init_q31. The coefficient spectra and the
+                   state are floating-point values.
+ */
+riscv_status riscv_fir_partitioned_init_q31(
+        riscv_fir_partitioned_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen)
+{
+  riscv_status status;
+
+  status = riscv_fir_partitioned_setup_f32(&(S->Sf32), numTaps, blockLen, pCoeffSpectra, pState, NULL);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  riscv_fir_partitioned_spectra_q31(&(S->Sf32), pCoeffs, pCoeffSpectra);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+  @brief         Initialization function for the Q31 partitioned FIR filter with FFT tables computed at runtime.
+  @param[in,out] S              points to an instance of the Q31 partitioned FIR structure
+  @param[in]     numTaps        number of filter coefficients in the filter
+  @param[in]     pCoeffs        points to the filter coefficients buffer
+  @param[out]    pCoeffSpectra  points to a buffer of <code>RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen)</code>
+                                values receiving the coefficient spectra
+  @param[in]     pState         points to a state buffer of <code>RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen)</code> values
+  @param[in]     blockLen       partition length, a power of 2 between 16 and 2048
+  @param[out]    pBuffer        points to a buffer of <code>RISCV_FIR_PARTITIONED_DYNAMIC_BUFFER_SIZE_F32(blockLen)</code>
+                                values receiving the FFT tables
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>blockLen</code> is not a supported length or <code>numTaps</code> is 0
+
+  @par           Details
+                   Same as \ref riscv_fir_partitioned_init_q31 but the real FFT is initialized with
+                   \ref riscv_rfft_fast_init_dynamic_f32. It is also available when the library is
+                   built with <code>RISCV_FFT_NO_ROM_TABLES</code>.
+ */
+riscv_status riscv_fir_partitioned_init_dynamic_q31(
+        riscv_fir_partitioned_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen,
+        float32_t * pBuffer)
+{
+  riscv_status status;
+
+  if (pBuffer == NULL)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_fir_partitioned_setup_f32(&(S->Sf32), numTaps, blockLen, pCoeffSpectra, pState, pBuffer);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  riscv_fir_partitioned_spectra_q31(&(S->Sf32), pCoeffs, pCoeffSpectra);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_Partitioned group
+ */
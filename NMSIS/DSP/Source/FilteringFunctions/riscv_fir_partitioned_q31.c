@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_partitioned_q31.c
+ * Description:  Uniformly partitioned frequency domain FIR filter for Q31 data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+float32_t * riscv_fir_partitioned_filter_f32(
+  riscv_fir_partitioned_instance_f32 * S);
+
+float32_t * riscv_fir_partitioned_block_f32(
+  riscv_fir_partitioned_instance_f32 * S);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Partitioned
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 partitioned FIR filter.
+  @param[in,out] S          points to an instance of the Q31 partitioned FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The input blocks are converted to floating-point and filtered by
+                   the floating-point algorithm. The output is converted back with
+                   \ref riscv_float_to_q31 and saturates instead of wrapping.
+ */
+void riscv_fir_partitioned_q31(
+        riscv_fir_partitioned_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  riscv_fir_partitioned_instance_f32 *Sf = &(S->Sf32);
+  uint32_t blockLen = Sf->blockLen;
+  float32_t *pIn = Sf->pState + blockLen;      /* Current partition, second half of the input window */
+  uint32_t fill, n;
+
+  while (blockSize > 0U)
+  {
+    /* Samples up to the end of the current partition */
+    fill = Sf->fill;
+    n = MIN(blockLen - fill, blockSize);
+    riscv_q31_to_float(pSrc, pIn + fill, n);
+
+    if (fill + n == blockLen)
+    {
+      riscv_float_to_q31(riscv_fir_partitioned_block_f32(Sf) + fill, pDst, n);
+      Sf->fill = 0U;
+    }
+    else
+    {
+      riscv_fill_f32(0.0f, pIn + fill + n, blockLen - fill - n);
+      riscv_float_to_q31(riscv_fir_partitioned_filter_f32(Sf) + fill, pDst, n);
+      Sf->fill = (uint16_t) (fill + n);
+    }
+
+    pSrc += n;
+    pDst += n;
+    blockSize -= n;
+  }
+}
+
+/**
+  @} end of FIR_Partitioned group
+ */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_resample_f32.c
+ * Description:  floating-point FIR rational resampler
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+
+  These functions change the sample rate of a signal by the rational factor <code>L/M</code>.
+  Conceptually, they are equivalent to an FIR interpolator by <code>L</code> followed by a
+  downsampler keeping one sample out of <code>M</code>:
+  the output is the one of \ref riscv_fir_interpolate_f32 from which only the samples
+  <code>M-1</code>, <code>2*M-1</code>, ... are kept, which is also the phase used by
+  \ref riscv_fir_decimate_f32.
+  Only these output samples are computed, with the polyphase component they need,
+  so the cost per output is <code>numTaps/L</code> multiply-accumulates whatever the ratio.
+
+  @par           Algorithm
+                   Output <code>m</code> is the sample <code>t=m*M+M-1</code> of the upsampled sequence.
+                   With <code>t=n*L+p</code>, it is computed from the input samples up to <code>x[n]</code>:
+  <pre>
+      y[m] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+  </pre>
+  @par
+                   <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>,
+                   stored in time reversed order as for the FIR interpolator.
+                   <code>numTaps</code> must be a multiple of <code>L</code> and the filter is usually
+                   designed as a lowpass with a normalized cutoff frequency of <code>1/max(L,M)</code>
+                   and a gain of <code>L</code>.
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+                   Any number of input samples up to <code>blockSize</code> can be processed by a call:
+                   the instance keeps the position of the next output in the upsampled sequence,
+                   so the output does not depend on how the input is split into blocks.
+                   The functions return the number of output samples written, at most
+                   <code>RISCV_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize)</code>.
+
+  @par           Fixed-Point Behavior
+                   The fixed-point versions use the same 64-bit accumulators and scaling as
+                   \ref riscv_fir_interpolate_q31 and \ref riscv_fir_interpolate_q15.
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point FIR rational resampler.
+  @param[in,out] S          points to an instance of the floating-point FIR rational resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the <code>blockSize</code> given at initialization
+  @return        number of output samples written to <code>pDst</code>
+ */
+uint32_t riscv_fir_resample_f32(
+        riscv_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        uint32_t stepInt = S->M / L;                   /* Input samples between two outputs */
+        uint32_t stepFrac = S->M % L;                  /* Phase increment between two outputs */
+        uint32_t n, p;                                 /* Newest input sample and phase of the current output */
+        uint32_t outCnt = 0U;                          /* Number of output samples */
+        uint32_t tapCnt;                               /* Loop counter */
+
+#if defined (RISCV_MATH_VECTOR)
+  size_t l;
+  vfloat32m1_t v_sum;
+#else
+  float32_t sum0;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples, the new input data is written after them */
+  riscv_copy_f32(pSrc, pState + (phaseLen - 1U), blockSize);
+
+  n = S->phase / L;
+  p = S->phase % L;
+
+  while (n < blockSize)
+  {
+    /* Window of the phaseLen samples ending with x[n], coefficients of the polyphase component p */
+    px = pState + n;
+    pb = pCoeffs + (L - 1U - p);
+    tapCnt = phaseLen;
+
+#if defined (RISCV_MATH_VECTOR)
+    l = __riscv_vsetvl_e32m1(1);
+    v_sum = __riscv_vfmv_v_f_f32m1(0.0f, l);
+    for (; (l = __riscv_vsetvl_e32m8(tapCnt)) > 0; tapCnt -= l)
+    {
+      v_sum = __riscv_vfredusum_vs_f32m8_f32m1(__riscv_vfmul_vv_f32m8(__riscv_vle32_v_f32m8(px, l),
+                                               __riscv_vlse32_v_f32m8(pb, (ptrdiff_t) L * 4, l), l), v_sum, l);
+      px += l;
+      pb += l * L;
+    }
+    *pDst++ = __riscv_vfmv_f_s_f32m1_f32(v_sum);
+#else
+    sum0 = 0.0f;
+    while (tapCnt > 0U)
+    {
+      sum0 += *px++ * *pb;
+
+      /* Upsampling is done by stuffing L-1 zeros between each sample, only one coefficient out of L is used */
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+    *pDst++ = sum0;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+    outCnt++;
+
+    /* Next output is M samples later in the upsampled sequence */
+    n += stepInt;
+    p += stepFrac;
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output, relative to the next input block */
+  S->phase = (n - blockSize) * L + p;
+
+  /* Processing is complete.
+     Now copy the last phaseLen - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+  riscv_copy_f32(pState + blockSize, pState, phaseLen - 1U);
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
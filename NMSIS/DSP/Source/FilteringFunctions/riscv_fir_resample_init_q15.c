@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_resample_init_q15.c
+ * Description:  Q15 FIR rational resampler initialization function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 FIR rational resampler.
+  @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure
+  @param[in]     L          upsample factor
+  @param[in]     M          downsample factor
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficient buffer
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  maximum number of input samples to process per call
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>L</code> or <code>M</code> is zero
+                   - \ref RISCV_MATH_LENGTH_ERROR   : filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[numTaps-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   The length of the filter <code>numTaps</code> must be a multiple of the upsample factor <code>L</code>.
+                   <code>L/M</code> does not need to be an irreducible fraction, but reducing it gives the same output with
+                   a shorter filter.
+  @par
+                   <code>pState</code> points to the array of state variables.
+                   <code>pState</code> is of length <code>(numTaps/L)+blockSize-1</code> words
+                   where <code>blockSize</code> is the largest number of input samples processed by a call to <code>riscv_fir_resample_q15()</code>.
+ */
+
+riscv_status riscv_fir_resample_init_q15(
+        riscv_fir_resample_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize)
+{
+  riscv_status status;
+
+  if ((L == 0U) || (M == 0U))
+  {
+    /* Set status as RISCV_MATH_ARGUMENT_ERROR */
+    status = RISCV_MATH_ARGUMENT_ERROR;
+  }
+  /* The filter length must be a multiple of the upsample factor */
+  else if ((numTaps % L) != 0U)
+  {
+    /* Set status as RISCV_MATH_LENGTH_ERROR */
+    status = RISCV_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Assign resampling factors */
+    S->L = L;
+    S->M = M;
+
+    /* Assign polyPhaseLength */
+    S->phaseLength = numTaps / L;
+
+    /* The first output is the last sample of the first group of M upsampled samples */
+    S->phase = (uint32_t) M - 1U;
+
+    /* Clear state buffer and size of buffer is always phaseLength + blockSize - 1 */
+    memset(pState, 0, (blockSize + ((uint32_t) S->phaseLength - 1U)) * sizeof(q15_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_resample_q15.c
+ * Description:  Q15 FIR rational resampler
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 FIR rational resampler.
+  @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the <code>blockSize</code> given at initialization
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow in the accumulator.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+uint32_t riscv_fir_resample_q15(
+        riscv_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                 /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const q15_t *px;                                 /* Temporary pointer for state buffer */
+  const q15_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        uint32_t stepInt = S->M / L;                   /* Input samples between two outputs */
+        uint32_t stepFrac = S->M % L;                  /* Phase increment between two outputs */
+        uint32_t n, p;                                 /* Newest input sample and phase of the current output */
+        uint32_t outCnt = 0U;                          /* Number of output samples */
+        uint32_t tapCnt;                               /* Loop counter */
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  size_t l;
+  vint64m1_t v_sum;
+#else
+  q63_t sum0;
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples, the new input data is written after them */
+  riscv_copy_q15(pSrc, pState + (phaseLen - 1U), blockSize);
+
+  n = S->phase / L;
+  p = S->phase % L;
+
+  while (n < blockSize)
+  {
+    /* Window of the phaseLen samples ending with x[n], coefficients of the polyphase component p */
+    px = pState + n;
+    pb = pCoeffs + (L - 1U - p);
+    tapCnt = phaseLen;
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+    l = __riscv_vsetvl_e64m1(1);
+    v_sum = __riscv_vmv_v_x_i64m1(0, l);
+    for (; (l = __riscv_vsetvl_e16m2(tapCnt)) > 0; tapCnt -= l)
+    {
+      v_sum = __riscv_vwredsum_vs_i32m4_i64m1(__riscv_vwmul_vv_i32m4(__riscv_vle16_v_i16m2(px, l),
+                                              __riscv_vlse16_v_i16m2(pb, (ptrdiff_t) L * 2, l), l), v_sum, l);
+      px += l;
+      pb += l * L;
+    }
+    *pDst++ = (q15_t) (__SSAT((__riscv_vmv_x_s_i64m1_i64(v_sum) >> 15), 16));
+#else
+    sum0 = 0;
+    while (tapCnt > 0U)
+    {
+      sum0 += (q31_t) *px++ * *pb;
+
+      /* Upsampling is done by stuffing L-1 zeros between each sample, only one coefficient out of L is used */
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+    *pDst++ = (q15_t) (__SSAT((sum0 >> 15), 16));
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+    outCnt++;
+
+    /* Next output is M samples later in the upsampled sequence */
+    n += stepInt;
+    p += stepFrac;
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output, relative to the next input block */
+  S->phase = (n - blockSize) * L + p;
+
+  /* Processing is complete.
+     Now copy the last phaseLen - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+  riscv_copy_q15(pState + blockSize, pState, phaseLen - 1U);
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_resample_q31.c
+ * Description:  Q31 FIR rational resampler
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 FIR rational resampler.
+  @param[in,out] S          points to an instance of the Q31 FIR rational resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the <code>blockSize</code> given at initialization
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+                   Thus, if the accumulator result overflows it wraps around rather than clip.
+                   In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>.
+                   After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.31 format by discarding the low 31 bits.
+ */
+uint32_t riscv_fir_resample_q31(
+        riscv_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                 /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const q31_t *px;                                 /* Temporary pointer for state buffer */
+  const q31_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        uint32_t stepInt = S->M / L;                   /* Input samples between two outputs */
+        uint32_t stepFrac = S->M % L;                  /* Phase increment between two outputs */
+        uint32_t n, p;                                 /* Newest input sample and phase of the current output */
+        uint32_t outCnt = 0U;                          /* Number of output samples */
+        uint32_t tapCnt;                               /* Loop counter */
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  size_t l;
+  vint64m1_t v_sum;
+#else
+  q63_t sum0;
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples, the new input data is written after them */
+  riscv_copy_q31(pSrc, pState + (phaseLen - 1U), blockSize);
+
+  n = S->phase / L;
+  p = S->phase % L;
+
+  while (n < blockSize)
+  {
+    /* Window of the phaseLen samples ending with x[n], coefficients of the polyphase component p */
+    px = pState + n;
+    pb = pCoeffs + (L - 1U - p);
+    tapCnt = phaseLen;
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+    l = __riscv_vsetvl_e64m1(1);
+    v_sum = __riscv_vmv_v_x_i64m1(0, l);
+    for (; (l = __riscv_vsetvl_e32m4(tapCnt)) > 0; tapCnt -= l)
+    {
+      v_sum = __riscv_vredsum_vs_i64m8_i64m1(__riscv_vwmul_vv_i64m8(__riscv_vle32_v_i32m4(px, l),
+                                             __riscv_vlse32_v_i32m4(pb, (ptrdiff_t) L * 4, l), l), v_sum, l);
+      px += l;
+      pb += l * L;
+    }
+    *pDst++ = (q31_t) (__riscv_vmv_x_s_i64m1_i64(v_sum) >> 31);
+#else
+    sum0 = 0;
+    while (tapCnt > 0U)
+    {
+      sum0 += (q63_t) *px++ * *pb;
+
+      /* Upsampling is done by stuffing L-1 zeros between each sample, only one coefficient out of L is used */
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+    *pDst++ = (q31_t) (sum0 >> 31);
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+    outCnt++;
+
+    /* Next output is M samples later in the upsampled sequence */
+    n += stepInt;
+    p += stepFrac;
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output, relative to the next input block */
+  S->phase = (n - blockSize) * L + p;
+
+  /* Processing is complete.
+     Now copy the last phaseLen - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+  riscv_copy_q31(pState + blockSize, pState, phaseLen - 1U);
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
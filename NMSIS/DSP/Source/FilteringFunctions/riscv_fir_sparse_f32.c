@@ -29,6 +29,80 @@
 
 #include "dsp/filtering_functions.h"
 
+/*
+ * Sparse FIR filter without scratch buffers: each output reads its taps
+ * from the circular state buffer, with the read indices computed for a
+ * vector of taps and an indexed load.
+ */
+static void riscv_fir_sparse_gather_f32(
+  const riscv_fir_sparse_instance_f32 * S,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pState = S->pState;
+  const float32_t *pCoeffs = S->pCoeffs;
+  const int32_t *pTapDelay = S->pTapDelay;
+        int32_t delaySize = (int32_t) (S->maxDelay + blockSize);
+        int32_t writeIndex;                          /* State index of the current input sample */
+        uint32_t i, t;
+#if defined (RISCV_MATH_VECTOR)
+  size_t l;
+  vint32m4_t v_idx;
+  vuint32m4_t v_offset;
+  uint32_t tapCnt;
+  vfloat32m4_t v_x;
+  vfloat32m1_t v_sum;
+#else
+  int32_t readIndex;
+  float32_t sum;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  writeIndex = (int32_t) (S->stateIndex - blockSize);
+  if (writeIndex < 0)
+  {
+    writeIndex += delaySize;
+  }
+
+  for (i = 0U; i < blockSize; i++)
+  {
+#if defined (RISCV_MATH_VECTOR)
+    l = __riscv_vsetvl_e32m1(1);
+    v_sum = __riscv_vfmv_v_f_f32m1(0.0f, l);
+    t = 0U;
+    for (tapCnt = S->numTaps; (l = __riscv_vsetvl_e32m4(tapCnt)) > 0; tapCnt -= l)
+    {
+      /* Read indices writeIndex - pTapDelay[t], wrapped around the state buffer */
+      v_idx = __riscv_vrsub_vx_i32m4(__riscv_vle32_v_i32m4(pTapDelay + t, l), writeIndex, l);
+      v_idx = __riscv_vmerge_vvm_i32m4(v_idx, __riscv_vadd_vx_i32m4(v_idx, delaySize, l),
+                                       __riscv_vmslt_vx_i32m4_b8(v_idx, 0, l), l);
+      v_offset = __riscv_vreinterpret_v_i32m4_u32m4(__riscv_vsll_vx_i32m4(v_idx, 2, l));
+      v_x = __riscv_vluxei32_v_f32m4(pState, v_offset, l);
+      v_sum = __riscv_vfredusum_vs_f32m4_f32m1(__riscv_vfmul_vv_f32m4(v_x, __riscv_vle32_v_f32m4(pCoeffs + t, l), l), v_sum, l);
+      t += l;
+    }
+    pDst[i] = __riscv_vfmv_f_s_f32m1_f32(v_sum);
+#else
+    sum = 0.0f;
+    for (t = 0U; t < S->numTaps; t++)
+    {
+      readIndex = writeIndex - pTapDelay[t];
+      if (readIndex < 0)
+      {
+        readIndex += delaySize;
+      }
+      sum += pCoeffs[t] * pState[readIndex];
+    }
+    pDst[i] = sum;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+    writeIndex++;
+    if (writeIndex == delaySize)
+    {
+      writeIndex = 0;
+    }
+  }
+}
+
 /**
   @ingroup groupFilters
  */
@@ -64,6 +138,14 @@
                    <code>maxDelay</code> is the largest offset value that is ever used in the <code>pTapDelay</code> array.
                    Some of the processing functions also require temporary working buffers.
 
+  @par           No Scratch Mode
+                   When <code>pScratchIn</code> is NULL (and <code>pScratchOut</code> for the Q15 and Q7 versions),
+                   the temporary buffers are not used: each output sample reads its taps directly from the
+                   circular state buffer. With the vector extension, the read indices of a vector of taps are
+                   computed at once and the samples are fetched with an indexed load, which suits filters with
+                   many taps spread over long delays and small blocks. The fixed-point versions give the same
+                   result as the scalar code with the temporary buffers, the Q31 products are truncated.
+
   @par           Instance Structure
                    The coefficients and state variables for a filter are stored together in an instance data structure.
                    A separate instance structure must be defined for each filter.
@@ -106,7 +188,7 @@
   @param[in]     S           points to an instance of the floating-point sparse FIR structure
   @param[in]     pSrc        points to the block of input data
   @param[out]    pDst        points to the block of output data
-  @param[in]     pScratchIn  points to a temporary buffer of size blockSize
+  @param[in]     pScratchIn  points to a temporary buffer of size blockSize, or NULL
   @param[in]     blockSize   number of input samples to process
   @return        none
  */
@@ -136,6 +218,13 @@ void riscv_fir_sparse_f32(
   /* StateIndex points to the starting position to write in the state buffer */
   riscv_circularWrite_f32((int32_t *) py, delaySize, &S->stateIndex, 1, (int32_t *) pSrc, 1, blockSize);
 
+  /* No scratch buffer: the taps are read directly from the state buffer */
+  if (pScratchIn == NULL)
+  {
+    riscv_fir_sparse_gather_f32(S, pDst, blockSize);
+    return;
+  }
+
   /* Read Index, from where the state buffer should be read, is calculated. */
   readIndex = (int32_t) (S->stateIndex - blockSize) - *pTapDelay++;
 
@@ -29,6 +29,80 @@
 
 #include "dsp/filtering_functions.h"
 
+/*
+ * Sparse FIR filter without scratch buffers: each output reads its taps
+ * from the circular state buffer, with the read indices computed for a
+ * vector of taps and an indexed load.
+ */
+static void riscv_fir_sparse_gather_q15(
+  const riscv_fir_sparse_instance_q15 * S,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pState = S->pState;
+  const q15_t *pCoeffs = S->pCoeffs;
+  const int32_t *pTapDelay = S->pTapDelay;
+        int32_t delaySize = (int32_t) (S->maxDelay + blockSize);
+        int32_t writeIndex;                          /* State index of the current input sample */
+        uint32_t i, t;
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  size_t l;
+  vint32m4_t v_idx;
+  vuint32m4_t v_offset;
+  uint32_t tapCnt;
+  vint16m2_t v_x;
+  vint64m1_t v_sum;
+#else
+  int32_t readIndex;
+  q31_t sum;
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  writeIndex = (int32_t) (S->stateIndex - blockSize);
+  if (writeIndex < 0)
+  {
+    writeIndex += delaySize;
+  }
+
+  for (i = 0U; i < blockSize; i++)
+  {
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+    l = __riscv_vsetvl_e64m1(1);
+    v_sum = __riscv_vmv_v_x_i64m1(0, l);
+    t = 0U;
+    for (tapCnt = S->numTaps; (l = __riscv_vsetvl_e32m4(tapCnt)) > 0; tapCnt -= l)
+    {
+      /* Read indices writeIndex - pTapDelay[t], wrapped around the state buffer */
+      v_idx = __riscv_vrsub_vx_i32m4(__riscv_vle32_v_i32m4(pTapDelay + t, l), writeIndex, l);
+      v_idx = __riscv_vmerge_vvm_i32m4(v_idx, __riscv_vadd_vx_i32m4(v_idx, delaySize, l),
+                                       __riscv_vmslt_vx_i32m4_b8(v_idx, 0, l), l);
+      v_offset = __riscv_vreinterpret_v_i32m4_u32m4(__riscv_vsll_vx_i32m4(v_idx, 1, l));
+      v_x = __riscv_vluxei32_v_i16m2(pState, v_offset, l);
+      v_sum = __riscv_vwredsum_vs_i32m4_i64m1(__riscv_vwmul_vv_i32m4(v_x, __riscv_vle16_v_i16m2(pCoeffs + t, l), l), v_sum, l);
+      t += l;
+    }
+    pDst[i] = (q15_t) __SSAT(((q31_t) __riscv_vmv_x_s_i64m1_i64(v_sum)) >> 15, 16);
+#else
+    sum = 0;
+    for (t = 0U; t < S->numTaps; t++)
+    {
+      readIndex = writeIndex - pTapDelay[t];
+      if (readIndex < 0)
+      {
+        readIndex += delaySize;
+      }
+      sum += (q31_t) pState[readIndex] * pCoeffs[t];
+    }
+    pDst[i] = (q15_t) __SSAT(sum >> 15, 16);
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+    writeIndex++;
+    if (writeIndex == delaySize)
+    {
+      writeIndex = 0;
+    }
+  }
+}
+
 /**
   @ingroup groupFilters
  */
@@ -43,8 +117,8 @@
   @param[in]     S           points to an instance of the Q15 sparse FIR structure
   @param[in]     pSrc        points to the block of input data
   @param[out]    pDst        points to the block of output data
-  @param[in]     pScratchIn  points to a temporary buffer of size blockSize
-  @param[in]     pScratchOut points to a temporary buffer of size blockSize
+  @param[in]     pScratchIn  points to a temporary buffer of size blockSize, or NULL
+  @param[in]     pScratchOut points to a temporary buffer of size blockSize, or NULL
   @param[in]     blockSize   number of input samples to process per call
   @return        none
 
@@ -90,6 +164,13 @@ void riscv_fir_sparse_q15(
   /* StateIndex points to the starting position to write in the state buffer */
   riscv_circularWrite_q15(py, (int32_t) delaySize, &S->stateIndex, 1,pSrc, 1, blockSize);
 
+  /* No scratch buffer: the taps are read directly from the state buffer */
+  if (pScratchIn == NULL)
+  {
+    riscv_fir_sparse_gather_q15(S, pDst, blockSize);
+    return;
+  }
+
   /* Loop over the number of taps. */
   tapCnt = numTaps;
 
@@ -139,6 +139,114 @@ void riscv_iir_lattice_f32(
         float32_t v1, v2, v3, v4;
 #endif
 
+#if defined (RISCV_MATH_VECTOR)
+        size_t vlE, vlO;                                 /* Number of even and odd stages */
+        uint32_t step, numSteps;                         /* Wavefront step counters */
+        uint32_t firstLane, lastLane;                    /* Stage pairs working on a sample of the block */
+        uint32_t outLane;                                /* Stage pair holding the last stage */
+        float32_t in;                                    /* Input sample entering the first stage */
+        vfloat32m4_t v_kE, v_kO, v_vE, v_vO;             /* Coefficients of the even and odd stages */
+        vfloat32m4_t v_fE, v_gE, v_aE, v_fO, v_gO, v_aO; /* f, g and partial ladder sum leaving the stages */
+        vfloat32m4_t v_fin, v_gin, v_f, v_g;
+        vuint32m4_t v_idx;
+        vbool8_t v_last, v_mask;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+#if defined (RISCV_MATH_VECTOR)
+  /*
+   * Wavefront across stages and samples. Stage i of sample n needs f from stage i-1
+   * of sample n and g from stage i+1 of sample n-1, so it can run at step 2n+i.
+   * The even stages (lanes of v_xE) and the odd stages (lanes of v_xO) are processed
+   * in turn: at step s, lane j of both works on sample s-j. The partial ladder sum
+   * travels with f and the state is only written back at the end of the block.
+   * Filters longer than two vector register groups use the scalar code below.
+   */
+  vlO = numStages >> 1U;
+  vlE = __riscv_vsetvl_e32m4(numStages - vlO);
+  if (vlE == numStages - vlO)
+  {
+    outLane = vlE - 1U;
+    v_kE = __riscv_vlse32_v_f32m4(S->pkCoeffs, 2U * sizeof(float32_t), vlE);
+    v_vE = __riscv_vlse32_v_f32m4(S->pvCoeffs, 2U * sizeof(float32_t), vlE);
+    v_kO = __riscv_vlse32_v_f32m4(S->pkCoeffs + 1U, 2U * sizeof(float32_t), vlO);
+    v_vO = __riscv_vlse32_v_f32m4(S->pvCoeffs + 1U, 2U * sizeof(float32_t), vlO);
+    v_idx = __riscv_vid_v_u32m4(vlE);
+    v_last = __riscv_vmseq_vx_u32m4_b8(v_idx, outLane, vlE);
+
+    /* Stage i reads the g left by stage i+1 for the previous sample, state[i]; the last stage reads its own f */
+    v_gO = __riscv_vlse32_v_f32m4(pState, 2U * sizeof(float32_t), vlO);
+    v_gE = __riscv_vfslide1up_vf_f32m4(__riscv_vlse32_v_f32m4(pState + 1U, 2U * sizeof(float32_t), vlE - 1U), 0.0f, vlE);
+    v_fE = __riscv_vfmv_v_f_f32m4(pState[numStages - 1U], vlE);
+    v_fO = v_fE;
+    v_aO = __riscv_vfmv_v_f_f32m4(0.0f, vlE);
+
+    numSteps = blockSize + outLane;
+    for (step = 0U; step < numSteps; step++)
+    {
+      /* Lanes firstLane..lastLane work on a sample of the block, the others keep their state */
+      firstLane = (step >= blockSize) ? (step - blockSize + 1U) : 0U;
+      lastLane = (step < outLane) ? step : outLane;
+      v_mask = __riscv_vmsltu_vx_u32m4_b8(__riscv_vsub_vx_u32m4(v_idx, firstLane, vlE), lastLane + 1U - firstLane, vlE);
+
+      /* fN(n) = x(n) */
+      in = (step < blockSize) ? pSrc[step] : 0.0f;
+
+      /* Even stages: f from the previous odd stage, g from the next odd stage */
+      v_fin = __riscv_vfslide1up_vf_f32m4(v_fO, in, vlE);
+      v_gin = v_gO;
+      if (numStages & 1U)
+      {
+        v_gin = __riscv_vmerge_vvm_f32m4(v_gin, v_fE, v_last, vlE);
+      }
+      v_f = __riscv_vfnmsac_vv_f32m4(v_fin, v_kE, v_gin, vlE);
+      v_g = __riscv_vfmacc_vv_f32m4(v_gin, v_kE, v_f, vlE);
+      v_aE = __riscv_vfmacc_vv_f32m4(__riscv_vfslide1up_vf_f32m4(v_aO, 0.0f, vlE), v_vE, v_g, vlE);
+      v_fE = __riscv_vmerge_vvm_f32m4(v_fE, v_f, v_mask, vlE);
+      v_gE = __riscv_vmerge_vvm_f32m4(v_gE, v_g, v_mask, vlE);
+
+      /* Odd stages: f from the even stage of the same lane, g from the next even stage */
+      v_gin = __riscv_vslidedown_vx_f32m4(v_gE, 1U, vlO);
+      if ((numStages & 1U) == 0U)
+      {
+        v_gin = __riscv_vmerge_vvm_f32m4(v_gin, v_fO, v_last, vlO);
+      }
+      v_f = __riscv_vfnmsac_vv_f32m4(v_fE, v_kO, v_gin, vlO);
+      v_g = __riscv_vfmacc_vv_f32m4(v_gin, v_kO, v_f, vlO);
+      v_aO = __riscv_vfmacc_vv_f32m4(v_aE, v_vO, v_g, vlO);
+      v_fO = __riscv_vmerge_vvm_f32m4(v_fO, v_f, v_mask, vlO);
+      v_gO = __riscv_vmerge_vvm_f32m4(v_gO, v_g, v_mask, vlO);
+
+      /* y(n) = ladder sum + g0(n) * v0, leaving the last stage */
+      if (step >= outLane)
+      {
+        if (numStages & 1U)
+        {
+          v_f = v_fE;
+          v_g = v_aE;
+        }
+        else
+        {
+          v_f = v_fO;
+          v_g = v_aO;
+        }
+        pDst[step - outLane] = __riscv_vfmv_f_s_f32m4_f32(__riscv_vslidedown_vx_f32m4(v_g, outLane, vlE)) +
+                               __riscv_vfmv_f_s_f32m4_f32(__riscv_vslidedown_vx_f32m4(v_f, outLane, vlE)) * S->pvCoeffs[numStages];
+      }
+    }
+
+    /* New state of the next block */
+    __riscv_vsse32_v_f32m4(pState, 2U * sizeof(float32_t), v_gO, vlO);
+    __riscv_vsse32_v_f32m4(pState + 1U, 2U * sizeof(float32_t), __riscv_vslidedown_vx_f32m4(v_gE, 1U, vlE), vlE - 1U);
+    v_f = v_fO;
+    if (numStages & 1U)
+    {
+      v_f = v_fE;
+    }
+    pState[numStages - 1U] = __riscv_vfmv_f_s_f32m4_f32(__riscv_vslidedown_vx_f32m4(v_f, outLane, vlE));
+    return;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
   /* initialise loop count */
   blkCnt = blockSize;
 
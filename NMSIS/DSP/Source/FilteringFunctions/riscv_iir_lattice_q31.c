@@ -68,6 +68,115 @@ void riscv_iir_lattice_q31(
         uint32_t numStages = S->numStages;               /* Number of stages */
         uint32_t blkCnt, tapCnt;                         /* Temporary variables for counts */
 
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+        size_t vlE, vlO;                                 /* Number of even and odd stages */
+        uint32_t step, numSteps;                         /* Wavefront step counters */
+        uint32_t firstLane, lastLane;                    /* Stage pairs working on a sample of the block */
+        uint32_t outLane;                                /* Stage pair holding the last stage */
+        q31_t in;                                        /* Input sample entering the first stage */
+        vint32m4_t v_kE, v_kO, v_vE, v_vO;               /* Coefficients of the even and odd stages */
+        vint32m4_t v_fE, v_gE, v_fO, v_gO;               /* f and g leaving the stages */
+        vint64m8_t v_aE, v_aO;                           /* Partial ladder sums leaving the stages */
+        vint32m4_t v_fin, v_gin, v_f, v_g;
+        vuint32m4_t v_idx;
+        vbool8_t v_last, v_mask;
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  /*
+   * Wavefront across stages and samples. Stage i of sample n needs f from stage i-1
+   * of sample n and g from stage i+1 of sample n-1, so it can run at step 2n+i.
+   * The even stages (lanes of v_xE) and the odd stages (lanes of v_xO) are processed
+   * in turn: at step s, lane j of both works on sample s-j. The partial ladder sum
+   * travels with f and the state is only written back at the end of the block.
+   * Filters longer than two vector register groups use the scalar code below.
+   */
+  vlO = numStages >> 1U;
+  vlE = __riscv_vsetvl_e32m4(numStages - vlO);
+  if (vlE == numStages - vlO)
+  {
+    outLane = vlE - 1U;
+    v_kE = __riscv_vlse32_v_i32m4(S->pkCoeffs, 2U * sizeof(q31_t), vlE);
+    v_vE = __riscv_vlse32_v_i32m4(S->pvCoeffs, 2U * sizeof(q31_t), vlE);
+    v_kO = __riscv_vlse32_v_i32m4(S->pkCoeffs + 1U, 2U * sizeof(q31_t), vlO);
+    v_vO = __riscv_vlse32_v_i32m4(S->pvCoeffs + 1U, 2U * sizeof(q31_t), vlO);
+    v_idx = __riscv_vid_v_u32m4(vlE);
+    v_last = __riscv_vmseq_vx_u32m4_b8(v_idx, outLane, vlE);
+
+    /* Stage i reads the g left by stage i+1 for the previous sample, state[i]; the last stage reads its own f */
+    v_gO = __riscv_vlse32_v_i32m4(pState, 2U * sizeof(q31_t), vlO);
+    v_gE = __riscv_vslide1up_vx_i32m4(__riscv_vlse32_v_i32m4(pState + 1U, 2U * sizeof(q31_t), vlE - 1U), 0, vlE);
+    v_fE = __riscv_vmv_v_x_i32m4(pState[numStages - 1U], vlE);
+    v_fO = v_fE;
+    v_aO = __riscv_vmv_v_x_i64m8(0, vlE);
+
+    numSteps = blockSize + outLane;
+    for (step = 0U; step < numSteps; step++)
+    {
+      /* Lanes firstLane..lastLane work on a sample of the block, the others keep their state */
+      firstLane = (step >= blockSize) ? (step - blockSize + 1U) : 0U;
+      lastLane = (step < outLane) ? step : outLane;
+      v_mask = __riscv_vmsltu_vx_u32m4_b8(__riscv_vsub_vx_u32m4(v_idx, firstLane, vlE), lastLane + 1U - firstLane, vlE);
+
+      /* fN(n) = x(n) */
+      in = (step < blockSize) ? pSrc[step] : 0;
+
+      /* Even stages: f from the previous odd stage, g from the next odd stage */
+      v_fin = __riscv_vslide1up_vx_i32m4(v_fO, in, vlE);
+      v_gin = v_gO;
+      if (numStages & 1U)
+      {
+        v_gin = __riscv_vmerge_vvm_i32m4(v_gin, v_fE, v_last, vlE);
+      }
+      v_f = __riscv_vssub_vv_i32m4(v_fin, __riscv_vnsra_wx_i32m4(__riscv_vwmul_vv_i64m8(v_gin, v_kE, vlE), 31U, vlE), vlE);
+      v_g = __riscv_vsadd_vv_i32m4(v_gin, __riscv_vnsra_wx_i32m4(__riscv_vwmul_vv_i64m8(v_f, v_kE, vlE), 31U, vlE), vlE);
+      v_aE = __riscv_vwmacc_vv_i64m8(__riscv_vslide1up_vx_i64m8(v_aO, 0, vlE), v_g, v_vE, vlE);
+      v_fE = __riscv_vmerge_vvm_i32m4(v_fE, v_f, v_mask, vlE);
+      v_gE = __riscv_vmerge_vvm_i32m4(v_gE, v_g, v_mask, vlE);
+
+      /* Odd stages: f from the even stage of the same lane, g from the next even stage */
+      v_gin = __riscv_vslidedown_vx_i32m4(v_gE, 1U, vlO);
+      if ((numStages & 1U) == 0U)
+      {
+        v_gin = __riscv_vmerge_vvm_i32m4(v_gin, v_fO, v_last, vlO);
+      }
+      v_f = __riscv_vssub_vv_i32m4(v_fE, __riscv_vnsra_wx_i32m4(__riscv_vwmul_vv_i64m8(v_gin, v_kO, vlO), 31U, vlO), vlO);
+      v_g = __riscv_vsadd_vv_i32m4(v_gin, __riscv_vnsra_wx_i32m4(__riscv_vwmul_vv_i64m8(v_f, v_kO, vlO), 31U, vlO), vlO);
+      v_aO = __riscv_vwmacc_vv_i64m8(v_aE, v_g, v_vO, vlO);
+      v_fO = __riscv_vmerge_vvm_i32m4(v_fO, v_f, v_mask, vlO);
+      v_gO = __riscv_vmerge_vvm_i32m4(v_gO, v_g, v_mask, vlO);
+
+      /* y(n) = ladder sum + g0(n) * v0, leaving the last stage */
+      if (step >= outLane)
+      {
+        if (numStages & 1U)
+        {
+          v_f = v_fE;
+          acc = __riscv_vmv_x_s_i64m8_i64(__riscv_vslidedown_vx_i64m8(v_aE, outLane, vlE));
+        }
+        else
+        {
+          v_f = v_fO;
+          acc = __riscv_vmv_x_s_i64m8_i64(__riscv_vslidedown_vx_i64m8(v_aO, outLane, vlE));
+        }
+        acc += ((q63_t) __riscv_vmv_x_s_i32m4_i32(__riscv_vslidedown_vx_i32m4(v_f, outLane, vlE)) * S->pvCoeffs[numStages]);
+        pDst[step - outLane] = (q31_t) (acc >> 31U);
+      }
+    }
+
+    /* New state of the next block */
+    __riscv_vsse32_v_i32m4(pState, 2U * sizeof(q31_t), v_gO, vlO);
+    __riscv_vsse32_v_i32m4(pState + 1U, 2U * sizeof(q31_t), __riscv_vslidedown_vx_i32m4(v_gE, 1U, vlE), vlE - 1U);
+    v_f = v_fO;
+    if (numStages & 1U)
+    {
+      v_f = v_fE;
+    }
+    pState[numStages - 1U] = __riscv_vmv_x_s_i32m4_i32(__riscv_vslidedown_vx_i32m4(v_f, outLane, vlE));
+    return;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
 
   /* initialise loop count */
   blkCnt = blockSize;
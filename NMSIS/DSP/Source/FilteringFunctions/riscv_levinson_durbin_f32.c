@@ -29,32 +29,13 @@
 
 #include "dsp/filtering_functions.h"
 
-/**
-  @ingroup groupFilters
- */
-
-/**
-  @defgroup LD Levinson Durbin Algorithm
-
- */
-
-/**
-  @addtogroup LD
-  @{
- */
-
-/**
-  @brief         Levinson Durbin
-  @param[in]     phi      autocovariance vector starting with lag 0 (length is nbCoefs + 1)
-  @param[out]    a        autoregressive coefficients
-  @param[out]    err      prediction error (variance)
-  @param[in]     nbCoefs  number of autoregressive coefficients
-  @return        none
+/*
+ * Levinson Durbin recursion. When k is not NULL, the reflection coefficient of
+ * each order, a[p] at the end of step p, is also written to k[p].
  */
-
-
-void riscv_levinson_durbin_f32(const float32_t *phi,
-  float32_t *a, 
+void riscv_levinson_durbin_reflect_f32(const float32_t *phi,
+  float32_t *a,
+  float32_t *k,
   float32_t *err,
   int nbCoefs)
 {
@@ -62,53 +43,133 @@ void riscv_levinson_durbin_f32(const float32_t *phi,
    int p;
 
    a[0] = phi[1] / phi[0];
+   if (k != NULL)
+   {
+      k[0] = a[0];
+   }
 
    e = phi[0] - phi[1] * a[0];
    for(p = 1; p < nbCoefs; p++)
    {
       float32_t suma=0.0f;
       float32_t sumb=0.0f;
-      float32_t k;
+      float32_t kp;
       int nb, j, i;
 
+#if defined (RISCV_MATH_VECTOR)
+      uint32_t blkCnt;
+      size_t l;
+      vfloat32m1_t v_suma, v_sumb;
+      vfloat32m4_t v_x, v_y;
+
+      l = __riscv_vsetvl_e32m1(1);
+      v_suma = __riscv_vfmv_v_f_f32m1(0.0f, l);
+      v_sumb = __riscv_vfmv_v_f_f32m1(0.0f, l);
+      i = 0;
+      for (blkCnt = p; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+         v_x = __riscv_vle32_v_f32m4(a + i, l);
+         /* phi[p - i] is read backwards */
+         v_y = __riscv_vlse32_v_f32m4(phi + p - i, -(ptrdiff_t) sizeof(float32_t), l);
+         v_suma = __riscv_vfredusum_vs_f32m4_f32m1(__riscv_vfmul_vv_f32m4(v_x, v_y, l), v_suma, l);
+         v_y = __riscv_vle32_v_f32m4(phi + i + 1, l);
+         v_sumb = __riscv_vfredusum_vs_f32m4_f32m1(__riscv_vfmul_vv_f32m4(v_x, v_y, l), v_sumb, l);
+         i += l;
+      }
+      suma = __riscv_vfmv_f_s_f32m1_f32(v_suma);
+      sumb = __riscv_vfmv_f_s_f32m1_f32(v_sumb);
+#else
       for(i = 0; i < p; i++)
       {
          suma += a[i] * phi[p - i];
          sumb += a[i] * phi[i + 1];
       }
+#endif /* defined (RISCV_MATH_VECTOR) */
 
-      k = (phi[p+1]-suma)/(phi[0] - sumb);
+      kp = (phi[p+1]-suma)/(phi[0] - sumb);
 
 
       nb = p >> 1;
       j = 0;
+#if defined (RISCV_MATH_VECTOR)
+      vfloat32m4_t v_nx, v_ny;
+
+      /* a[j] and a[p-1-j] are updated together, the second one is read and written backwards */
+      for (blkCnt = nb; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+         v_x = __riscv_vle32_v_f32m4(a + j, l);
+         v_y = __riscv_vlse32_v_f32m4(a + p - 1 - j, -(ptrdiff_t) sizeof(float32_t), l);
+         v_nx = __riscv_vfnmsac_vf_f32m4(v_x, kp, v_y, l);
+         v_ny = __riscv_vfnmsac_vf_f32m4(v_y, kp, v_x, l);
+         __riscv_vse32_v_f32m4(a + j, v_nx, l);
+         __riscv_vsse32_v_f32m4(a + p - 1 - j, -(ptrdiff_t) sizeof(float32_t), v_ny, l);
+         j += l;
+      }
+#else
       for(i = 0; i < nb; i++)
       {
           float32_t x,y;
 
-          x=a[j] - k * a[p-1-j];
-          y=a[p-1-j] - k * a[j];
+          x=a[j] - kp * a[p-1-j];
+          y=a[p-1-j] - kp * a[j];
 
           a[j] = x;
           a[p-1-j] = y;
 
           j++;
       }
+#endif /* defined (RISCV_MATH_VECTOR) */
 
       nb = p & 1;
       if (nb)
       {
-            a[j]=a[j]- k * a[p-1-j];
+            a[j]=a[j]- kp * a[p-1-j];
       }
 
-      a[p] = k;
-      e = e * (1.0f - k*k);
+      a[p] = kp;
+      if (k != NULL)
+      {
+         k[p] = kp;
+      }
+      e = e * (1.0f - kp*kp);
 
 
    }
    *err = e;
 }
 
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LD Levinson Durbin Algorithm
+
+ */
+
+/**
+  @addtogroup LD
+  @{
+ */
+
+/**
+  @brief         Levinson Durbin
+  @param[in]     phi      autocovariance vector starting with lag 0 (length is nbCoefs + 1)
+  @param[out]    a        autoregressive coefficients
+  @param[out]    err      prediction error (variance)
+  @param[in]     nbCoefs  number of autoregressive coefficients
+  @return        none
+ */
+
+
+void riscv_levinson_durbin_f32(const float32_t *phi,
+  float32_t *a, 
+  float32_t *err,
+  int nbCoefs)
+{
+   riscv_levinson_durbin_reflect_f32(phi, a, NULL, err, nbCoefs);
+}
+
 /**
   @} end of LD group
  */
@@ -90,30 +90,13 @@ __STATIC_FORCEINLINE q31_t divide(q31_t n, q31_t d)
   
 }
 
-/**
-  @ingroup groupFilters
- */
-
-
-
-/**
-  @addtogroup LD
-  @{
- */
-
-/**
-  @brief         Levinson Durbin
-  @param[in]     phi      autocovariance vector starting with lag 0 (length is nbCoefs + 1)
-  @param[out]    a        autoregressive coefficients
-  @param[out]    err      prediction error (variance)
-  @param[in]     nbCoefs  number of autoregressive coefficients
-  @return        none
+/*
+ * Levinson Durbin recursion. When k is not NULL, the reflection coefficient of
+ * each order, a[p] at the end of step p, is also written to k[p].
  */
-
-
-
-void riscv_levinson_durbin_q31(const q31_t *phi,
-  q31_t *a, 
+void riscv_levinson_durbin_reflect_q31(const q31_t *phi,
+  q31_t *a,
+  q31_t *k,
   q31_t *err,
   int nbCoefs)
 {
@@ -122,7 +105,10 @@ void riscv_levinson_durbin_q31(const q31_t *phi,
 
    //a[0] = phi[1] / phi[0];
    a[0] = divide(phi[1], phi[0]);
-   
+   if (k != NULL)
+   {
+      k[0] = a[0];
+   }
 
    //e = phi[0] - phi[1] * a[0];
    e = phi[0] - mul32x32(phi[1],a[0]);
@@ -131,14 +117,38 @@ void riscv_levinson_durbin_q31(const q31_t *phi,
    {
       q63_t suma=0;
       q63_t sumb=0;
-      q31_t k;
+      q31_t kp;
       int nb, j, i;
 
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+      uint32_t blkCnt;
+      size_t l;
+      vint64m1_t v_suma, v_sumb;
+      vint32m4_t v_x, v_y;
+
+      l = __riscv_vsetvl_e64m1(1);
+      v_suma = __riscv_vmv_v_x_i64m1(0, l);
+      v_sumb = __riscv_vmv_v_x_i64m1(0, l);
+      i = 0;
+      for (blkCnt = p; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+         v_x = __riscv_vle32_v_i32m4(a + i, l);
+         /* phi[p - i] is read backwards */
+         v_y = __riscv_vlse32_v_i32m4(phi + p - i, -(ptrdiff_t) sizeof(q31_t), l);
+         v_suma = __riscv_vredsum_vs_i64m8_i64m1(__riscv_vwmul_vv_i64m8(v_x, v_y, l), v_suma, l);
+         v_y = __riscv_vle32_v_i32m4(phi + i + 1, l);
+         v_sumb = __riscv_vredsum_vs_i64m8_i64m1(__riscv_vwmul_vv_i64m8(v_x, v_y, l), v_sumb, l);
+         i += l;
+      }
+      suma = __riscv_vmv_x_s_i64m1_i64(v_suma);
+      sumb = __riscv_vmv_x_s_i64m1_i64(v_sumb);
+#else
       for(i = 0; i < p; i++)
       {
          suma += ((q63_t)a[i] * phi[p - i]);
          sumb += ((q63_t)a[i] * phi[i + 1]);
       }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
 
       suma = suma >> 31;
       sumb = sumb >> 31;
@@ -146,44 +156,94 @@ void riscv_levinson_durbin_q31(const q31_t *phi,
 
 
       //k = (phi[p+1]-suma)/(phi[0] - sumb);
-      k = divide(phi[p+1]-(q31_t)suma,phi[0] - (q31_t)sumb);
+      kp = divide(phi[p+1]-(q31_t)suma,phi[0] - (q31_t)sumb);
 
 
       nb = p >> 1;
       j = 0;
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+      vint32m4_t v_nx, v_ny;
+
+      /* a[j] and a[p-1-j] are updated together, the second one is read and written backwards */
+      for (blkCnt = nb; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+         v_x = __riscv_vle32_v_i32m4(a + j, l);
+         v_y = __riscv_vlse32_v_i32m4(a + p - 1 - j, -(ptrdiff_t) sizeof(q31_t), l);
+         v_nx = __riscv_vsub_vv_i32m4(v_x, __riscv_vnsra_wx_i32m4(__riscv_vwmul_vx_i64m8(v_y, kp, l), 31, l), l);
+         v_ny = __riscv_vsub_vv_i32m4(v_y, __riscv_vnsra_wx_i32m4(__riscv_vwmul_vx_i64m8(v_x, kp, l), 31, l), l);
+         __riscv_vse32_v_i32m4(a + j, v_nx, l);
+         __riscv_vsse32_v_i32m4(a + p - 1 - j, -(ptrdiff_t) sizeof(q31_t), v_ny, l);
+         j += l;
+      }
+#else
       for(i = 0; i < nb; i++)
       {
           q31_t x,y;
 
           //x = a[j] - k * a[p-1-j];
-          x = a[j] - mul32x32(k,a[p-1-j]);
+          x = a[j] - mul32x32(kp,a[p-1-j]);
 
           //y = a[p-1-j] - k * a[j];
-          y = a[p-1-j] - mul32x32(k , a[j]);
+          y = a[p-1-j] - mul32x32(kp , a[j]);
 
           a[j] = x;
           a[p-1-j] = y;
 
           j++;
       }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
 
       nb = p & 1;
       if (nb)
       {
             //a[j] = a[j]- k * a[p-1-j];
-            a[j] = a[j] - mul32x32(k,a[p-1-j]);
+            a[j] = a[j] - mul32x32(kp,a[p-1-j]);
       }
 
-      a[p] = k;
+      a[p] = kp;
+      if (k != NULL)
+      {
+         k[p] = kp;
+      }
 
       // e = e * (1 - k*k);
-      e = mul32x32(e,ONE_Q31 - mul32x32(k,k));
+      e = mul32x32(e,ONE_Q31 - mul32x32(kp,kp));
 
 
    }
    *err = e;
 }
 
+/**
+  @ingroup groupFilters
+ */
+
+
+
+/**
+  @addtogroup LD
+  @{
+ */
+
+/**
+  @brief         Levinson Durbin
+  @param[in]     phi      autocovariance vector starting with lag 0 (length is nbCoefs + 1)
+  @param[out]    a        autoregressive coefficients
+  @param[out]    err      prediction error (variance)
+  @param[in]     nbCoefs  number of autoregressive coefficients
+  @return        none
+ */
+
+
+
+void riscv_levinson_durbin_q31(const q31_t *phi,
+  q31_t *a, 
+  q31_t *err,
+  int nbCoefs)
+{
+   riscv_levinson_durbin_reflect_q31(phi, a, NULL, err, nbCoefs);
+}
+
 /**
   @} end of LD group
  */
@@ -0,0 +1,282 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_lms_fd_f32.c
+ * Description:  Processing function for the floating-point frequency domain block LMS filter
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/support_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+float32_t * riscv_fir_partitioned_block_f32(
+  riscv_fir_partitioned_instance_f32 * S);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LMS_FD Frequency Domain Block LMS Filters
+
+  This set of functions implements a normalized LMS adaptive filter in the frequency
+  domain, also known as partitioned block frequency domain adaptive filter or multidelay
+  filter (MDF). It has the same inputs and outputs as \ref riscv_lms_norm_f32 but the
+  coefficients are updated once per block of <code>blockLen</code> samples, with a cost
+  per sample that grows with <code>log2(blockLen)</code> and <code>numTaps / blockLen</code>
+  instead of <code>numTaps</code>. It is intended for long filters such as acoustic echo
+  cancellers with 1024 to 4096 taps.
+
+  @par           Algorithm
+                   The filter is a \ref FIR_Partitioned filter whose coefficient spectra are
+                   adapted. For each block of <code>blockLen</code> input samples:
+                   - the output block <code>y</code> is computed by the partitioned overlap-save
+                     filter and the error is <code>e = d - y</code>;
+                   - <code>E</code> is the spectrum of <code>blockLen</code> zeros followed by <code>e</code>;
+                   - the power of each frequency bin of the input is smoothed:
+  <pre>
+      P[k] = lambda * P[k] + (1 - lambda) * |X[k]|^2
+  </pre>
+                   - the gradient of partition p is the correlation of its input spectrum with
+                     the error, normalized per frequency bin:
+  <pre>
+      G[k] = mu * conj(X_p[k]) * E[k] / (numParts * P[k] / 2 + delta)
+  </pre>
+                   - the gradient is constrained: it is transformed back to the time domain, the
+                     second half is cleared so that it stays a causal filter of <code>blockLen</code>
+                     taps, and the result is transformed again and added to the coefficient spectrum.
+  @par
+                   The power of a window of <code>2*blockLen</code> samples is twice the energy of a block,
+                   hence the factor 2: with <code>mu = 1</code> the update of each block is the one of a
+                   block normalized LMS with a unit step.
+                   <code>delta</code> is the same small constant as in \ref riscv_lms_norm_f32. The
+                   per-bin normalization gives each frequency the same convergence rate, which matters
+                   for colored signals such as speech. The update uses <code>2 + 2*numParts</code>
+                   real transforms of length <code>2*blockLen</code> per block, in addition to the
+                   two of the filter.
+
+  @par           Instance Structure
+                   The coefficient spectra and state variables for a filter are stored together
+                   in an instance data structure. Unlike \ref FIR_Partitioned, the coefficient
+                   spectra are modified and cannot be shared between instances.
+
+  @par           Initialization Functions
+                   The initialization function computes the spectra of the initial coefficients,
+                   initializes the real FFT and zeros out the state buffer. Supported values of
+                   <code>blockLen</code> are 16, 32, 64, ..., 2048. The buffers are sized with
+                   <code>RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen)</code> and
+                   <code>RISCV_LMS_FD_STATE_SIZE_F32(numTaps, blockLen)</code>.
+
+  @par           Parameters
+                   <code>mu</code> is the normalized step size, between 0 and 1. Values close to 1
+                   give the fastest convergence, smaller values a lower misadjustment.
+                   <code>lambda</code> sets the time constant of the power estimate, in blocks:
+                   <code>1 / (1 - lambda)</code>. A value around 0.9 is a good starting point.
+ */
+
+/**
+  @addtogroup LMS_FD
+  @{
+ */
+
+/**
+  @brief         Processing function for floating-point frequency domain block LMS filter.
+  @param[in,out] S          points to an instance of the floating-point frequency domain block LMS filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     pRef       points to the block of reference data
+  @param[out]    pOut       points to the block of output data
+  @param[out]    pErr       points to the block of error data
+  @param[in]     blockSize  number of samples to process, a multiple of <code>S->Sfir.blockLen</code>
+  @return        none
+ */
+void riscv_lms_fd_f32(
+        riscv_lms_fd_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize)
+{
+  riscv_fir_partitioned_instance_f32 *Sf = &(S->Sfir);
+  uint32_t blockLen = Sf->blockLen;
+  uint32_t fftLen = 2U * blockLen;
+  uint32_t numParts = Sf->numParts;
+  float32_t *pFdl = Sf->pState + fftLen;                    /* Frequency-domain delay line */
+  float32_t *pErrSpec = pFdl + numParts * fftLen;           /* Normalized error spectrum */
+  float32_t *pGrad = pErrSpec + fftLen;                     /* Gradient spectrum */
+  float32_t *pTime = pGrad + fftLen;                        /* Time domain work buffer */
+  float32_t *pPower = pTime + fftLen;                       /* Smoothed power of the input bins */
+  float32_t mu = S->mu;
+  float32_t lambda = S->lambda;
+  float32_t norm = 0.5f * (float32_t) numParts;             /* |X|^2 of a window is twice the block energy */
+  const float32_t *pX;
+  float32_t *pW;
+  uint32_t blkCnt, p, slot, newest;
+
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t cnt;
+  size_t l;
+  const float32_t *pXv;
+  float32_t *pEv, *pPv, *pGv;
+  vfloat32m4x2_t v_x, v_e;
+  vfloat32m4_t v_xr, v_xi, v_er, v_ei, v_p, v_s, v_gr, v_gi;
+#else
+  uint32_t k;
+  float32_t xr, xi, er, ei, step;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  blkCnt = blockSize / blockLen;
+
+  while (blkCnt > 0U)
+  {
+    /* Filter output and error */
+    riscv_copy_f32(pSrc, Sf->pState + blockLen, blockLen);
+    riscv_copy_f32(riscv_fir_partitioned_block_f32(Sf), pOut, blockLen);
+    riscv_sub_f32(pRef, pOut, pErr, blockLen);
+
+    /* Spectrum of the error, zero padded in front to match the second half of the window */
+    riscv_fill_f32(0.0f, pTime, blockLen);
+    riscv_copy_f32(pErr, pTime + blockLen, blockLen);
+    riscv_rfft_fast_f32(&(Sf->rfft), pTime, pErrSpec, 0);
+
+    /* The delay line has advanced, the spectrum of the current window is the previous slot */
+    newest = (Sf->fdlIndex == 0U) ? (numParts - 1U) : (Sf->fdlIndex - 1U);
+    pX = pFdl + newest * fftLen;
+
+    /* Per-bin power update and normalization of the error spectrum. DC and Nyquist terms are real */
+    pPower[0] = lambda * pPower[0] + (1.0f - lambda) * pX[0] * pX[0];
+    pPower[blockLen] = lambda * pPower[blockLen] + (1.0f - lambda) * pX[1] * pX[1];
+    pErrSpec[0] *= mu / (norm * pPower[0] + 0.000000119209289f);
+    pErrSpec[1] *= mu / (norm * pPower[blockLen] + 0.000000119209289f);
+
+#if defined (RISCV_MATH_VECTOR)
+    pXv = pX + 2;
+    pEv = pErrSpec + 2;
+    pPv = pPower + 1;
+    cnt = blockLen - 1U;
+    for (; (l = __riscv_vsetvl_e32m4(cnt)) > 0; cnt -= l)
+    {
+      v_x = __riscv_vlseg2e32_v_f32m4x2(pXv, l);
+      v_xr = __riscv_vget_v_f32m4x2_f32m4(v_x, 0);
+      v_xi = __riscv_vget_v_f32m4x2_f32m4(v_x, 1);
+      v_p = __riscv_vfmul_vv_f32m4(v_xr, v_xr, l);
+      v_p = __riscv_vfmacc_vv_f32m4(v_p, v_xi, v_xi, l);
+      v_p = __riscv_vfmul_vf_f32m4(v_p, 1.0f - lambda, l);
+      v_p = __riscv_vfmacc_vf_f32m4(v_p, lambda, __riscv_vle32_v_f32m4(pPv, l), l);
+      __riscv_vse32_v_f32m4(pPv, v_p, l);
+      v_s = __riscv_vfrdiv_vf_f32m4(__riscv_vfadd_vf_f32m4(__riscv_vfmul_vf_f32m4(v_p, norm, l),
+                                                           0.000000119209289f, l), mu, l);
+      v_e = __riscv_vlseg2e32_v_f32m4x2(pEv, l);
+      v_er = __riscv_vfmul_vv_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_e, 0), v_s, l);
+      v_ei = __riscv_vfmul_vv_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_e, 1), v_s, l);
+      v_e = __riscv_vset_v_f32m4_f32m4x2(v_e, 0, v_er);
+      v_e = __riscv_vset_v_f32m4_f32m4x2(v_e, 1, v_ei);
+      __riscv_vsseg2e32_v_f32m4x2(pEv, v_e, l);
+      pXv += 2U * l;
+      pEv += 2U * l;
+      pPv += l;
+    }
+#else
+    for (k = 1U; k < blockLen; k++)
+    {
+      xr = pX[2U * k];
+      xi = pX[2U * k + 1U];
+      pPower[k] = lambda * pPower[k] + (1.0f - lambda) * (xr * xr + xi * xi);
+      step = mu / (norm * pPower[k] + 0.000000119209289f);
+      pErrSpec[2U * k] *= step;
+      pErrSpec[2U * k + 1U] *= step;
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+    /* Constrained gradient of each partition */
+    slot = newest;
+    for (p = 0U; p < numParts; p++)
+    {
+      pX = pFdl + slot * fftLen;
+      pW = S->pCoeffSpectra + p * fftLen;
+
+      pGrad[0] = pX[0] * pErrSpec[0];
+      pGrad[1] = pX[1] * pErrSpec[1];
+#if defined (RISCV_MATH_VECTOR)
+      pXv = pX + 2;
+      pEv = pErrSpec + 2;
+      pGv = pGrad + 2;
+      cnt = blockLen - 1U;
+      for (; (l = __riscv_vsetvl_e32m4(cnt)) > 0; cnt -= l)
+      {
+        v_x = __riscv_vlseg2e32_v_f32m4x2(pXv, l);
+        v_e = __riscv_vlseg2e32_v_f32m4x2(pEv, l);
+        v_xr = __riscv_vget_v_f32m4x2_f32m4(v_x, 0);
+        v_xi = __riscv_vget_v_f32m4x2_f32m4(v_x, 1);
+        v_er = __riscv_vget_v_f32m4x2_f32m4(v_e, 0);
+        v_ei = __riscv_vget_v_f32m4x2_f32m4(v_e, 1);
+        /* conj(X) * E */
+        v_gr = __riscv_vfmul_vv_f32m4(v_xr, v_er, l);
+        v_gr = __riscv_vfmacc_vv_f32m4(v_gr, v_xi, v_ei, l);
+        v_gi = __riscv_vfmul_vv_f32m4(v_xr, v_ei, l);
+        v_gi = __riscv_vfnmsac_vv_f32m4(v_gi, v_xi, v_er, l);
+        v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 0, v_gr);
+        v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 1, v_gi);
+        __riscv_vsseg2e32_v_f32m4x2(pGv, v_x, l);
+        pXv += 2U * l;
+        pEv += 2U * l;
+        pGv += 2U * l;
+      }
+#else
+      for (k = 2U; k < fftLen; k += 2U)
+      {
+        xr = pX[k];
+        xi = pX[k + 1U];
+        er = pErrSpec[k];
+        ei = pErrSpec[k + 1U];
+        /* conj(X) * E */
+        pGrad[k]      = xr * er + xi * ei;
+        pGrad[k + 1U] = xr * ei - xi * er;
+      }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+      /* Keep the first blockLen taps of the correlation */
+      riscv_rfft_fast_f32(&(Sf->rfft), pGrad, pTime, 1);
+      riscv_fill_f32(0.0f, pTime + blockLen, blockLen);
+      riscv_rfft_fast_f32(&(Sf->rfft), pTime, pGrad, 0);
+      riscv_add_f32(pW, pGrad, pW, fftLen);
+
+      slot = (slot == 0U) ? (numParts - 1U) : (slot - 1U);
+    }
+
+    pSrc += blockLen;
+    pRef += blockLen;
+    pOut += blockLen;
+    pErr += blockLen;
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of LMS_FD group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_lms_fd_init_f32.c
+ * Description:  Initialization function for the floating-point frequency domain block LMS filter
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LMS_FD
+  @{
+ */
+
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
+/**
+  @brief         Initialization function for floating-point frequency domain block LMS filter.
+  @param[in,out] S              points to an instance of the floating-point frequency domain block LMS filter structure
+  @param[in]     numTaps        number of filter coefficients
+  @param[in]     pCoeffs        points to the initial filter coefficients
+  @param[out]    pCoeffSpectra  points to a buffer of <code>RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen)</code>
+                                values receiving the adapted coefficient spectra
+  @param[in]     pState         points to a state buffer of <code>RISCV_LMS_FD_STATE_SIZE_F32(numTaps, blockLen)</code> values
+  @param[in]     blockLen       block length, a power of 2 between 16 and 2048
+  @param[in]     mu             normalized step size
+  @param[in]     lambda         forgetting factor of the per-bin power estimate
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>blockLen</code> is not a supported length or <code>numTaps</code> is 0
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of initial coefficients stored in time reversed order,
+                   as for \ref riscv_lms_norm_init_f32:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   The coefficients are only used by this function, the filter adapts their spectra.
+                   When <code>numTaps</code> is not a multiple of <code>blockLen</code>, the adaptive filter
+                   has <code>numParts*blockLen</code> taps and the missing initial coefficients are zero.
+ */
+riscv_status riscv_lms_fd_init_f32(
+        riscv_lms_fd_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen,
+        float32_t mu,
+        float32_t lambda)
+{
+  riscv_status status;
+
+  status = riscv_fir_partitioned_init_f32(&(S->Sfir), numTaps, pCoeffs, pCoeffSpectra, pState, blockLen);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->pCoeffSpectra = pCoeffSpectra;
+  S->mu = mu;
+  S->lambda = lambda;
+
+  /* Clear the work buffer and the power estimate that follow the partitioned filter state */
+  riscv_fill_f32(0.0f, pState + RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen), 3U * blockLen + 1U);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+  @brief         Initialization function for floating-point frequency domain block LMS filter with FFT tables computed at runtime.
+  @param[in,out] S              points to an instance of the floating-point frequency domain block LMS filter structure
+  @param[in]     numTaps        number of filter coefficients
+  @param[in]     pCoeffs        points to the initial filter coefficients
+  @param[out]    pCoeffSpectra  points to a buffer of <code>RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(numTaps, blockLen)</code>
+                                values receiving the adapted coefficient spectra
+  @param[in]     pState         points to a state buffer of <code>RISCV_LMS_FD_STATE_SIZE_F32(numTaps, blockLen)</code> values
+  @param[in]     blockLen       block length, a power of 2 between 16 and 2048
+  @param[in]     mu             normalized step size
+  @param[in]     lambda         forgetting factor of the per-bin power estimate
+  @param[out]    pBuffer        points to a buffer of <code>RISCV_FIR_PARTITIONED_DYNAMIC_BUFFER_SIZE_F32(blockLen)</code>
+                                values receiving the FFT tables
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>blockLen</code> is not a supported length or <code>numTaps</code> is 0
+
+  @par           Details
+                   Same as \ref riscv_lms_fd_init_f32 but the real FFT is initialized with
+                   \ref riscv_rfft_fast_init_dynamic_f32. It is also available when the library is
+                   built with <code>RISCV_FFT_NO_ROM_TABLES</code>.
+ */
+riscv_status riscv_lms_fd_init_dynamic_f32(
+        riscv_lms_fd_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffSpectra,
+        float32_t * pState,
+        uint16_t blockLen,
+        float32_t mu,
+        float32_t lambda,
+        float32_t * pBuffer)
+{
+  riscv_status status;
+
+  status = riscv_fir_partitioned_init_dynamic_f32(&(S->Sfir), numTaps, pCoeffs, pCoeffSpectra, pState, blockLen, pBuffer);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->pCoeffSpectra = pCoeffSpectra;
+  S->mu = mu;
+  S->lambda = lambda;
+
+  /* Clear the work buffer and the power estimate that follow the partitioned filter state */
+  riscv_fill_f32(0.0f, pState + RISCV_FIR_PARTITIONED_STATE_SIZE_F32(numTaps, blockLen), 3U * blockLen + 1U);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of LMS_FD group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_lpc_analysis_f32.c
+ * Description:  LPC analysis of a floating-point block
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/basic_math_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void riscv_levinson_durbin_reflect_f32(const float32_t *phi,
+  float32_t *a,
+  float32_t *k,
+  float32_t *err,
+  int nbCoefs);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LPC Linear Prediction Analysis
+
+  Computes the linear prediction coefficients of a block of samples with the
+  autocorrelation method.
+
+  The block is multiplied by an optional window, the autocorrelation lags
+  0 to <code>order</code> are computed and the Levinson Durbin recursion
+  gives the coefficients of the predictor:
+  <pre>
+      xhat[n] = a[0] * x[n-1] + a[1] * x[n-2] + ... + a[order-1] * x[n-order]
+  </pre>
+  Only the <code>order + 1</code> lags needed by the recursion are computed,
+  instead of the full correlation of \ref riscv_correlate_f32. The windowing and the
+  lags use the vector basic math functions.
+
+  The reflection coefficients of the recursion are given with the sign
+  convention of the lattice filters:
+  - used as is by \ref riscv_fir_lattice_init_f32, the FIR lattice filter computes
+    the prediction error <code>e[n] = x[n] - xhat[n]</code> (whitening filter).
+  - copied in reverse order by \ref riscv_iir_lattice_init_f32 with the ladder
+    coefficients <code>{0, ..., 0, 1}</code>, the IIR lattice filter computes the
+    all-pole synthesis filter, inverse of the whitening filter.
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         LPC analysis of a floating-point block.
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     pWindow    points to the window of blockSize values, or NULL for a rectangular window
+  @param[in]     blockSize  number of samples in the block
+  @param[in]     order      order of the predictor
+  @param[out]    pCoeffs    points to the order prediction coefficients
+  @param[out]    pReflect   points to the order reflection coefficients {k1, k2, ..., kN}, or NULL
+  @param[out]    pErr       points to the prediction error energy
+  @param[in,out] pScratch   points to a buffer of <code>blockSize + order + 1</code> values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>order</code> is 0 or not smaller than <code>blockSize</code>
+
+  @par           Description
+                   The scratch buffer receives the windowed block followed by the
+                   autocorrelation lags. The prediction error energy is the
+                   energy of the windowed block multiplied by the
+                   <code>1 - k*k</code> factors of each order.
+  @par
+                   A block of zeros gives zero coefficients and a zero error.
+ */
+riscv_status riscv_lpc_analysis_f32(
+  const float32_t * pSrc,
+  const float32_t * pWindow,
+        uint32_t blockSize,
+        uint16_t order,
+        float32_t * pCoeffs,
+        float32_t * pReflect,
+        float32_t * pErr,
+        float32_t * pScratch)
+{
+  float32_t *pFrame = pScratch;
+  float32_t *pPhi = pScratch + blockSize;
+  uint32_t i;
+
+  if ((order == 0U) || (order >= blockSize))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  if (pWindow != NULL)
+  {
+    riscv_mult_f32(pSrc, pWindow, pFrame, blockSize);
+  }
+  else
+  {
+    riscv_copy_f32(pSrc, pFrame, blockSize);
+  }
+
+  /* Autocorrelation lags 0 to order */
+  for (i = 0U; i <= order; i++)
+  {
+    riscv_dot_prod_f32(pFrame, pFrame + i, blockSize - i, &pPhi[i]);
+  }
+
+  if (pPhi[0] == 0.0f)
+  {
+    riscv_fill_f32(0.0f, pCoeffs, order);
+    if (pReflect != NULL)
+    {
+      riscv_fill_f32(0.0f, pReflect, order);
+    }
+    *pErr = 0.0f;
+    return RISCV_MATH_SUCCESS;
+  }
+
+  riscv_levinson_durbin_reflect_f32(pPhi, pCoeffs, pReflect, pErr, (int) order);
+
+  /* The lattice filters use the opposite sign */
+  if (pReflect != NULL)
+  {
+    riscv_negate_f32(pReflect, pReflect, order);
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of LPC group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_lpc_analysis_q31.c
+ * Description:  LPC analysis of a Q31 block
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/basic_math_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void riscv_levinson_durbin_reflect_q31(const q31_t *phi,
+  q31_t *a,
+  q31_t *k,
+  q31_t *err,
+  int nbCoefs);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LPC
+  @{
+ */
+
+/**
+  @brief         LPC analysis of a Q31 block.
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     pWindow    points to the window of blockSize values, or NULL for a rectangular window
+  @param[in]     blockSize  number of samples in the block
+  @param[in]     order      order of the predictor
+  @param[out]    pCoeffs    points to the order prediction coefficients
+  @param[out]    pReflect   points to the order reflection coefficients {k1, k2, ..., kN}, or NULL
+  @param[out]    pErr       points to the normalized prediction error
+  @param[in,out] pScratch   points to a buffer of <code>blockSize + order + 1</code> values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>order</code> is 0 or not smaller than <code>blockSize</code>
+                                                      or <code>blockSize</code> is larger than 65535
+
+  @par           Scaling and Overflow Behavior
+                   The lags are computed by \ref riscv_dot_prod_q31 in a 64-bit
+                   accumulator and are divided by the lag 0, so the recursion of
+                   \ref riscv_levinson_durbin_q31 starts with a lag 0 of 1.0 in Q31.
+                   The prediction error is relative to the energy of the
+                   windowed block.
+  @par
+                   The prediction coefficients are in Q31 and wrap when a coefficient
+                   is outside [-1, 1). The reflection coefficients are always in
+                   (-1, 1) and are the safer representation of the predictor for
+                   the lattice filters \ref riscv_fir_lattice_q31 and \ref riscv_iir_lattice_q31.
+  @par
+                   A block of zeros gives zero coefficients and a zero error.
+ */
+riscv_status riscv_lpc_analysis_q31(
+  const q31_t * pSrc,
+  const q31_t * pWindow,
+        uint32_t blockSize,
+        uint16_t order,
+        q31_t * pCoeffs,
+        q31_t * pReflect,
+        q31_t * pErr,
+        q31_t * pScratch)
+{
+  q31_t *pFrame = pScratch;
+  q31_t *pPhi = pScratch + blockSize;
+  q63_t r0, r, den;
+  uint32_t i, shift;
+
+  if ((order == 0U) || (order >= blockSize) || (blockSize > 65535U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  if (pWindow != NULL)
+  {
+    riscv_mult_q31(pSrc, pWindow, pFrame, blockSize);
+  }
+  else
+  {
+    riscv_copy_q31(pSrc, pFrame, blockSize);
+  }
+
+  riscv_dot_prod_q31(pFrame, pFrame, blockSize, &r0);
+  if (r0 == 0)
+  {
+    riscv_fill_q31(0, pCoeffs, order);
+    if (pReflect != NULL)
+    {
+      riscv_fill_q31(0, pReflect, order);
+    }
+    *pErr = 0;
+    return RISCV_MATH_SUCCESS;
+  }
+
+  /* Lags are normalized by the lag 0, brought below 2^31 so that the quotients fit in 64 bits */
+  shift = 0U;
+  while ((r0 >> shift) > (q63_t) INT32_MAX)
+  {
+    shift++;
+  }
+  den = r0 >> shift;
+
+  pPhi[0] = INT32_MAX;
+  for (i = 1U; i <= order; i++)
+  {
+    riscv_dot_prod_q31(pFrame, pFrame + i, blockSize - i, &r);
+    pPhi[i] = clip_q63_to_q31(((r >> shift) << 31) / den);
+  }
+
+  riscv_levinson_durbin_reflect_q31(pPhi, pCoeffs, pReflect, pErr, (int) order);
+
+  /* The lattice filters use the opposite sign */
+  if (pReflect != NULL)
+  {
+    riscv_negate_q31(pReflect, pReflect, order);
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of LPC group
+ */
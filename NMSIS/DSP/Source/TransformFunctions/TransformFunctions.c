@@ -32,8 +32,10 @@
 #include "riscv_cfft_f32.c"
 #include "riscv_cfft_f64.c"
 #include "riscv_cfft_q15.c"
+#include "riscv_cfft_bfp_q15.c"
 #include "riscv_cfft_q31.c"
 #include "riscv_cfft_init_f32.c"
+#include "riscv_cfft_init_dynamic_f32.c"
 #include "riscv_cfft_init_f64.c"
 #include "riscv_cfft_init_q15.c"
 #include "riscv_cfft_init_q31.c"
@@ -47,10 +49,39 @@
 #include "riscv_rfft_fast_f32.c"
 #include "riscv_rfft_fast_f64.c"
 #include "riscv_rfft_fast_init_f32.c"
+#include "riscv_rfft_fast_init_dynamic_f32.c"
 #include "riscv_rfft_fast_init_f64.c"
+#include "riscv_cfft_mixed_f32.c"
+#include "riscv_cfft_mixed_init_f32.c"
+#include "riscv_rfft_mixed_f32.c"
+#include "riscv_rfft_mixed_init_f32.c"
+#include "riscv_stft_f32.c"
+#include "riscv_stft_init_f32.c"
+#include "riscv_istft_f32.c"
+#include "riscv_istft_init_f32.c"
+#include "riscv_goertzel_f32.c"
+#include "riscv_goertzel_init_f32.c"
+#include "riscv_goertzel_q31.c"
+#include "riscv_goertzel_init_q31.c"
+#include "riscv_goertzel_q15.c"
+#include "riscv_goertzel_init_q15.c"
+#include "riscv_sdft_f32.c"
+#include "riscv_sdft_init_f32.c"
+#include "riscv_sdft_q31.c"
+#include "riscv_sdft_init_q31.c"
+#include "riscv_sdft_q15.c"
+#include "riscv_sdft_init_q15.c"
+#include "riscv_cfft2d_f32.c"
+#include "riscv_cfft2d_init_f32.c"
+#include "riscv_cfft2d_q31.c"
+#include "riscv_cfft2d_init_q31.c"
+#include "riscv_dct2_f32.c"
+#include "riscv_dct2_init_f32.c"
+#include "riscv_dct3_f32.c"
 
 #include "riscv_mfcc_init_f32.c"
 #include "riscv_mfcc_f32.c"
+#include "riscv_mfcc_batch_f32.c"
 
 #include "riscv_mfcc_init_q31.c"
 #include "riscv_mfcc_q31.c"
@@ -69,6 +100,7 @@
 
 #include "riscv_rfft_f32.c"
 #include "riscv_rfft_q15.c"
+#include "riscv_rfft_bfp_q15.c"
 #include "riscv_rfft_q31.c"
 
 #include "riscv_rfft_init_f32.c"
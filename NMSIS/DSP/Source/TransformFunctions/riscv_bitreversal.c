@@ -30,6 +30,92 @@
 #include "dsp/transform_functions.h"
 #include "riscv_common_tables.h"
 
+#if defined (RISCV_MATH_VECTOR)
+/*
+ * Swaps the complex values at the byte offsets of v_a and v_b. A complex value
+ * is made of two words when pair is set, of one word otherwise.
+ */
+static void riscv_bitreversal_swap_rvv(
+  uint32_t * pSrc,
+  vuint16m2_t v_a,
+  vuint16m2_t v_b,
+  uint8_t pair,
+  size_t l)
+{
+  vuint32m4x2_t v_x2, v_y2;
+  vuint32m4_t v_x, v_y;
+
+  if (pair)
+  {
+    v_x2 = __riscv_vluxseg2ei16_v_u32m4x2(pSrc, v_a, l);
+    v_y2 = __riscv_vluxseg2ei16_v_u32m4x2(pSrc, v_b, l);
+    __riscv_vsuxseg2ei16_v_u32m4x2(pSrc, v_a, v_y2, l);
+    __riscv_vsuxseg2ei16_v_u32m4x2(pSrc, v_b, v_x2, l);
+  }
+  else
+  {
+    v_x = __riscv_vluxei16_v_u32m4(pSrc, v_a, l);
+    v_y = __riscv_vluxei16_v_u32m4(pSrc, v_b, l);
+    __riscv_vsuxei16_v_u32m4(pSrc, v_a, v_y, l);
+    __riscv_vsuxei16_v_u32m4(pSrc, v_b, v_x, l);
+  }
+}
+
+/*
+ * Bit reversal of the radix-2 and radix-4 transforms. The swapped pairs are disjoint,
+ * so a group of iterations is done with indexed loads and stores, the pairs (i, j)
+ * with i < j being packed with a compress. shift is log2 of the size in bytes of a
+ * complex value.
+ */
+static void riscv_bitreversal_rvv(
+        uint32_t * pSrc,
+        uint32_t fftLen,
+        uint16_t bitRevFactor,
+  const uint16_t * pBitRevTab,
+        uint32_t shift)
+{
+  uint32_t fftLenBy2 = fftLen >> 1U;
+  uint32_t k = 1U;
+  uint32_t blkCnt = (fftLen >> 2U) - 1U;               /* Iterations after the first one */
+  uint8_t pair = (shift == 3U) ? 1U : 0U;
+  size_t l, n;
+  vuint16m2_t v_i, v_j, v_a, v_b;
+  vbool8_t v_m;
+
+  /* First iteration, j = 0: pSrc[1] <-> pSrc[fftLenBy2] */
+  l = __riscv_vsetvl_e32m4(1);
+  riscv_bitreversal_swap_rvv(pSrc, __riscv_vmv_v_x_u16m2((uint16_t) (1U << shift), l),
+                             __riscv_vmv_v_x_u16m2((uint16_t) (fftLenBy2 << shift), l), pair, l);
+
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_i = __riscv_vsll_vx_u16m2(__riscv_vadd_vx_u16m2(__riscv_vid_v_u16m2(l), (uint16_t) k, l), 1, l);
+    v_j = __riscv_vlse16_v_u16m2(pBitRevTab + (k - 1U) * bitRevFactor, 2 * bitRevFactor, l);
+
+    /* pSrc[i + 1] <-> pSrc[j + fftLenBy2] */
+    v_a = __riscv_vsll_vx_u16m2(__riscv_vadd_vx_u16m2(v_i, 1U, l), shift, l);
+    v_b = __riscv_vsll_vx_u16m2(__riscv_vadd_vx_u16m2(v_j, (uint16_t) fftLenBy2, l), shift, l);
+    riscv_bitreversal_swap_rvv(pSrc, v_a, v_b, pair, l);
+
+    /* pSrc[i] <-> pSrc[j] and pSrc[i + fftLenBy2 + 1] <-> pSrc[j + fftLenBy2 + 1] when i < j */
+    v_m = __riscv_vmsltu_vv_u16m2_b8(v_i, v_j, l);
+    n = __riscv_vcpop_m_b8(v_m, l);
+    if (n > 0U)
+    {
+      v_a = __riscv_vsll_vx_u16m2(__riscv_vcompress_vm_u16m2(v_i, v_m, l), shift, n);
+      v_b = __riscv_vsll_vx_u16m2(__riscv_vcompress_vm_u16m2(v_j, v_m, l), shift, n);
+      riscv_bitreversal_swap_rvv(pSrc, v_a, v_b, pair, n);
+
+      v_a = __riscv_vadd_vx_u16m2(v_a, (uint16_t) ((fftLenBy2 + 1U) << shift), n);
+      v_b = __riscv_vadd_vx_u16m2(v_b, (uint16_t) ((fftLenBy2 + 1U) << shift), n);
+      riscv_bitreversal_swap_rvv(pSrc, v_a, v_b, pair, n);
+    }
+
+    k += l;
+  }
+}
+#endif /* defined (RISCV_MATH_VECTOR) */
+
 
 /**
   @brief         In-place floating-point bit reversal function.
@@ -46,6 +132,9 @@ void riscv_bitreversal_f32(
         uint16_t bitRevFactor,
   const uint16_t * pBitRevTab)
 {
+#if defined (RISCV_MATH_VECTOR)
+   riscv_bitreversal_rvv((uint32_t *) pSrc, fftSize, bitRevFactor, pBitRevTab, 3U);
+#else
    uint16_t fftLenBy2, fftLenBy2p1;
    uint16_t i, j;
    float32_t in;
@@ -99,6 +188,7 @@ void riscv_bitreversal_f32(
       /*  Updating the bit reversal index depending on the fft length  */
       pBitRevTab += bitRevFactor;
    }
+#endif /* defined (RISCV_MATH_VECTOR) */
 }
 
 
@@ -117,6 +207,9 @@ void riscv_bitreversal_q31(
         uint16_t bitRevFactor,
   const uint16_t * pBitRevTab)
 {
+#if defined (RISCV_MATH_VECTOR)
+   riscv_bitreversal_rvv((uint32_t *) pSrc, fftLen, bitRevFactor, pBitRevTab, 3U);
+#else
    uint32_t fftLenBy2, fftLenBy2p1, i, j;
    q31_t in;
 
@@ -169,6 +262,7 @@ void riscv_bitreversal_q31(
       /*  Updating the bit reversal index depending on the fft length */
       pBitRevTab += bitRevFactor;
    }
+#endif /* defined (RISCV_MATH_VECTOR) */
 }
 
 
@@ -188,6 +282,9 @@ void riscv_bitreversal_q15(
         uint16_t bitRevFactor,
   const uint16_t * pBitRevTab)
 {
+#if defined (RISCV_MATH_VECTOR)
+   riscv_bitreversal_rvv((uint32_t *) pSrc16, fftLen, bitRevFactor, pBitRevTab, 2U);
+#else
    q31_t *pSrc = (q31_t *) pSrc16;
    q31_t in;
    uint32_t fftLenBy2, fftLenBy2p1;
@@ -228,4 +325,5 @@ void riscv_bitreversal_q15(
       /*  Updating the bit reversal index depending on the fft length  */
       pBitRevTab += bitRevFactor;
    }
+#endif /* defined (RISCV_MATH_VECTOR) */
 }
@@ -37,6 +37,10 @@
   @param[in]     bitRevLen   bit reversal table length
   @param[in]     pBitRevTab  points to bit reversal table
   @return        none
+
+  @par           Vector implementation
+                   The vector version swaps groups of pairs with indexed loads and stores,
+                   so an index must not appear in more than one pair of the table.
 */
 
 void riscv_bitreversal_64(
@@ -44,6 +48,28 @@ void riscv_bitreversal_64(
   const uint16_t bitRevLen,
   const uint16_t *pBitRevTab)
 {
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt = bitRevLen >> 1U;                   /* Number of swaps */
+  size_t l;
+  vuint16m1x2_t v_tab;
+  vuint16m1_t v_a, v_b;
+  vuint64m4x2_t v_x, v_y;
+
+  for (; (l = __riscv_vsetvl_e64m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    /* Byte offsets of the complex values: (index >> 2) * 8 */
+    v_tab = __riscv_vlseg2e16_v_u16m1x2(pBitRevTab, l);
+    v_a = __riscv_vsll_vx_u16m1(__riscv_vsrl_vx_u16m1(__riscv_vget_v_u16m1x2_u16m1(v_tab, 0), 2, l), 3, l);
+    v_b = __riscv_vsll_vx_u16m1(__riscv_vsrl_vx_u16m1(__riscv_vget_v_u16m1x2_u16m1(v_tab, 1), 2, l), 3, l);
+
+    v_x = __riscv_vluxseg2ei16_v_u64m4x2(pSrc, v_a, l);
+    v_y = __riscv_vluxseg2ei16_v_u64m4x2(pSrc, v_b, l);
+    __riscv_vsuxseg2ei16_v_u64m4x2(pSrc, v_a, v_y, l);
+    __riscv_vsuxseg2ei16_v_u64m4x2(pSrc, v_b, v_x, l);
+
+    pBitRevTab += 2U * l;
+  }
+#else
   uint64_t a, b, tmp;
   uint32_t i;
 
@@ -64,17 +90,22 @@ void riscv_bitreversal_64(
 
     i += 2;
   }
+#endif /* defined (RISCV_MATH_VECTOR) */
 }
 
 /**
-  @brief         In-place 32 bit reversal function.
+  @brief         In-place 32 bit reversal function with the swaps done in table order.
   @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
   @param[in]     bitRevLen   bit reversal table length
   @param[in]     pBitRevTab  points to bit reversal table
   @return        none
+
+  @par           Details
+                   The pairs are swapped one after the other, so an index can appear in
+                   several pairs of the table.
 */
 
-void riscv_bitreversal_32(
+void riscv_bitreversal_32_inorder(
         uint32_t *pSrc,
   const uint16_t bitRevLen,
   const uint16_t *pBitRevTab)
@@ -101,12 +132,62 @@ void riscv_bitreversal_32(
 }
 
 
+/**
+  @brief         In-place 32 bit reversal function.
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]     bitRevLen   bit reversal table length
+  @param[in]     pBitRevTab  points to bit reversal table
+  @return        none
+
+  @par           Vector implementation
+                   The vector version swaps groups of pairs with indexed loads and stores,
+                   so an index must not appear in more than one pair of the table. Tables
+                   chaining the swaps of longer permutation cycles, as the floating-point
+                   tables of the lengths which are not a power of 8, must be used with
+                   riscv_bitreversal_32_inorder.
+*/
+
+void riscv_bitreversal_32(
+        uint32_t *pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t *pBitRevTab)
+{
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt = bitRevLen >> 1U;                   /* Number of swaps */
+  size_t l;
+  vuint16m2x2_t v_tab;
+  vuint16m2_t v_a, v_b;
+  vuint32m4x2_t v_x, v_y;
+
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    /* Byte offsets of the complex values: (index >> 2) * 4 */
+    v_tab = __riscv_vlseg2e16_v_u16m2x2(pBitRevTab, l);
+    v_a = __riscv_vand_vx_u16m2(__riscv_vget_v_u16m2x2_u16m2(v_tab, 0), 0xFFFCU, l);
+    v_b = __riscv_vand_vx_u16m2(__riscv_vget_v_u16m2x2_u16m2(v_tab, 1), 0xFFFCU, l);
+
+    v_x = __riscv_vluxseg2ei16_v_u32m4x2(pSrc, v_a, l);
+    v_y = __riscv_vluxseg2ei16_v_u32m4x2(pSrc, v_b, l);
+    __riscv_vsuxseg2ei16_v_u32m4x2(pSrc, v_a, v_y, l);
+    __riscv_vsuxseg2ei16_v_u32m4x2(pSrc, v_b, v_x, l);
+
+    pBitRevTab += 2U * l;
+  }
+#else
+  riscv_bitreversal_32_inorder(pSrc, bitRevLen, pBitRevTab);
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
 /**
   @brief         In-place 16 bit reversal function.
   @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
   @param[in]     bitRevLen   bit reversal table length
   @param[in]     pBitRevTab  points to bit reversal table
   @return        none
+
+  @par           Vector implementation
+                   The vector version swaps groups of pairs with indexed loads and stores,
+                   so an index must not appear in more than one pair of the table.
 */
 
 void riscv_bitreversal_16(
@@ -114,6 +195,28 @@ void riscv_bitreversal_16(
   const uint16_t bitRevLen,
   const uint16_t *pBitRevTab)
 {
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt = bitRevLen >> 1U;                   /* Number of swaps */
+  size_t l;
+  vuint16m4x2_t v_tab;
+  vuint16m4_t v_a, v_b;
+  vuint16m4x2_t v_x, v_y;
+
+  for (; (l = __riscv_vsetvl_e16m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    /* Byte offsets of the complex values: (index >> 2) * 2 */
+    v_tab = __riscv_vlseg2e16_v_u16m4x2(pBitRevTab, l);
+    v_a = __riscv_vand_vx_u16m4(__riscv_vsrl_vx_u16m4(__riscv_vget_v_u16m4x2_u16m4(v_tab, 0), 1, l), 0xFFFEU, l);
+    v_b = __riscv_vand_vx_u16m4(__riscv_vsrl_vx_u16m4(__riscv_vget_v_u16m4x2_u16m4(v_tab, 1), 1, l), 0xFFFEU, l);
+
+    v_x = __riscv_vluxseg2ei16_v_u16m4x2(pSrc, v_a, l);
+    v_y = __riscv_vluxseg2ei16_v_u16m4x2(pSrc, v_b, l);
+    __riscv_vsuxseg2ei16_v_u16m4x2(pSrc, v_a, v_y, l);
+    __riscv_vsuxseg2ei16_v_u16m4x2(pSrc, v_b, v_x, l);
+
+    pBitRevTab += 2U * l;
+  }
+#else
   uint16_t a, b, tmp;
   uint32_t i;
 
@@ -134,4 +237,5 @@ void riscv_bitreversal_16(
 
     i += 2;
   }
+#endif /* defined (RISCV_MATH_VECTOR) */
 }
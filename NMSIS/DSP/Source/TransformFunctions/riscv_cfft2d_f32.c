@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft2d_f32.c
+ * Description:  2-D complex FFT for floating-point data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup ComplexFFT2D 2-D Complex FFT
+
+  The 2-D FFT transforms a matrix of <code>numRows x numCols</code> complex
+  values stored row by row, with the real and imaginary parts interleaved
+  as for the 1-D \ref ComplexFFT. Processing occurs in-place.
+
+  @par           Algorithm
+                   The rows are transformed first with \ref riscv_cfft_f32 or \ref riscv_cfft_q31.
+                   The columns are then processed in tiles of <code>RISCV_CFFT2D_TILE_COLS</code>
+                   columns: the tile is copied into the scratch buffer, each column is transformed
+                   there and the tile is copied back. Each row segment of a tile is a single
+                   cache line read, so the matrix goes through the cache twice and no
+                   transposition is needed. The vector version copies the columns with
+                   strided segment loads and stores.
+
+  @par           Instance Structure
+                   The instance holds the dimensions, one CFFT instance for each dimension and
+                   a scratch buffer of <code>RISCV_CFFT2D_SCRATCH_SIZE(numRows)</code> values.
+                   <code>numRows</code> and <code>numCols</code> must be lengths supported by
+                   the 1-D CFFT of the same data type.
+
+  @par           Fixed-Point Behavior
+                   The Q31 version applies the scaling of \ref riscv_cfft_q31 to each dimension,
+                   so the output format depends on both lengths.
+ */
+
+/**
+  @addtogroup ComplexFFT2D
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point 2-D complex FFT.
+  @param[in]     S              points to an instance of the floating-point 2-D FFT structure
+  @param[in,out] p1             points to the complex matrix of size <code>2*numRows*numCols</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+
+  @par           Output
+                   The output is in natural order in both dimensions. The inverse transform
+                   includes the <code>1/(numRows*numCols)</code> factor.
+ */
+void riscv_cfft2d_f32(
+  const riscv_cfft2d_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag)
+{
+  uint32_t numRows = S->numRows;
+  uint32_t numCols = S->numCols;
+  float32_t *pScratch = S->pScratch;
+  float32_t *pMat;
+  uint32_t r, c, c0;
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt;
+  size_t l;
+  vfloat32m4x2_t v_x;
+#else
+  float32_t *pTile;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Row pass */
+  for (r = 0U; r < numRows; r++)
+  {
+    riscv_cfft_f32(&(S->rowCfft), p1 + 2U * r * numCols, ifftFlag, 1U);
+  }
+
+  /* Column pass, one tile of RISCV_CFFT2D_TILE_COLS columns at a time */
+  for (c0 = 0U; c0 < numCols; c0 += RISCV_CFFT2D_TILE_COLS)
+  {
+#if defined (RISCV_MATH_VECTOR)
+    for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+    {
+      pMat = p1 + 2U * (c0 + c);
+      blkCnt = numRows;
+      r = 0U;
+      for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+        v_x = __riscv_vlsseg2e32_v_f32m4x2(pMat + 2U * r * numCols, (ptrdiff_t) numCols * 8, l);
+        __riscv_vsseg2e32_v_f32m4x2(pScratch + 2U * (c * numRows + r), v_x, l);
+        r += l;
+      }
+    }
+#else
+    pMat = p1 + 2U * c0;
+    for (r = 0U; r < numRows; r++)
+    {
+      pTile = pScratch + 2U * r;
+      for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+      {
+        pTile[0] = pMat[0];
+        pTile[1] = pMat[1];
+        pMat += 2;
+        pTile += 2U * numRows;
+      }
+      pMat += 2U * (numCols - RISCV_CFFT2D_TILE_COLS);
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+    for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+    {
+      riscv_cfft_f32(&(S->colCfft), pScratch + 2U * c * numRows, ifftFlag, 1U);
+    }
+
+#if defined (RISCV_MATH_VECTOR)
+    for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+    {
+      pMat = p1 + 2U * (c0 + c);
+      blkCnt = numRows;
+      r = 0U;
+      for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+        v_x = __riscv_vlseg2e32_v_f32m4x2(pScratch + 2U * (c * numRows + r), l);
+        __riscv_vssseg2e32_v_f32m4x2(pMat + 2U * r * numCols, (ptrdiff_t) numCols * 8, v_x, l);
+        r += l;
+      }
+    }
+#else
+    pMat = p1 + 2U * c0;
+    for (r = 0U; r < numRows; r++)
+    {
+      pTile = pScratch + 2U * r;
+      for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+      {
+        pMat[0] = pTile[0];
+        pMat[1] = pTile[1];
+        pMat += 2;
+        pTile += 2U * numRows;
+      }
+      pMat += 2U * (numCols - RISCV_CFFT2D_TILE_COLS);
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+  }
+}
+
+/**
+  @} end of ComplexFFT2D group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft2d_init_f32.c
+ * Description:  Initialization function for the floating-point 2-D complex FFT
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT2D
+  @{
+ */
+
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
+/**
+  @brief         Initialization function for the floating-point 2-D complex FFT.
+  @param[in,out] S          points to an instance of the floating-point 2-D FFT structure
+  @param[in]     numRows    number of rows of the matrix
+  @param[in]     numCols    number of columns of the matrix
+  @param[in]     pScratch   points to a buffer of <code>RISCV_CFFT2D_SCRATCH_SIZE(numRows)</code> values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : a dimension is not a supported CFFT length
+
+  @par           Details
+                   Supported dimensions are 16, 32, 64, ..., 4096. Both CFFT instances are
+                   initialized with \ref riscv_cfft_init_f32 and share the tables of the library.
+ */
+riscv_status riscv_cfft2d_init_f32(
+        riscv_cfft2d_instance_f32 * S,
+        uint16_t numRows,
+        uint16_t numCols,
+        float32_t * pScratch)
+{
+  riscv_status status;
+
+  if (pScratch == NULL)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_cfft_init_f32(&(S->rowCfft), numCols);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  status = riscv_cfft_init_f32(&(S->colCfft), numRows);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->numRows = numRows;
+  S->numCols = numCols;
+  S->pScratch = pScratch;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+  @brief         Initialization function for the floating-point 2-D complex FFT with FFT tables computed at runtime.
+  @param[in,out] S          points to an instance of the floating-point 2-D FFT structure
+  @param[in]     numRows    number of rows of the matrix
+  @param[in]     numCols    number of columns of the matrix
+  @param[in]     pScratch   points to a buffer of <code>RISCV_CFFT2D_SCRATCH_SIZE(numRows)</code> values
+  @param[out]    pBuffer    points to a buffer of <code>RISCV_CFFT2D_DYNAMIC_BUFFER_SIZE_F32(numRows, numCols)</code>
+                            values receiving the FFT tables
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : a dimension is not a supported CFFT length
+
+  @par           Details
+                   Same as \ref riscv_cfft2d_init_f32 but both CFFT instances are initialized with
+                   \ref riscv_cfft_init_dynamic_f32. The tables of the row transform are followed by
+                   the tables of the column transform, or shared with them when the matrix is square.
+                   It is also available when the library is built with <code>RISCV_FFT_NO_ROM_TABLES</code>.
+ */
+riscv_status riscv_cfft2d_init_dynamic_f32(
+        riscv_cfft2d_instance_f32 * S,
+        uint16_t numRows,
+        uint16_t numCols,
+        float32_t * pScratch,
+        float32_t * pBuffer)
+{
+  riscv_status status;
+
+  if ((pScratch == NULL) || (pBuffer == NULL))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_cfft_init_dynamic_f32(&(S->rowCfft), numCols, pBuffer);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  if (numRows == numCols)
+  {
+    S->colCfft = S->rowCfft;
+  }
+  else
+  {
+    status = riscv_cfft_init_dynamic_f32(&(S->colCfft), numRows,
+                                         pBuffer + RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(numCols));
+    if (status != RISCV_MATH_SUCCESS)
+    {
+      return (status);
+    }
+  }
+
+  S->numRows = numRows;
+  S->numCols = numCols;
+  S->pScratch = pScratch;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFT2D group
+ */
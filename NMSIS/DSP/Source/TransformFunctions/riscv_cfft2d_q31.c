@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft2d_q31.c
+ * Description:  2-D complex FFT for Q31 data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @addtogroup ComplexFFT2D
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 2-D complex FFT.
+  @param[in]     S              points to an instance of the Q31 2-D FFT structure
+  @param[in,out] p1             points to the complex matrix of size <code>2*numRows*numCols</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+
+  @par           Output
+                   The output is in natural order in both dimensions. Each dimension is
+                   scaled as by \ref riscv_cfft_q31, so both directions divide the sums by
+                   <code>numRows*numCols</code> and the inverse transform gives the input back.
+ */
+void riscv_cfft2d_q31(
+  const riscv_cfft2d_instance_q31 * S,
+        q31_t * p1,
+        uint8_t ifftFlag)
+{
+  uint32_t numRows = S->numRows;
+  uint32_t numCols = S->numCols;
+  q31_t *pScratch = S->pScratch;
+  q31_t *pMat;
+  uint32_t r, c, c0;
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt;
+  size_t l;
+  vint32m4x2_t v_x;
+#else
+  q31_t *pTile;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Row pass */
+  for (r = 0U; r < numRows; r++)
+  {
+    riscv_cfft_q31(&(S->rowCfft), p1 + 2U * r * numCols, ifftFlag, 1U);
+  }
+
+  /* Column pass, one tile of RISCV_CFFT2D_TILE_COLS columns at a time */
+  for (c0 = 0U; c0 < numCols; c0 += RISCV_CFFT2D_TILE_COLS)
+  {
+#if defined (RISCV_MATH_VECTOR)
+    for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+    {
+      pMat = p1 + 2U * (c0 + c);
+      blkCnt = numRows;
+      r = 0U;
+      for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+        v_x = __riscv_vlsseg2e32_v_i32m4x2(pMat + 2U * r * numCols, (ptrdiff_t) numCols * 8, l);
+        __riscv_vsseg2e32_v_i32m4x2(pScratch + 2U * (c * numRows + r), v_x, l);
+        r += l;
+      }
+    }
+#else
+    pMat = p1 + 2U * c0;
+    for (r = 0U; r < numRows; r++)
+    {
+      pTile = pScratch + 2U * r;
+      for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+      {
+        pTile[0] = pMat[0];
+        pTile[1] = pMat[1];
+        pMat += 2;
+        pTile += 2U * numRows;
+      }
+      pMat += 2U * (numCols - RISCV_CFFT2D_TILE_COLS);
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+    for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+    {
+      riscv_cfft_q31(&(S->colCfft), pScratch + 2U * c * numRows, ifftFlag, 1U);
+    }
+
+#if defined (RISCV_MATH_VECTOR)
+    for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+    {
+      pMat = p1 + 2U * (c0 + c);
+      blkCnt = numRows;
+      r = 0U;
+      for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+      {
+        v_x = __riscv_vlseg2e32_v_i32m4x2(pScratch + 2U * (c * numRows + r), l);
+        __riscv_vssseg2e32_v_i32m4x2(pMat + 2U * r * numCols, (ptrdiff_t) numCols * 8, v_x, l);
+        r += l;
+      }
+    }
+#else
+    pMat = p1 + 2U * c0;
+    for (r = 0U; r < numRows; r++)
+    {
+      pTile = pScratch + 2U * r;
+      for (c = 0U; c < RISCV_CFFT2D_TILE_COLS; c++)
+      {
+        pMat[0] = pTile[0];
+        pMat[1] = pTile[1];
+        pMat += 2;
+        pTile += 2U * numRows;
+      }
+      pMat += 2U * (numCols - RISCV_CFFT2D_TILE_COLS);
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+  }
+}
+
+/**
+  @} end of ComplexFFT2D group
+ */
@@ -0,0 +1,383 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_bfp_q15.c
+ * Description:  Block floating-point Complex FFT for Q15
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/statistics_functions.h"
+
+/*
+ * A radix-2 butterfly can grow a component by 2*sqrt(2). Below this bound the
+ * stage runs without scaling, below twice this bound a shift by 1 is enough.
+ */
+#define CFFT_BFP_Q15_HEADROOM 0x2D41
+
+#if defined (RISCV_MATH_VECTOR)
+/*
+ * Radix-2 butterflies on l lanes. Lane i reads its two inputs at pA and pB plus i*bstride bytes
+ * and its twiddle at pW plus i*tstride bytes. The running max and min of the outputs are kept
+ * per lane, the tail lanes are left untouched so that one reduction per stage is enough.
+ */
+static void riscv_cfft_bfp_butterfly_vec_q15(
+        q15_t * pA,
+        q15_t * pB,
+        ptrdiff_t bstride,
+  const q15_t * pW,
+        ptrdiff_t tstride,
+        uint32_t shift,
+        uint8_t ifftFlag,
+        vint16m2_t * pMax,
+        vint16m2_t * pMin,
+        size_t l)
+{
+  vint16m2x2_t v_a, v_b, v_w;
+  vint16m2_t v_ar, v_ai, v_br, v_bi, v_c, v_s, v_ns;
+  vint16m2_t v_xr, v_xi, v_dr, v_di, v_yr, v_yi;
+
+  v_a = __riscv_vlsseg2e16_v_i16m2x2(pA, bstride, l);
+  v_b = __riscv_vlsseg2e16_v_i16m2x2(pB, bstride, l);
+  v_w = __riscv_vlsseg2e16_v_i16m2x2(pW, tstride, l);
+  v_ar = __riscv_vget_v_i16m2x2_i16m2(v_a, 0);
+  v_ai = __riscv_vget_v_i16m2x2_i16m2(v_a, 1);
+  v_br = __riscv_vget_v_i16m2x2_i16m2(v_b, 0);
+  v_bi = __riscv_vget_v_i16m2x2_i16m2(v_b, 1);
+  v_c = __riscv_vget_v_i16m2x2_i16m2(v_w, 0);
+  v_s = __riscv_vget_v_i16m2x2_i16m2(v_w, 1);
+  v_ns = __riscv_vneg_v_i16m2(v_s, l);
+  if (ifftFlag)
+  {
+    v_ns = v_s;
+    v_s = __riscv_vneg_v_i16m2(v_s, l);
+  }
+
+  v_xr = __riscv_vnsra_wx_i16m2(__riscv_vwadd_vv_i32m4(v_ar, v_br, l), shift, l);
+  v_xi = __riscv_vnsra_wx_i16m2(__riscv_vwadd_vv_i32m4(v_ai, v_bi, l), shift, l);
+  v_dr = __riscv_vnsra_wx_i16m2(__riscv_vwsub_vv_i32m4(v_ar, v_br, l), shift, l);
+  v_di = __riscv_vnsra_wx_i16m2(__riscv_vwsub_vv_i32m4(v_ai, v_bi, l), shift, l);
+
+  /* (dr + j*di) * (c - j*s) for the forward transform, (c + j*s) for the inverse */
+  v_yr = __riscv_vnsra_wx_i16m2(__riscv_vwmacc_vv_i32m4(__riscv_vwmul_vv_i32m4(v_dr, v_c, l), v_di, v_s, l), 15, l);
+  v_yi = __riscv_vnsra_wx_i16m2(__riscv_vwmacc_vv_i32m4(__riscv_vwmul_vv_i32m4(v_di, v_c, l), v_dr, v_ns, l), 15, l);
+
+  __riscv_vssseg2e16_v_i16m2x2(pA, bstride, __riscv_vset_v_i16m2_i16m2x2(__riscv_vset_v_i16m2_i16m2x2(v_a, 0, v_xr), 1, v_xi), l);
+  __riscv_vssseg2e16_v_i16m2x2(pB, bstride, __riscv_vset_v_i16m2_i16m2x2(__riscv_vset_v_i16m2_i16m2x2(v_b, 0, v_yr), 1, v_yi), l);
+
+  *pMax = __riscv_vmax_vv_i16m2_tu(*pMax, *pMax, __riscv_vmax_vv_i16m2(__riscv_vmax_vv_i16m2(v_xr, v_xi, l),
+                                                                      __riscv_vmax_vv_i16m2(v_yr, v_yi, l), l), l);
+  *pMin = __riscv_vmin_vv_i16m2_tu(*pMin, *pMin, __riscv_vmin_vv_i16m2(__riscv_vmin_vv_i16m2(v_xr, v_xi, l),
+                                                                      __riscv_vmin_vv_i16m2(v_yr, v_yi, l), l), l);
+}
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+/*
+ * One radix-2 decimation in frequency stage on blocks of 2*half complex samples,
+ * with all outputs shifted right by shift bits. Returns the largest absolute
+ * value of the stage outputs.
+ */
+static uint32_t riscv_cfft_bfp_stage_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+        uint32_t half,
+  const q15_t * pCoef,
+        uint32_t twidStep,
+        uint32_t shift,
+        uint8_t ifftFlag)
+{
+  q15_t *pA, *pB;
+  uint32_t g, j;
+  q31_t maxVal, minVal;
+
+#if defined (RISCV_MATH_VECTOR)
+  size_t l, vlmax;
+  uint32_t groupCnt;
+  vint16m2_t v_max, v_min;
+  vint16m1_t v_zero;
+
+  vlmax = __riscv_vsetvlmax_e16m2();
+  v_max = __riscv_vmv_v_x_i16m2(0, vlmax);
+  v_min = __riscv_vmv_v_x_i16m2(0, vlmax);
+  groupCnt = fftLen / (2U * half);
+
+  if (half >= groupCnt)
+  {
+    /* Long butterfly groups: one vector holds consecutive butterflies of a group,
+       their twiddles are read with a stride of twidStep */
+    for (g = 0U; g < fftLen; g += 2U * half)
+    {
+      for (j = 0U; j < half; j += l)
+      {
+        l = __riscv_vsetvl_e16m2(half - j);
+        pA = pSrc + 2U * (g + j);
+        riscv_cfft_bfp_butterfly_vec_q15(pA, pA + 2U * half, 4, pCoef + 2U * j * twidStep,
+                                         (ptrdiff_t) twidStep * 4, shift, ifftFlag, &v_max, &v_min, l);
+      }
+    }
+  }
+  else
+  {
+    /* Many short groups: one vector holds the same butterfly of several groups,
+       all lanes share the same twiddle */
+    for (j = 0U; j < half; j++)
+    {
+      for (g = 0U; g < groupCnt; g += l)
+      {
+        l = __riscv_vsetvl_e16m2(groupCnt - g);
+        pA = pSrc + 2U * (2U * half * g + j);
+        riscv_cfft_bfp_butterfly_vec_q15(pA, pA + 2U * half, (ptrdiff_t) half * 8, pCoef + 2U * j * twidStep,
+                                         0, shift, ifftFlag, &v_max, &v_min, l);
+      }
+    }
+  }
+
+  /* Single reduction of the per lane max and min of the stage */
+  v_zero = __riscv_vmv_v_x_i16m1(0, 1);
+  maxVal = __riscv_vmv_x_s_i16m1_i16(__riscv_vredmax_vs_i16m2_i16m1(v_max, v_zero, vlmax));
+  minVal = __riscv_vmv_x_s_i16m1_i16(__riscv_vredmin_vs_i16m2_i16m1(v_min, v_zero, vlmax));
+#elif defined (RISCV_MATH_DSP)
+  q31_t T, S, W, X, D, Y, yr, yi;
+  q31_t maxPacked, minPacked;
+
+  maxPacked = 0;
+  minPacked = 0;
+  for (g = 0U; g < fftLen; g += 2U * half)
+  {
+    pA = pSrc + 2U * g;
+    pB = pA + 2U * half;
+    for (j = 0U; j < half; j++)
+    {
+      /* One butterfly per word: real part in the low halfword, imaginary part in the high halfword */
+      W = read_q15x2 ((q15_t *) pCoef + 2U * j * twidStep);
+      T = read_q15x2 (pA);
+      S = read_q15x2 (pB);
+
+      if (shift == 0U)
+      {
+        X = (q31_t) __RV_ADD16(T, S);
+        D = (q31_t) __RV_SUB16(T, S);
+      }
+      else
+      {
+        /* Halving add and subtract cannot overflow, the remaining bit is an arithmetic shift */
+        X = (q31_t) __RV_SRA16(__SHADD16(T, S), shift - 1U);
+        D = (q31_t) __RV_SRA16(__SHSUB16(T, S), shift - 1U);
+      }
+
+      /* (dr + j*di) * (c - j*s) for the forward transform, (c + j*s) for the inverse */
+      if (ifftFlag)
+      {
+        yr = (q31_t) __SMUSD(W, D);
+        yi = (q31_t) __SMUADX(W, D);
+      }
+      else
+      {
+        yr = (q31_t) __SMUAD(W, D);
+        yi = (q31_t) __SMUSDX(W, D);
+      }
+      Y = (q31_t) ((((uint32_t) yi << 1) & 0xFFFF0000U) | (((uint32_t) yr >> 15) & 0x0000FFFFU));
+
+      write_q15x2_ia (&pA, X);
+      write_q15x2_ia (&pB, Y);
+
+      maxPacked = (q31_t) __SMAX16(maxPacked, __SMAX16(X, Y));
+      minPacked = (q31_t) __RV_SMIN16(minPacked, __RV_SMIN16(X, Y));
+    }
+  }
+  maxVal = MAX((q15_t) maxPacked, (q15_t) (maxPacked >> 16));
+  minVal = MIN((q15_t) minPacked, (q15_t) (minPacked >> 16));
+#else
+  q31_t ar, ai, br, bi, dr, di, c, s;
+  q15_t xr, xi, yr, yi;
+
+  maxVal = 0;
+  minVal = 0;
+  for (g = 0U; g < fftLen; g += 2U * half)
+  {
+    pA = pSrc + 2U * g;
+    pB = pA + 2U * half;
+    for (j = 0U; j < half; j++)
+    {
+      c = pCoef[2U * j * twidStep];
+      s = pCoef[2U * j * twidStep + 1U];
+      if (ifftFlag)
+      {
+        s = -s;
+      }
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = pB[1];
+
+      xr = (q15_t) ((ar + br) >> shift);
+      xi = (q15_t) ((ai + bi) >> shift);
+      dr = (ar - br) >> shift;
+      di = (ai - bi) >> shift;
+
+      /* (dr + j*di) * (c - j*s) for the forward transform, (c + j*s) for the inverse */
+      yr = (q15_t) ((dr * c + di * s) >> 15);
+      yi = (q15_t) ((di * c - dr * s) >> 15);
+
+      *pA++ = xr;
+      *pA++ = xi;
+      *pB++ = yr;
+      *pB++ = yi;
+
+      maxVal = MAX(maxVal, MAX(MAX(xr, xi), MAX(yr, yi)));
+      minVal = MIN(minVal, MIN(MIN(xr, xi), MIN(yr, yi)));
+    }
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  return (uint32_t) MAX(maxVal, -minVal);
+}
+
+/**
+  @addtogroup ComplexFFTQ15
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 complex FFT with block floating-point scaling.
+  @param[in]     S               points to an instance of Q15 CFFT structure
+  @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+  @return        block exponent of the result
+
+  @par           Scaling
+                   Unlike \ref riscv_cfft_q15, which halves the data at every stage, this
+                   function keeps a single exponent for the whole block. The input is first
+                   normalized to use the available headroom, then each stage is shifted by
+                   0, 1 or 2 bits depending on the largest value produced by the previous
+                   stage, only when an overflow is possible.
+  @par
+                   The result, read as Q15 values, must be multiplied by
+                   <code>2^exponent</code>. For the forward transform this gives
+                   the unscaled DFT, for the inverse transform the DFT including
+                   the <code>1/fftLen</code> factor. A buffer of zeros returns 0.
+  @par
+                   The instance twiddle factors are used with a radix-2 decimation in
+                   frequency algorithm, so any instance initialized by \ref riscv_cfft_init_q15
+                   can be used. Bit reversal is computed on the fly and does not use
+                   the instance bit reversal table.
+ */
+int32_t riscv_cfft_bfp_q15(
+  const riscv_cfft_instance_q15 * S,
+        q15_t * p1,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag)
+{
+  uint32_t fftLen = S->fftLen;
+  uint32_t half, twidStep, shift, m;
+  uint32_t i, j;
+  int32_t exponent;
+  q15_t maxValue;
+  uint32_t index;
+  q15_t tmp;
+
+  /* Normalize the input so that the first stage runs without scaling */
+  riscv_absmax_q15(p1, 2U * fftLen, &maxValue, &index);
+  if (maxValue == 0)
+  {
+    return 0;
+  }
+  m = (uint32_t) maxValue;
+  shift = 0U;
+  while ((m << (shift + 1U)) <= CFFT_BFP_Q15_HEADROOM)
+  {
+    shift++;
+  }
+  if (shift > 0U)
+  {
+    riscv_shift_q15(p1, (int8_t) shift, p1, 2U * fftLen);
+  }
+  m <<= shift;
+  exponent = -(int32_t) shift;
+
+  twidStep = 1U;
+  for (half = fftLen >> 1U; half > 0U; half >>= 1U)
+  {
+    if (m <= CFFT_BFP_Q15_HEADROOM)
+    {
+      shift = 0U;
+    }
+    else if (m <= 2U * CFFT_BFP_Q15_HEADROOM)
+    {
+      shift = 1U;
+    }
+    else
+    {
+      shift = 2U;
+    }
+    exponent += (int32_t) shift;
+
+    m = riscv_cfft_bfp_stage_q15(p1, fftLen, half, S->pTwiddle, twidStep, shift, ifftFlag);
+    twidStep <<= 1U;
+  }
+
+  if (bitReverseFlag)
+  {
+    j = 0U;
+    for (i = 0U; i < fftLen; i++)
+    {
+      if (i < j)
+      {
+        tmp = p1[2U * i];
+        p1[2U * i] = p1[2U * j];
+        p1[2U * j] = tmp;
+        tmp = p1[2U * i + 1U];
+        p1[2U * i + 1U] = p1[2U * j + 1U];
+        p1[2U * j + 1U] = tmp;
+      }
+      half = fftLen >> 1U;
+      while ((j & half) != 0U)
+      {
+        j ^= half;
+        half >>= 1U;
+      }
+      j |= half;
+    }
+  }
+
+  if (ifftFlag)
+  {
+    /* 1/fftLen factor of the inverse transform */
+    for (i = fftLen; i > 1U; i >>= 1U)
+    {
+      exponent--;
+    }
+  }
+
+  return exponent;
+}
+
+/**
+  @} end of ComplexFFTQ15 group
+ */
@@ -41,6 +41,11 @@ extern void riscv_bitreversal_32(
   const uint16_t bitRevLen,
   const uint16_t * pBitRevTable);
 
+extern void riscv_bitreversal_32_inorder(
+        uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
 /**
   @ingroup groupTransforms
  */
@@ -207,8 +212,14 @@ void riscv_cfft_radix8by2_f32 (riscv_cfft_instance_f32 * S, float32_t * p1)
   float32_t * pCol1, * pCol2, * pMid1, * pMid2;
   float32_t * p2 = p1 + L;
   const float32_t * tw = (float32_t *) S->pTwiddle;
+#if defined (RISCV_MATH_VECTOR)
+  vfloat32m2x2_t v_tuple;
+  vfloat32m2_t va_re, va_im, vb_re, vb_im, vc_re, vc_im, vd_re, vd_im, v_twR, v_twI;
+  size_t vl;
+#else
   float32_t t1[4], t2[4], t3[4], t4[4], twR, twI;
   float32_t m0, m1, m2, m3;
+#endif
   uint32_t l;
 
   pCol1 = p1;
@@ -221,6 +232,65 @@ void riscv_cfft_radix8by2_f32 (riscv_cfft_instance_f32 * S, float32_t * p1)
   pMid1 = p1 + L;
   pMid2 = p2 + L;
 
+#if defined (RISCV_MATH_VECTOR)
+  /* do two dot Fourier transform, L / 2 complex samples per quarter */
+  for (l = L >> 1; l > 0; l -= vl)
+  {
+    vl = __riscv_vsetvl_e32m2(l);
+
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2 (p1, vl);
+    va_re = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 0);
+    va_im = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2 (p2, vl);
+    vb_re = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 0);
+    vb_im = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2 (pMid1, vl);
+    vc_re = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 0);
+    vc_im = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2 (pMid2, vl);
+    vd_re = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 0);
+    vd_im = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 1);
+
+    /* col 1 */
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 0, __riscv_vfadd_vv_f32m2 (va_re, vb_re, vl));
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 1, __riscv_vfadd_vv_f32m2 (va_im, vb_im, vl));
+    __riscv_vsseg2e32_v_f32m2x2 (p1, v_tuple, vl);
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 0, __riscv_vfadd_vv_f32m2 (vc_re, vd_re, vl));
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 1, __riscv_vfadd_vv_f32m2 (vc_im, vd_im, vl));
+    __riscv_vsseg2e32_v_f32m2x2 (pMid1, v_tuple, vl);
+
+    /* for col 2 */
+    vb_re = __riscv_vfsub_vv_f32m2 (va_re, vb_re, vl);
+    vb_im = __riscv_vfsub_vv_f32m2 (va_im, vb_im, vl);
+    vd_re = __riscv_vfsub_vv_f32m2 (vd_re, vc_re, vl);
+    vd_im = __riscv_vfsub_vv_f32m2 (vd_im, vc_im, vl);
+
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2 (tw, vl);
+    v_twR = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 0);
+    v_twI = __riscv_vget_v_f32m2x2_f32m2 (v_tuple, 1);
+
+    /* R  =  R  *  Tr - I * Ti, I  =  I  *  Tr + R * Ti */
+    va_re = __riscv_vfmacc_vv_f32m2 (__riscv_vfmul_vv_f32m2 (vb_re, v_twR, vl), vb_im, v_twI, vl);
+    va_im = __riscv_vfnmsac_vv_f32m2 (__riscv_vfmul_vv_f32m2 (vb_im, v_twR, vl), vb_re, v_twI, vl);
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 0, va_re);
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 1, va_im);
+    __riscv_vsseg2e32_v_f32m2x2 (p2, v_tuple, vl);
+
+    /* use vertical symmetry */
+    vc_re = __riscv_vfnmsac_vv_f32m2 (__riscv_vfmul_vv_f32m2 (vd_re, v_twI, vl), vd_im, v_twR, vl);
+    vc_im = __riscv_vfmacc_vv_f32m2 (__riscv_vfmul_vv_f32m2 (vd_im, v_twI, vl), vd_re, v_twR, vl);
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 0, vc_re);
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2 (v_tuple, 1, vc_im);
+    __riscv_vsseg2e32_v_f32m2x2 (pMid2, v_tuple, vl);
+
+    p1 += 2 * vl;
+    p2 += 2 * vl;
+    pMid1 += 2 * vl;
+    pMid2 += 2 * vl;
+    tw += 2 * vl;
+  }
+#else
+
   /* do two dot Fourier transform */
   for (l = L >> 2; l > 0; l-- )
   {
@@ -307,6 +377,7 @@ void riscv_cfft_radix8by2_f32 (riscv_cfft_instance_f32 * S, float32_t * p1)
     *pMid2++ = m0 - m1;
     *pMid2++ = m2 + m3;
   }
+#endif /* defined (RISCV_MATH_VECTOR) */
 
   /* first col */
   riscv_radix8_butterfly_f32 (pCol1, L, (float32_t *) S->pTwiddle, 2U);
@@ -317,6 +388,104 @@ void riscv_cfft_radix8by2_f32 (riscv_cfft_instance_f32 * S, float32_t * p1)
 
 void riscv_cfft_radix8by4_f32 (riscv_cfft_instance_f32 * S, float32_t * p1)
 {
+#if defined (RISCV_MATH_VECTOR)
+    uint32_t    L  = S->fftLen >> 1;
+    float32_t * pCol1, *pCol2, *pCol3, *pCol4;
+    const float32_t *tw = (float32_t *) S->pTwiddle;
+    float32_t * p2 = p1 + L;
+    float32_t * p3 = p2 + L;
+    float32_t * p4 = p3 + L;
+    vfloat32m1x2_t v_tuple;
+    vfloat32m1_t va_re, va_im, vb_re, vb_im, vc_re, vc_im, vd_re, vd_im;
+    vfloat32m1_t vt_re, vt_im, v_twR, v_twI;
+    uint32_t l, k;
+    size_t vl;
+
+    pCol1 = p1;
+    pCol2 = p2;
+    pCol3 = p3;
+    pCol4 = p4;
+
+    L >>= 1;
+
+    /* do four dot Fourier transform, L complex samples per quarter.
+       The twiddles of col 2, 3 and 4 are read with a stride of 1, 2 and 3 complex
+       samples, so no top/bottom symmetry is needed */
+    for (k = 0, l = L; l > 0; l -= vl, k += vl)
+    {
+      vl = __riscv_vsetvl_e32m1(l);
+
+      v_tuple = __riscv_vlseg2e32_v_f32m1x2 (p1, vl);
+      va_re = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+      va_im = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+      v_tuple = __riscv_vlseg2e32_v_f32m1x2 (p2, vl);
+      vb_re = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+      vb_im = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+      v_tuple = __riscv_vlseg2e32_v_f32m1x2 (p3, vl);
+      vc_re = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+      vc_im = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+      v_tuple = __riscv_vlseg2e32_v_f32m1x2 (p4, vl);
+      vd_re = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+      vd_im = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+
+      /* p1 +/- p3 */
+      vt_re = __riscv_vfadd_vv_f32m1 (va_re, vc_re, vl);
+      vt_im = __riscv_vfadd_vv_f32m1 (va_im, vc_im, vl);
+      va_re = __riscv_vfsub_vv_f32m1 (va_re, vc_re, vl);
+      va_im = __riscv_vfsub_vv_f32m1 (va_im, vc_im, vl);
+      /* p2 +/- p4 */
+      vc_re = __riscv_vfadd_vv_f32m1 (vb_re, vd_re, vl);
+      vc_im = __riscv_vfadd_vv_f32m1 (vb_im, vd_im, vl);
+      vb_re = __riscv_vfsub_vv_f32m1 (vb_re, vd_re, vl);
+      vb_im = __riscv_vfsub_vv_f32m1 (vb_im, vd_im, vl);
+
+      /* col 1 */
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 0, __riscv_vfadd_vv_f32m1 (vt_re, vc_re, vl));
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 1, __riscv_vfadd_vv_f32m1 (vt_im, vc_im, vl));
+      __riscv_vsseg2e32_v_f32m1x2 (p1, v_tuple, vl);
+
+      /* col 3 */
+      vt_re = __riscv_vfsub_vv_f32m1 (vt_re, vc_re, vl);
+      vt_im = __riscv_vfsub_vv_f32m1 (vt_im, vc_im, vl);
+      v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (tw + 4 * k, 16, vl);
+      v_twR = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+      v_twI = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+      vc_re = __riscv_vfmacc_vv_f32m1 (__riscv_vfmul_vv_f32m1 (vt_re, v_twR, vl), vt_im, v_twI, vl);
+      vc_im = __riscv_vfnmsac_vv_f32m1 (__riscv_vfmul_vv_f32m1 (vt_im, v_twR, vl), vt_re, v_twI, vl);
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 0, vc_re);
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 1, vc_im);
+      __riscv_vsseg2e32_v_f32m1x2 (p3, v_tuple, vl);
+
+      /* col 2 : (p1 - p3) - j * (p2 - p4) */
+      vt_re = __riscv_vfadd_vv_f32m1 (va_re, vb_im, vl);
+      vt_im = __riscv_vfsub_vv_f32m1 (va_im, vb_re, vl);
+      v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (tw + 2 * k, 8, vl);
+      v_twR = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+      v_twI = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+      vc_re = __riscv_vfmacc_vv_f32m1 (__riscv_vfmul_vv_f32m1 (vt_re, v_twR, vl), vt_im, v_twI, vl);
+      vc_im = __riscv_vfnmsac_vv_f32m1 (__riscv_vfmul_vv_f32m1 (vt_im, v_twR, vl), vt_re, v_twI, vl);
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 0, vc_re);
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 1, vc_im);
+      __riscv_vsseg2e32_v_f32m1x2 (p2, v_tuple, vl);
+
+      /* col 4 : (p1 - p3) + j * (p2 - p4) */
+      vt_re = __riscv_vfsub_vv_f32m1 (va_re, vb_im, vl);
+      vt_im = __riscv_vfadd_vv_f32m1 (va_im, vb_re, vl);
+      v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (tw + 6 * k, 24, vl);
+      v_twR = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+      v_twI = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+      vc_re = __riscv_vfmacc_vv_f32m1 (__riscv_vfmul_vv_f32m1 (vt_re, v_twR, vl), vt_im, v_twI, vl);
+      vc_im = __riscv_vfnmsac_vv_f32m1 (__riscv_vfmul_vv_f32m1 (vt_im, v_twR, vl), vt_re, v_twI, vl);
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 0, vc_re);
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 1, vc_im);
+      __riscv_vsseg2e32_v_f32m1x2 (p4, v_tuple, vl);
+
+      p1 += 2 * vl;
+      p2 += 2 * vl;
+      p3 += 2 * vl;
+      p4 += 2 * vl;
+    }
+#else
     uint32_t    L  = S->fftLen >> 1;
     float32_t * pCol1, *pCol2, *pCol3, *pCol4, *pEnd1, *pEnd2, *pEnd3, *pEnd4;
     const float32_t *tw2, *tw3, *tw4;
@@ -544,6 +713,7 @@ void riscv_cfft_radix8by4_f32 (riscv_cfft_instance_f32 * S, float32_t * p1)
 
     *p4++ = m0 + m1;
     *p4++ = m2 - m3;
+#endif /* defined (RISCV_MATH_VECTOR) */
 
     /* first col */
     riscv_radix8_butterfly_f32 (pCol1, L, (float32_t *) S->pTwiddle, 4U);
@@ -584,16 +754,30 @@ void riscv_cfft_f32(
 {
   uint32_t  L = S->fftLen, l;
   float32_t invL, * pSrc;
+#if defined (RISCV_MATH_VECTOR)
+  vfloat32m8_t v_x;
+  size_t vl;
+#endif
 
   if (ifftFlag == 1U)
   {
     /* Conjugate input data */
     pSrc = p1 + 1;
+#if defined (RISCV_MATH_VECTOR)
+    for (l = L; l > 0; l -= vl)
+    {
+      vl = __riscv_vsetvl_e32m8(l);
+      v_x = __riscv_vlse32_v_f32m8(pSrc, 8, vl);
+      __riscv_vsse32_v_f32m8(pSrc, 8, __riscv_vfneg_v_f32m8(v_x, vl), vl);
+      pSrc += 2 * vl;
+    }
+#else
     for (l = 0; l < L; l++)
     {
       *pSrc = -*pSrc;
       pSrc += 2;
     }
+#endif /* defined (RISCV_MATH_VECTOR) */
   }
 
   switch (L)
@@ -616,7 +800,21 @@ void riscv_cfft_f32(
   }
 
   if ( bitReverseFlag )
+  {
+#if defined (RISCV_MATH_VECTOR)
+    /* The tables of the radix-8 by 2 and by 4 lengths chain the swaps of the permutation cycles */
+    if ((L == 64U) || (L == 512U) || (L == 4096U))
+    {
+      riscv_bitreversal_32 ((uint32_t*) p1, S->bitRevLength, S->pBitRevTable);
+    }
+    else
+    {
+      riscv_bitreversal_32_inorder ((uint32_t*) p1, S->bitRevLength, S->pBitRevTable);
+    }
+#else
     riscv_bitreversal_32 ((uint32_t*) p1, S->bitRevLength, S->pBitRevTable);
+#endif /* defined (RISCV_MATH_VECTOR) */
+  }
 
   if (ifftFlag == 1U)
   {
@@ -624,12 +822,30 @@ void riscv_cfft_f32(
 
     /* Conjugate and scale output data */
     pSrc = p1;
+#if defined (RISCV_MATH_VECTOR)
+    for (l = 2 * L; l > 0; l -= vl)
+    {
+      vl = __riscv_vsetvl_e32m8(l);
+      v_x = __riscv_vle32_v_f32m8(pSrc, vl);
+      __riscv_vse32_v_f32m8(pSrc, __riscv_vfmul_vf_f32m8(v_x, invL, vl), vl);
+      pSrc += vl;
+    }
+    pSrc = p1 + 1;
+    for (l = L; l > 0; l -= vl)
+    {
+      vl = __riscv_vsetvl_e32m8(l);
+      v_x = __riscv_vlse32_v_f32m8(pSrc, 8, vl);
+      __riscv_vsse32_v_f32m8(pSrc, 8, __riscv_vfneg_v_f32m8(v_x, vl), vl);
+      pSrc += 2 * vl;
+    }
+#else
     for (l= 0; l < L; l++)
     {
       *pSrc++ *=   invL ;
       *pSrc    = -(*pSrc) * invL;
       pSrc++;
     }
+#endif /* defined (RISCV_MATH_VECTOR) */
   }
 }
 
@@ -46,6 +46,100 @@ extern void riscv_bitreversal_64(
  * Internal helper function used by the FFTs
  * ---------------------------------------------------------------------- */
 
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+/*
+  brief         Vector radix-4 butterfly applied to vl independent butterflies.
+  param[in,out] pIn       points to the first input of the first butterfly.
+  param[in]     bstride   distance in bytes between two consecutive butterflies.
+  param[in]     n2        distance in complex samples between the 4 inputs of a butterfly.
+  param[in]     pCoef     points to the twiddle of input 1 of the first butterfly, NULL when all twiddles are one.
+  param[in]     tstride   distance in bytes between the twiddles of input 1 of two consecutive butterflies,
+                          input m uses m times this stride (0 broadcasts the same twiddles to every butterfly).
+  param[in]     tstep     distance in doubles between the twiddles of input m and input m + 1 of the first butterfly.
+  param[in]     vl        number of butterflies to compute.
+ */
+static void riscv_radix4_butterfly_vec_f64(
+        float64_t * pIn,
+        ptrdiff_t bstride,
+        uint32_t n2,
+  const float64_t * pCoef,
+        ptrdiff_t tstride,
+        uint32_t tstep,
+        size_t vl)
+{
+  float64_t *p0, *p1, *p2, *p3;
+  vfloat64m2x2_t v_tuple;
+  vfloat64m2_t r1, r2, r3, s1, s2, s3, t1, t2;
+  vfloat64m2_t co, si, vr, vi;
+
+  p0 = pIn;
+  p1 = p0 + 2 * n2;
+  p2 = p1 + 2 * n2;
+  p3 = p2 + 2 * n2;
+
+  /* inputs 0 and 2 */
+  v_tuple = __riscv_vlsseg2e64_v_f64m2x2 (p0, bstride, vl);
+  vr = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 0);
+  vi = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e64_v_f64m2x2 (p2, bstride, vl);
+  t1 = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 0);
+  t2 = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 1);
+  r1 = __riscv_vfadd_vv_f64m2 (vr, t1, vl);
+  r2 = __riscv_vfsub_vv_f64m2 (vr, t1, vl);
+  s1 = __riscv_vfadd_vv_f64m2 (vi, t2, vl);
+  s2 = __riscv_vfsub_vv_f64m2 (vi, t2, vl);
+
+  /* inputs 1 and 3 */
+  v_tuple = __riscv_vlsseg2e64_v_f64m2x2 (p1, bstride, vl);
+  vr = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 0);
+  vi = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e64_v_f64m2x2 (p3, bstride, vl);
+  co = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 0);
+  si = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 1);
+  t1 = __riscv_vfadd_vv_f64m2 (vr, co, vl);     /* xb + xd */
+  t2 = __riscv_vfadd_vv_f64m2 (vi, si, vl);     /* yb + yd */
+
+  /* output 0 never needs a twiddle */
+  v_tuple = __riscv_vset_v_f64m2_f64m2x2 (v_tuple, 0, __riscv_vfadd_vv_f64m2 (r1, t1, vl));
+  v_tuple = __riscv_vset_v_f64m2_f64m2x2 (v_tuple, 1, __riscv_vfadd_vv_f64m2 (s1, t2, vl));
+  __riscv_vssseg2e64_v_f64m2x2 (p0, bstride, v_tuple, vl);
+
+  r1 = __riscv_vfsub_vv_f64m2 (r1, t1, vl);
+  s1 = __riscv_vfsub_vv_f64m2 (s1, t2, vl);
+  t1 = __riscv_vfsub_vv_f64m2 (vi, si, vl);     /* yb - yd */
+  t2 = __riscv_vfsub_vv_f64m2 (vr, co, vl);     /* xb - xd */
+  r3 = __riscv_vfsub_vv_f64m2 (r2, t1, vl);     /* output 3 re */
+  r2 = __riscv_vfadd_vv_f64m2 (r2, t1, vl);     /* output 2 re */
+  s3 = __riscv_vfadd_vv_f64m2 (s2, t2, vl);     /* output 3 im */
+  s2 = __riscv_vfsub_vv_f64m2 (s2, t2, vl);     /* output 2 im */
+
+/* multiply (re, im) by the twiddle of input m and store it to pOut */
+#define RADIX4_VEC_TWIDDLE_STORE(pOut, m, re, im)                                        \
+  if (pCoef != NULL)                                                                     \
+  {                                                                                      \
+    v_tuple = __riscv_vlsseg2e64_v_f64m2x2 (pCoef + ((m) - 1) * tstep, (m) * tstride, vl); \
+    co = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 0);                                      \
+    si = __riscv_vget_v_f64m2x2_f64m2 (v_tuple, 1);                                      \
+    vr = __riscv_vfmacc_vv_f64m2 (__riscv_vfmul_vv_f64m2 (co, re, vl), si, im, vl);      \
+    vi = __riscv_vfnmsac_vv_f64m2 (__riscv_vfmul_vv_f64m2 (co, im, vl), si, re, vl);     \
+    v_tuple = __riscv_vset_v_f64m2_f64m2x2 (v_tuple, 0, vr);                             \
+    v_tuple = __riscv_vset_v_f64m2_f64m2x2 (v_tuple, 1, vi);                             \
+  }                                                                                      \
+  else                                                                                   \
+  {                                                                                      \
+    v_tuple = __riscv_vset_v_f64m2_f64m2x2 (v_tuple, 0, re);                             \
+    v_tuple = __riscv_vset_v_f64m2_f64m2x2 (v_tuple, 1, im);                             \
+  }                                                                                      \
+  __riscv_vssseg2e64_v_f64m2x2 (pOut, bstride, v_tuple, vl);
+
+  RADIX4_VEC_TWIDDLE_STORE(p1, 2, r1, s1);
+  RADIX4_VEC_TWIDDLE_STORE(p2, 1, r2, s2);
+  RADIX4_VEC_TWIDDLE_STORE(p3, 3, r3, s3);
+
+#undef RADIX4_VEC_TWIDDLE_STORE
+}
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64)) */
+
 /*
 * @brief  Core function for the Double Precision floating-point CFFT butterfly process.
 * @param[in, out] *pSrc            points to the in-place buffer of F64 data type.
@@ -61,7 +155,52 @@ void riscv_radix4_butterfly_f64(
   const float64_t * pCoef,
         uint16_t twidCoefModifier)
 {
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+   uint32_t n1, n2, j, i1, k;
+   uint32_t groupCnt;
+   size_t l;
+
+   n2 = fftLen;
+   for (k = fftLen; k > 1U; k >>= 2U)
+   {
+      n1 = n2;
+      n2 >>= 2U;
+      groupCnt = fftLen / n1;
 
+      if (n2 >= groupCnt)
+      {
+         /* Long butterfly groups: one vector holds consecutive butterflies of a group,
+            their twiddles are read with a stride of twidCoefModifier */
+         for (i1 = 0; i1 < fftLen; i1 += n1)
+         {
+            for (j = 0; j < n2; j += l)
+            {
+               l = __riscv_vsetvl_e64m2(n2 - j);
+               riscv_radix4_butterfly_vec_f64(pSrc + 2 * (i1 + j), 16, n2,
+                                              pCoef + 2 * j * twidCoefModifier,
+                                              (ptrdiff_t)twidCoefModifier * 16,
+                                              2 * j * twidCoefModifier, l);
+            }
+         }
+      }
+      else
+      {
+         /* Many short groups: one vector holds the same butterfly of several groups,
+            all lanes share the same twiddles */
+         for (j = 0; j < n2; j++)
+         {
+            for (i1 = j; i1 < fftLen; i1 += l * n1)
+            {
+               l = __riscv_vsetvl_e64m2((fftLen - i1 + n1 - 1) / n1);
+               riscv_radix4_butterfly_vec_f64(pSrc + 2 * i1, (ptrdiff_t)n1 * 16, n2,
+                                              (j == 0) ? NULL : pCoef + 2 * j * twidCoefModifier,
+                                              0, 2 * j * twidCoefModifier, l);
+            }
+         }
+      }
+      twidCoefModifier <<= 2U;
+   }
+#else
    float64_t co1, co2, co3, si1, si2, si3;
    uint32_t ia1, ia2, ia3;
    uint32_t i0, i1, i2, i3;
@@ -178,6 +317,7 @@ void riscv_radix4_butterfly_f64(
       } while (j <= (n2 - 1U));
       twidCoefModifier <<= 2U;
    }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64)) */
 }
 
 /*
@@ -194,8 +334,48 @@ void riscv_cfft_radix4by2_f64(
     uint32_t fftLen,
     const float64_t * pCoef)
 {
+    uint32_t n2;
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+    uint32_t blkCnt;
+    size_t l;
+    float64_t *pA, *pB;
+    const float64_t *pW = pCoef;
+    vfloat64m2x2_t v_a, v_b, v_w;
+    vfloat64m2_t v_ar, v_ai, v_xt, v_yt, v_c, v_s;
+
+    n2 = fftLen >> 1;
+    pA = pSrc;
+    pB = pSrc + 2 * n2;
+    blkCnt = n2;
+    for (; (l = __riscv_vsetvl_e64m2(blkCnt)) > 0; blkCnt -= l)
+    {
+        v_a = __riscv_vlseg2e64_v_f64m2x2(pA, l);
+        v_b = __riscv_vlseg2e64_v_f64m2x2(pB, l);
+        v_w = __riscv_vlseg2e64_v_f64m2x2(pW, l);
+        v_ar = __riscv_vget_v_f64m2x2_f64m2(v_a, 0);
+        v_ai = __riscv_vget_v_f64m2x2_f64m2(v_a, 1);
+        v_xt = __riscv_vget_v_f64m2x2_f64m2(v_b, 0);
+        v_yt = __riscv_vget_v_f64m2x2_f64m2(v_b, 1);
+        v_c = __riscv_vget_v_f64m2x2_f64m2(v_w, 0);
+        v_s = __riscv_vget_v_f64m2x2_f64m2(v_w, 1);
+
+        /*  Butterfly implementation */
+        v_a = __riscv_vset_v_f64m2_f64m2x2(v_a, 0, __riscv_vfadd_vv_f64m2(v_ar, v_xt, l));
+        v_a = __riscv_vset_v_f64m2_f64m2x2(v_a, 1, __riscv_vfadd_vv_f64m2(v_ai, v_yt, l));
+        v_xt = __riscv_vfsub_vv_f64m2(v_ar, v_xt, l);
+        v_yt = __riscv_vfsub_vv_f64m2(v_ai, v_yt, l);
+        v_b = __riscv_vset_v_f64m2_f64m2x2(v_b, 0, __riscv_vfmacc_vv_f64m2(__riscv_vfmul_vv_f64m2(v_xt, v_c, l), v_yt, v_s, l));
+        v_b = __riscv_vset_v_f64m2_f64m2x2(v_b, 1, __riscv_vfnmsac_vv_f64m2(__riscv_vfmul_vv_f64m2(v_yt, v_c, l), v_xt, v_s, l));
+        __riscv_vsseg2e64_v_f64m2x2(pA, v_a, l);
+        __riscv_vsseg2e64_v_f64m2x2(pB, v_b, l);
+
+        pA += 2 * l;
+        pB += 2 * l;
+        pW += 2 * l;
+    }
+#else
     uint32_t i, l;
-    uint32_t n2, ia;
+    uint32_t ia;
     float64_t xt, yt, cosVal, sinVal;
     float64_t p0, p1,p2,p3,a0,a1;
 
@@ -228,6 +408,7 @@ void riscv_cfft_radix4by2_f64(
         pSrc[2 * l + 1] = p2 - p3;
 
     }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64)) */
 
     // first col
     riscv_radix4_butterfly_f64( pSrc, n2, (float64_t*)pCoef, 2U);
@@ -262,16 +443,30 @@ void riscv_cfft_f64(
 {
     uint32_t  L = S->fftLen, l;
     float64_t invL, * pSrc;
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+    vfloat64m8_t v_x;
+    size_t vl;
+#endif
 
     if (ifftFlag == 1U)
     {
         /*  Conjugate input data  */
         pSrc = p1 + 1;
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+        for (l = L; l > 0; l -= vl)
+        {
+            vl = __riscv_vsetvl_e64m8(l);
+            v_x = __riscv_vlse64_v_f64m8(pSrc, 16, vl);
+            __riscv_vsse64_v_f64m8(pSrc, 16, __riscv_vfneg_v_f64m8(v_x, vl), vl);
+            pSrc += 2 * vl;
+        }
+#else
         for(l=0; l<L; l++)
         {
             *pSrc = -*pSrc;
             pSrc += 2;
         }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64)) */
     }
 
     switch (L)
@@ -301,12 +496,30 @@ void riscv_cfft_f64(
         invL = 1.0L / (float64_t)L;
         /*  Conjugate and scale output data */
         pSrc = p1;
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+        for (l = 2 * L; l > 0; l -= vl)
+        {
+            vl = __riscv_vsetvl_e64m8(l);
+            v_x = __riscv_vle64_v_f64m8(pSrc, vl);
+            __riscv_vse64_v_f64m8(pSrc, __riscv_vfmul_vf_f64m8(v_x, invL, vl), vl);
+            pSrc += vl;
+        }
+        pSrc = p1 + 1;
+        for (l = L; l > 0; l -= vl)
+        {
+            vl = __riscv_vsetvl_e64m8(l);
+            v_x = __riscv_vlse64_v_f64m8(pSrc, 16, vl);
+            __riscv_vsse64_v_f64m8(pSrc, 16, __riscv_vfneg_v_f64m8(v_x, vl), vl);
+            pSrc += 2 * vl;
+        }
+#else
         for(l=0; l<L; l++)
         {
             *pSrc++ *=   invL ;
             *pSrc  = -(*pSrc) * invL;
             pSrc++;
         }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64)) */
     }
 }
 
@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_init_dynamic_f32.c
+ * Description:  Initialization function for cfft f32 instance with tables computed at runtime
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/**
+  @addtogroup ComplexFFTF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the cfft f32 function with tables computed at runtime
+  @param[in,out] S              points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen         fft length (number of complex samples)
+  @param[out]    pBuffer        points to a buffer of <code>RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(fftLen)</code>
+                                values receiving the twiddle factors and the bit reversal table
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Description
+                   The instance is initialized with the same twiddle factors and the same
+                   permutation as the tables of <code>riscv_const_structs.h</code>, so it can be
+                   used with \ref riscv_cfft_f32 and any function taking a
+                   <code>riscv_cfft_instance_f32</code>. Supported lengths are 16, 32, 64, ..., 4096.
+  @par
+                   The buffer starts with the <code>2*fftLen</code> twiddle factors followed by
+                   the bit reversal table. It must stay valid for the lifetime of the instance
+                   and may be placed in a fast memory such as a TCM. Only one eighth of the
+                   twiddle factors are computed with the math library, the others are
+                   obtained by symmetry.
+  @par
+                   With <code>RISCV_FFT_NO_ROM_TABLES</code> defined, the table based
+                   initialization functions and the <code>riscv_cfft_sR_f32_lenXXX</code>
+                   structures are neither built nor declared and this function is the way to
+                   initialize the floating-point CFFT. The initialization functions built on
+                   them are replaced the same way by \ref riscv_cfft2d_init_dynamic_f32 and
+                   \ref riscv_mfcc_init_dynamic_f32 (with <code>RISCV_MFCC_CFFT_BASED</code>).
+  @par
+                   The deprecated \ref riscv_cfft_radix2_init_f32 and \ref riscv_cfft_radix4_init_f32
+                   are still built with the option: they use <code>twiddleCoef_4096</code> and
+                   <code>riscvBitRevTable</code>, which stay in the image when they are called.
+ */
+riscv_status riscv_cfft_init_dynamic_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  float32_t *pTwiddle = pBuffer;
+  uint16_t *pBitRev = (uint16_t *) (pBuffer + 2U * fftLen);
+  uint16_t *pPerm = (uint16_t *) pBuffer;       /* Permutation, built in the twiddle area */
+  uint32_t log8, radix, L, j, k, t, d;
+  uint32_t cur, next, n8, n4, n2;
+  uint16_t bitRevLength;
+  float64_t phi;
+
+  if ((S == NULL) || (pBuffer == NULL) || (fftLen < 16U) || (fftLen > 4096U) ||
+      ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* fftLen = radix * 8^log8, with a first radix-2 or radix-4 stage when radix > 1 */
+  log8 = 0U;
+  L = fftLen;
+  while (L >= 8U)
+  {
+    L >>= 3U;
+    log8++;
+  }
+  radix = L;
+  L = fftLen / radix;
+
+  /*
+   * pPerm[j] is the position of output bin j after the butterflies: the first
+   * stage sends bin j to block (j mod radix) and the radix-8 stages leave each
+   * block in octal digit reversed order.
+   */
+  for (j = 0U; j < fftLen; j++)
+  {
+    t = j / radix;
+    d = 0U;
+    for (k = 0U; k < log8; k++)
+    {
+      d = (d << 3U) | (t & 7U);
+      t >>= 3U;
+    }
+    pPerm[j] = (uint16_t) ((j % radix) * L + d);
+  }
+
+  /* Each cycle of the permutation becomes a chain of swaps, visited entries are flagged with bit 15 */
+  bitRevLength = 0U;
+  for (j = 0U; j < fftLen; j++)
+  {
+    if ((pPerm[j] & 0x8000U) != 0U)
+    {
+      continue;
+    }
+    cur = j;
+    next = pPerm[j];
+    pPerm[j] |= 0x8000U;
+    while (next != j)
+    {
+      pBitRev[bitRevLength++] = (uint16_t) (cur * 8U);
+      pBitRev[bitRevLength++] = (uint16_t) (next * 8U);
+      cur = next;
+      next = pPerm[cur] & 0x7FFFU;
+      pPerm[cur] |= 0x8000U;
+    }
+  }
+
+  /* Twiddle factors exp(j*2*pi*k/fftLen): first octant from the math library, the rest by symmetry */
+  n8 = fftLen >> 3U;
+  n4 = fftLen >> 2U;
+  n2 = fftLen >> 1U;
+  for (k = 0U; k <= n8; k++)
+  {
+    phi = 6.283185307179586476925286766559 * (float64_t) k / (float64_t) fftLen;
+    pTwiddle[2U * k]      = (float32_t) cos(phi);
+    pTwiddle[2U * k + 1U] = (float32_t) sin(phi);
+  }
+  for (; k <= n4; k++)
+  {
+    pTwiddle[2U * k]      =  pTwiddle[2U * (n4 - k) + 1U];
+    pTwiddle[2U * k + 1U] =  pTwiddle[2U * (n4 - k)];
+  }
+  for (; k <= n2; k++)
+  {
+    pTwiddle[2U * k]      = -pTwiddle[2U * (n2 - k)];
+    pTwiddle[2U * k + 1U] =  pTwiddle[2U * (n2 - k) + 1U];
+  }
+  for (; k < fftLen; k++)
+  {
+    pTwiddle[2U * k]      =  pTwiddle[2U * (fftLen - k)];
+    pTwiddle[2U * k + 1U] = -pTwiddle[2U * (fftLen - k) + 1U];
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRev;
+  S->bitRevLength = bitRevLength;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFTF32 group
+ */
+
+/**
+  @} end of ComplexFFT group
+ */
@@ -48,6 +48,8 @@
 #include "riscv_common_tables.h"
 #include "riscv_const_structs.h"
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
 #define FFTINIT(EXT,SIZE)                                           \
   S->bitRevLength = riscv_cfft_sR_##EXT##_len##SIZE.bitRevLength;        \
   S->pBitRevTable = riscv_cfft_sR_##EXT##_len##SIZE.pBitRevTable;         \
@@ -285,6 +287,8 @@ riscv_status riscv_cfft_init_f32(
         return (status);
 }
 
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
 /**
   @} end of ComplexFFTF32 group
  */
@@ -0,0 +1,708 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_mixed_f32.c
+ * Description:  Mixed-radix (2, 3, 4, 5) Complex FFT Floating point
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal helper functions
+ *
+ * Each butterfly function processes count butterflies of one stage.
+ * Butterfly j reads its legs at pOut + 2*(j*bstep + u*m), u = 0 ... radix-1,
+ * and multiplies leg u by the conjugate of the twiddle factor with index
+ * u*(twIdx + j*tstep). Butterflies along a group use bstep = 1 and
+ * tstep = stride of the stage, butterflies at the same position of
+ * consecutive groups use bstep = radix*m and tstep = 0.
+ * -------------------------------------------------------------------- */
+
+#if defined (RISCV_MATH_VECTOR)
+static inline vfloat32m2x2_t riscv_cfft_mixed_leg_m2_f32(
+  const float32_t * pIn,
+        ptrdiff_t bstride,
+  const float32_t * pW,
+        ptrdiff_t wstride,
+        size_t l)
+{
+  vfloat32m2x2_t v_x, v_w;
+  vfloat32m2_t v_xr, v_xi, v_c, v_s;
+
+  v_x = __riscv_vlsseg2e32_v_f32m2x2(pIn, bstride, l);
+  v_w = __riscv_vlsseg2e32_v_f32m2x2(pW, wstride, l);
+  v_xr = __riscv_vget_v_f32m2x2_f32m2(v_x, 0);
+  v_xi = __riscv_vget_v_f32m2x2_f32m2(v_x, 1);
+  v_c = __riscv_vget_v_f32m2x2_f32m2(v_w, 0);
+  v_s = __riscv_vget_v_f32m2x2_f32m2(v_w, 1);
+
+  /* x * conj(w) */
+  v_x = __riscv_vset_v_f32m2_f32m2x2(v_x, 0, __riscv_vfmacc_vv_f32m2(__riscv_vfmul_vv_f32m2(v_xr, v_c, l), v_xi, v_s, l));
+  v_x = __riscv_vset_v_f32m2_f32m2x2(v_x, 1, __riscv_vfnmsac_vv_f32m2(__riscv_vfmul_vv_f32m2(v_xi, v_c, l), v_xr, v_s, l));
+
+  return v_x;
+}
+
+static inline vfloat32m1x2_t riscv_cfft_mixed_leg_m1_f32(
+  const float32_t * pIn,
+        ptrdiff_t bstride,
+  const float32_t * pW,
+        ptrdiff_t wstride,
+        size_t l)
+{
+  vfloat32m1x2_t v_x, v_w;
+  vfloat32m1_t v_xr, v_xi, v_c, v_s;
+
+  v_x = __riscv_vlsseg2e32_v_f32m1x2(pIn, bstride, l);
+  v_w = __riscv_vlsseg2e32_v_f32m1x2(pW, wstride, l);
+  v_xr = __riscv_vget_v_f32m1x2_f32m1(v_x, 0);
+  v_xi = __riscv_vget_v_f32m1x2_f32m1(v_x, 1);
+  v_c = __riscv_vget_v_f32m1x2_f32m1(v_w, 0);
+  v_s = __riscv_vget_v_f32m1x2_f32m1(v_w, 1);
+
+  /* x * conj(w) */
+  v_x = __riscv_vset_v_f32m1_f32m1x2(v_x, 0, __riscv_vfmacc_vv_f32m1(__riscv_vfmul_vv_f32m1(v_xr, v_c, l), v_xi, v_s, l));
+  v_x = __riscv_vset_v_f32m1_f32m1x2(v_x, 1, __riscv_vfnmsac_vv_f32m1(__riscv_vfmul_vv_f32m1(v_xi, v_c, l), v_xr, v_s, l));
+
+  return v_x;
+}
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+static void riscv_cfft_mixed_radix2_f32(
+        float32_t * pOut,
+        uint32_t bstep,
+        uint32_t m,
+  const float32_t * pTw,
+        uint32_t twIdx,
+        uint32_t tstep,
+        uint32_t count)
+{
+#if defined (RISCV_MATH_VECTOR)
+  size_t blkCnt = count;
+  size_t l;
+  ptrdiff_t bstride = (ptrdiff_t) bstep * 8;
+  ptrdiff_t tstride = (ptrdiff_t) tstep * 8;
+  vfloat32m2x2_t v_x0, v_x1;
+  vfloat32m2_t v_ar, v_ai, v_br, v_bi;
+
+  for (; (l = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x0 = __riscv_vlsseg2e32_v_f32m2x2(pOut, bstride, l);
+    v_x1 = riscv_cfft_mixed_leg_m2_f32(pOut + 2U * m, bstride, pTw + 2U * twIdx, tstride, l);
+    v_ar = __riscv_vget_v_f32m2x2_f32m2(v_x0, 0);
+    v_ai = __riscv_vget_v_f32m2x2_f32m2(v_x0, 1);
+    v_br = __riscv_vget_v_f32m2x2_f32m2(v_x1, 0);
+    v_bi = __riscv_vget_v_f32m2x2_f32m2(v_x1, 1);
+
+    v_x0 = __riscv_vset_v_f32m2_f32m2x2(v_x0, 0, __riscv_vfadd_vv_f32m2(v_ar, v_br, l));
+    v_x0 = __riscv_vset_v_f32m2_f32m2x2(v_x0, 1, __riscv_vfadd_vv_f32m2(v_ai, v_bi, l));
+    __riscv_vssseg2e32_v_f32m2x2(pOut, bstride, v_x0, l);
+    v_x1 = __riscv_vset_v_f32m2_f32m2x2(v_x1, 0, __riscv_vfsub_vv_f32m2(v_ar, v_br, l));
+    v_x1 = __riscv_vset_v_f32m2_f32m2x2(v_x1, 1, __riscv_vfsub_vv_f32m2(v_ai, v_bi, l));
+    __riscv_vssseg2e32_v_f32m2x2(pOut + 2U * m, bstride, v_x1, l);
+
+    pOut += l * 2U * bstep;
+    twIdx += l * tstep;
+  }
+#else
+  uint32_t j;
+  float32_t *p0, *p1;
+  float32_t c, s, tr, ti;
+
+  for (j = 0U; j < count; j++)
+  {
+    p0 = pOut + 2U * j * bstep;
+    p1 = p0 + 2U * m;
+
+    c = pTw[2U * twIdx];
+    s = pTw[2U * twIdx + 1U];
+    tr = p1[0] * c + p1[1] * s;
+    ti = p1[1] * c - p1[0] * s;
+
+    p1[0] = p0[0] - tr;
+    p1[1] = p0[1] - ti;
+    p0[0] += tr;
+    p0[1] += ti;
+
+    twIdx += tstep;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+static void riscv_cfft_mixed_radix3_f32(
+        float32_t * pOut,
+        uint32_t bstep,
+        uint32_t m,
+  const float32_t * pTw,
+        uint32_t twIdx,
+        uint32_t tstep,
+        uint32_t count,
+        float32_t s3)
+{
+#if defined (RISCV_MATH_VECTOR)
+  size_t blkCnt = count;
+  size_t l;
+  ptrdiff_t bstride = (ptrdiff_t) bstep * 8;
+  ptrdiff_t tstride = (ptrdiff_t) tstep * 8;
+  vfloat32m2x2_t v_x0, v_x1, v_x2;
+  vfloat32m2_t v_ar, v_ai, v_sr, v_si, v_dr, v_di, v_mr, v_mi;
+
+  for (; (l = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x0 = __riscv_vlsseg2e32_v_f32m2x2(pOut, bstride, l);
+    v_x1 = riscv_cfft_mixed_leg_m2_f32(pOut + 2U * m, bstride, pTw + 2U * twIdx, tstride, l);
+    v_x2 = riscv_cfft_mixed_leg_m2_f32(pOut + 4U * m, bstride, pTw + 4U * twIdx, 2 * tstride, l);
+    v_ar = __riscv_vget_v_f32m2x2_f32m2(v_x0, 0);
+    v_ai = __riscv_vget_v_f32m2x2_f32m2(v_x0, 1);
+
+    /* s = x1 + x2, d = x1 - x2 */
+    v_sr = __riscv_vfadd_vv_f32m2(__riscv_vget_v_f32m2x2_f32m2(v_x1, 0), __riscv_vget_v_f32m2x2_f32m2(v_x2, 0), l);
+    v_si = __riscv_vfadd_vv_f32m2(__riscv_vget_v_f32m2x2_f32m2(v_x1, 1), __riscv_vget_v_f32m2x2_f32m2(v_x2, 1), l);
+    v_dr = __riscv_vfsub_vv_f32m2(__riscv_vget_v_f32m2x2_f32m2(v_x1, 0), __riscv_vget_v_f32m2x2_f32m2(v_x2, 0), l);
+    v_di = __riscv_vfsub_vv_f32m2(__riscv_vget_v_f32m2x2_f32m2(v_x1, 1), __riscv_vget_v_f32m2x2_f32m2(v_x2, 1), l);
+
+    /* m = x0 - s/2 */
+    v_mr = __riscv_vfnmsac_vf_f32m2(v_ar, 0.5f, v_sr, l);
+    v_mi = __riscv_vfnmsac_vf_f32m2(v_ai, 0.5f, v_si, l);
+
+    v_x0 = __riscv_vset_v_f32m2_f32m2x2(v_x0, 0, __riscv_vfadd_vv_f32m2(v_ar, v_sr, l));
+    v_x0 = __riscv_vset_v_f32m2_f32m2x2(v_x0, 1, __riscv_vfadd_vv_f32m2(v_ai, v_si, l));
+    __riscv_vssseg2e32_v_f32m2x2(pOut, bstride, v_x0, l);
+
+    /* X1 = m - j*s3*d, X2 = m + j*s3*d */
+    v_x1 = __riscv_vset_v_f32m2_f32m2x2(v_x1, 0, __riscv_vfmacc_vf_f32m2(v_mr, s3, v_di, l));
+    v_x1 = __riscv_vset_v_f32m2_f32m2x2(v_x1, 1, __riscv_vfnmsac_vf_f32m2(v_mi, s3, v_dr, l));
+    __riscv_vssseg2e32_v_f32m2x2(pOut + 2U * m, bstride, v_x1, l);
+    v_x2 = __riscv_vset_v_f32m2_f32m2x2(v_x2, 0, __riscv_vfnmsac_vf_f32m2(v_mr, s3, v_di, l));
+    v_x2 = __riscv_vset_v_f32m2_f32m2x2(v_x2, 1, __riscv_vfmacc_vf_f32m2(v_mi, s3, v_dr, l));
+    __riscv_vssseg2e32_v_f32m2x2(pOut + 4U * m, bstride, v_x2, l);
+
+    pOut += l * 2U * bstep;
+    twIdx += l * tstep;
+  }
+#else
+  uint32_t j;
+  float32_t *p0, *p1, *p2;
+  float32_t c, s;
+  float32_t x1r, x1i, x2r, x2i;
+  float32_t sr, si, dr, di, mr, mi;
+
+  for (j = 0U; j < count; j++)
+  {
+    p0 = pOut + 2U * j * bstep;
+    p1 = p0 + 2U * m;
+    p2 = p1 + 2U * m;
+
+    c = pTw[2U * twIdx];
+    s = pTw[2U * twIdx + 1U];
+    x1r = p1[0] * c + p1[1] * s;
+    x1i = p1[1] * c - p1[0] * s;
+    c = pTw[4U * twIdx];
+    s = pTw[4U * twIdx + 1U];
+    x2r = p2[0] * c + p2[1] * s;
+    x2i = p2[1] * c - p2[0] * s;
+
+    sr = x1r + x2r;
+    si = x1i + x2i;
+    dr = x1r - x2r;
+    di = x1i - x2i;
+    mr = p0[0] - 0.5f * sr;
+    mi = p0[1] - 0.5f * si;
+
+    p0[0] += sr;
+    p0[1] += si;
+    p1[0] = mr + s3 * di;
+    p1[1] = mi - s3 * dr;
+    p2[0] = mr - s3 * di;
+    p2[1] = mi + s3 * dr;
+
+    twIdx += tstep;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+static void riscv_cfft_mixed_radix4_f32(
+        float32_t * pOut,
+        uint32_t bstep,
+        uint32_t m,
+  const float32_t * pTw,
+        uint32_t twIdx,
+        uint32_t tstep,
+        uint32_t count)
+{
+#if defined (RISCV_MATH_VECTOR)
+  size_t blkCnt = count;
+  size_t l;
+  ptrdiff_t bstride = (ptrdiff_t) bstep * 8;
+  ptrdiff_t tstride = (ptrdiff_t) tstep * 8;
+  vfloat32m1x2_t v_x0, v_x1, v_x2, v_x3;
+  vfloat32m1_t v_ar, v_ai, v_br, v_bi, v_cr, v_ci, v_dr, v_di;
+  vfloat32m1_t v_t0r, v_t0i, v_t1r, v_t1i, v_t2r, v_t2i, v_t3r, v_t3i;
+
+  for (; (l = __riscv_vsetvl_e32m1(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x0 = __riscv_vlsseg2e32_v_f32m1x2(pOut, bstride, l);
+    v_x1 = riscv_cfft_mixed_leg_m1_f32(pOut + 2U * m, bstride, pTw + 2U * twIdx, tstride, l);
+    v_x2 = riscv_cfft_mixed_leg_m1_f32(pOut + 4U * m, bstride, pTw + 4U * twIdx, 2 * tstride, l);
+    v_x3 = riscv_cfft_mixed_leg_m1_f32(pOut + 6U * m, bstride, pTw + 6U * twIdx, 3 * tstride, l);
+    v_ar = __riscv_vget_v_f32m1x2_f32m1(v_x0, 0);
+    v_ai = __riscv_vget_v_f32m1x2_f32m1(v_x0, 1);
+    v_br = __riscv_vget_v_f32m1x2_f32m1(v_x1, 0);
+    v_bi = __riscv_vget_v_f32m1x2_f32m1(v_x1, 1);
+    v_cr = __riscv_vget_v_f32m1x2_f32m1(v_x2, 0);
+    v_ci = __riscv_vget_v_f32m1x2_f32m1(v_x2, 1);
+    v_dr = __riscv_vget_v_f32m1x2_f32m1(v_x3, 0);
+    v_di = __riscv_vget_v_f32m1x2_f32m1(v_x3, 1);
+
+    /* t0 = x0 + x2, t1 = x0 - x2, t2 = x1 + x3, t3 = x1 - x3 */
+    v_t0r = __riscv_vfadd_vv_f32m1(v_ar, v_cr, l);
+    v_t0i = __riscv_vfadd_vv_f32m1(v_ai, v_ci, l);
+    v_t1r = __riscv_vfsub_vv_f32m1(v_ar, v_cr, l);
+    v_t1i = __riscv_vfsub_vv_f32m1(v_ai, v_ci, l);
+    v_t2r = __riscv_vfadd_vv_f32m1(v_br, v_dr, l);
+    v_t2i = __riscv_vfadd_vv_f32m1(v_bi, v_di, l);
+    v_t3r = __riscv_vfsub_vv_f32m1(v_br, v_dr, l);
+    v_t3i = __riscv_vfsub_vv_f32m1(v_bi, v_di, l);
+
+    /* X0 = t0 + t2, X2 = t0 - t2 */
+    v_x0 = __riscv_vset_v_f32m1_f32m1x2(v_x0, 0, __riscv_vfadd_vv_f32m1(v_t0r, v_t2r, l));
+    v_x0 = __riscv_vset_v_f32m1_f32m1x2(v_x0, 1, __riscv_vfadd_vv_f32m1(v_t0i, v_t2i, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut, bstride, v_x0, l);
+    v_x2 = __riscv_vset_v_f32m1_f32m1x2(v_x2, 0, __riscv_vfsub_vv_f32m1(v_t0r, v_t2r, l));
+    v_x2 = __riscv_vset_v_f32m1_f32m1x2(v_x2, 1, __riscv_vfsub_vv_f32m1(v_t0i, v_t2i, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut + 4U * m, bstride, v_x2, l);
+
+    /* X1 = t1 - j*t3, X3 = t1 + j*t3 */
+    v_x1 = __riscv_vset_v_f32m1_f32m1x2(v_x1, 0, __riscv_vfadd_vv_f32m1(v_t1r, v_t3i, l));
+    v_x1 = __riscv_vset_v_f32m1_f32m1x2(v_x1, 1, __riscv_vfsub_vv_f32m1(v_t1i, v_t3r, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut + 2U * m, bstride, v_x1, l);
+    v_x3 = __riscv_vset_v_f32m1_f32m1x2(v_x3, 0, __riscv_vfsub_vv_f32m1(v_t1r, v_t3i, l));
+    v_x3 = __riscv_vset_v_f32m1_f32m1x2(v_x3, 1, __riscv_vfadd_vv_f32m1(v_t1i, v_t3r, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut + 6U * m, bstride, v_x3, l);
+
+    pOut += l * 2U * bstep;
+    twIdx += l * tstep;
+  }
+#else
+  uint32_t j;
+  float32_t *p0, *p1, *p2, *p3;
+  float32_t c, s;
+  float32_t x1r, x1i, x2r, x2i, x3r, x3i;
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+  for (j = 0U; j < count; j++)
+  {
+    p0 = pOut + 2U * j * bstep;
+    p1 = p0 + 2U * m;
+    p2 = p1 + 2U * m;
+    p3 = p2 + 2U * m;
+
+    c = pTw[2U * twIdx];
+    s = pTw[2U * twIdx + 1U];
+    x1r = p1[0] * c + p1[1] * s;
+    x1i = p1[1] * c - p1[0] * s;
+    c = pTw[4U * twIdx];
+    s = pTw[4U * twIdx + 1U];
+    x2r = p2[0] * c + p2[1] * s;
+    x2i = p2[1] * c - p2[0] * s;
+    c = pTw[6U * twIdx];
+    s = pTw[6U * twIdx + 1U];
+    x3r = p3[0] * c + p3[1] * s;
+    x3i = p3[1] * c - p3[0] * s;
+
+    t0r = p0[0] + x2r;
+    t0i = p0[1] + x2i;
+    t1r = p0[0] - x2r;
+    t1i = p0[1] - x2i;
+    t2r = x1r + x3r;
+    t2i = x1i + x3i;
+    t3r = x1r - x3r;
+    t3i = x1i - x3i;
+
+    p0[0] = t0r + t2r;
+    p0[1] = t0i + t2i;
+    p2[0] = t0r - t2r;
+    p2[1] = t0i - t2i;
+    p1[0] = t1r + t3i;
+    p1[1] = t1i - t3r;
+    p3[0] = t1r - t3i;
+    p3[1] = t1i + t3r;
+
+    twIdx += tstep;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+static void riscv_cfft_mixed_radix5_f32(
+        float32_t * pOut,
+        uint32_t bstep,
+        uint32_t m,
+  const float32_t * pTw,
+        uint32_t twIdx,
+        uint32_t tstep,
+        uint32_t count,
+  const float32_t * pW5)
+{
+  float32_t c1 = pW5[0];                    /* cos(2*pi/5) */
+  float32_t s1 = pW5[1];                    /* sin(2*pi/5) */
+  float32_t c2 = pW5[2];                    /* cos(4*pi/5) */
+  float32_t s2 = pW5[3];                    /* sin(4*pi/5) */
+#if defined (RISCV_MATH_VECTOR)
+  size_t blkCnt = count;
+  size_t l;
+  ptrdiff_t bstride = (ptrdiff_t) bstep * 8;
+  ptrdiff_t tstride = (ptrdiff_t) tstep * 8;
+  vfloat32m1x2_t v_x0, v_x1, v_x2, v_x3, v_x4;
+  vfloat32m1_t v_ar, v_ai, v_pr, v_pi, v_qr, v_qi, v_dr, v_di, v_er, v_ei;
+  vfloat32m1_t v_ur, v_ui, v_vr, v_vi, v_yr, v_yi;
+
+  for (; (l = __riscv_vsetvl_e32m1(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x0 = __riscv_vlsseg2e32_v_f32m1x2(pOut, bstride, l);
+    v_x1 = riscv_cfft_mixed_leg_m1_f32(pOut + 2U * m, bstride, pTw + 2U * twIdx, tstride, l);
+    v_x2 = riscv_cfft_mixed_leg_m1_f32(pOut + 4U * m, bstride, pTw + 4U * twIdx, 2 * tstride, l);
+    v_x3 = riscv_cfft_mixed_leg_m1_f32(pOut + 6U * m, bstride, pTw + 6U * twIdx, 3 * tstride, l);
+    v_x4 = riscv_cfft_mixed_leg_m1_f32(pOut + 8U * m, bstride, pTw + 8U * twIdx, 4 * tstride, l);
+    v_ar = __riscv_vget_v_f32m1x2_f32m1(v_x0, 0);
+    v_ai = __riscv_vget_v_f32m1x2_f32m1(v_x0, 1);
+
+    /* p = x1 + x4, d = x1 - x4, q = x2 + x3, e = x2 - x3 */
+    v_pr = __riscv_vfadd_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x1, 0), __riscv_vget_v_f32m1x2_f32m1(v_x4, 0), l);
+    v_pi = __riscv_vfadd_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x1, 1), __riscv_vget_v_f32m1x2_f32m1(v_x4, 1), l);
+    v_dr = __riscv_vfsub_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x1, 0), __riscv_vget_v_f32m1x2_f32m1(v_x4, 0), l);
+    v_di = __riscv_vfsub_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x1, 1), __riscv_vget_v_f32m1x2_f32m1(v_x4, 1), l);
+    v_qr = __riscv_vfadd_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x2, 0), __riscv_vget_v_f32m1x2_f32m1(v_x3, 0), l);
+    v_qi = __riscv_vfadd_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x2, 1), __riscv_vget_v_f32m1x2_f32m1(v_x3, 1), l);
+    v_er = __riscv_vfsub_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x2, 0), __riscv_vget_v_f32m1x2_f32m1(v_x3, 0), l);
+    v_ei = __riscv_vfsub_vv_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_x2, 1), __riscv_vget_v_f32m1x2_f32m1(v_x3, 1), l);
+
+    /* X0 = x0 + p + q */
+    v_x0 = __riscv_vset_v_f32m1_f32m1x2(v_x0, 0, __riscv_vfadd_vv_f32m1(v_ar, __riscv_vfadd_vv_f32m1(v_pr, v_qr, l), l));
+    v_x0 = __riscv_vset_v_f32m1_f32m1x2(v_x0, 1, __riscv_vfadd_vv_f32m1(v_ai, __riscv_vfadd_vv_f32m1(v_pi, v_qi, l), l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut, bstride, v_x0, l);
+
+    /* X1, X4 = x0 + c1*p + c2*q -/+ j*(s1*d + s2*e) */
+    v_ur = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(v_ar, c1, v_pr, l), c2, v_qr, l);
+    v_ui = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(v_ai, c1, v_pi, l), c2, v_qi, l);
+    v_yr = __riscv_vfmacc_vf_f32m1(__riscv_vfmul_vf_f32m1(v_di, s1, l), s2, v_ei, l);
+    v_yi = __riscv_vfmacc_vf_f32m1(__riscv_vfmul_vf_f32m1(v_dr, s1, l), s2, v_er, l);
+    v_x1 = __riscv_vset_v_f32m1_f32m1x2(v_x1, 0, __riscv_vfadd_vv_f32m1(v_ur, v_yr, l));
+    v_x1 = __riscv_vset_v_f32m1_f32m1x2(v_x1, 1, __riscv_vfsub_vv_f32m1(v_ui, v_yi, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut + 2U * m, bstride, v_x1, l);
+    v_x4 = __riscv_vset_v_f32m1_f32m1x2(v_x4, 0, __riscv_vfsub_vv_f32m1(v_ur, v_yr, l));
+    v_x4 = __riscv_vset_v_f32m1_f32m1x2(v_x4, 1, __riscv_vfadd_vv_f32m1(v_ui, v_yi, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut + 8U * m, bstride, v_x4, l);
+
+    /* X2, X3 = x0 + c2*p + c1*q -/+ j*(s2*d - s1*e) */
+    v_vr = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(v_ar, c2, v_pr, l), c1, v_qr, l);
+    v_vi = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(v_ai, c2, v_pi, l), c1, v_qi, l);
+    v_yr = __riscv_vfnmsac_vf_f32m1(__riscv_vfmul_vf_f32m1(v_di, s2, l), s1, v_ei, l);
+    v_yi = __riscv_vfnmsac_vf_f32m1(__riscv_vfmul_vf_f32m1(v_dr, s2, l), s1, v_er, l);
+    v_x2 = __riscv_vset_v_f32m1_f32m1x2(v_x2, 0, __riscv_vfadd_vv_f32m1(v_vr, v_yr, l));
+    v_x2 = __riscv_vset_v_f32m1_f32m1x2(v_x2, 1, __riscv_vfsub_vv_f32m1(v_vi, v_yi, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut + 4U * m, bstride, v_x2, l);
+    v_x3 = __riscv_vset_v_f32m1_f32m1x2(v_x3, 0, __riscv_vfsub_vv_f32m1(v_vr, v_yr, l));
+    v_x3 = __riscv_vset_v_f32m1_f32m1x2(v_x3, 1, __riscv_vfadd_vv_f32m1(v_vi, v_yi, l));
+    __riscv_vssseg2e32_v_f32m1x2(pOut + 6U * m, bstride, v_x3, l);
+
+    pOut += l * 2U * bstep;
+    twIdx += l * tstep;
+  }
+#else
+  uint32_t j;
+  float32_t *p0, *p1, *p2, *p3, *p4;
+  float32_t c, s;
+  float32_t x1r, x1i, x2r, x2i, x3r, x3i, x4r, x4i;
+  float32_t pr, pi, qr, qi, dr, di, er, ei;
+  float32_t ur, ui, vr, vi, yr, yi;
+
+  for (j = 0U; j < count; j++)
+  {
+    p0 = pOut + 2U * j * bstep;
+    p1 = p0 + 2U * m;
+    p2 = p1 + 2U * m;
+    p3 = p2 + 2U * m;
+    p4 = p3 + 2U * m;
+
+    c = pTw[2U * twIdx];
+    s = pTw[2U * twIdx + 1U];
+    x1r = p1[0] * c + p1[1] * s;
+    x1i = p1[1] * c - p1[0] * s;
+    c = pTw[4U * twIdx];
+    s = pTw[4U * twIdx + 1U];
+    x2r = p2[0] * c + p2[1] * s;
+    x2i = p2[1] * c - p2[0] * s;
+    c = pTw[6U * twIdx];
+    s = pTw[6U * twIdx + 1U];
+    x3r = p3[0] * c + p3[1] * s;
+    x3i = p3[1] * c - p3[0] * s;
+    c = pTw[8U * twIdx];
+    s = pTw[8U * twIdx + 1U];
+    x4r = p4[0] * c + p4[1] * s;
+    x4i = p4[1] * c - p4[0] * s;
+
+    pr = x1r + x4r;
+    pi = x1i + x4i;
+    dr = x1r - x4r;
+    di = x1i - x4i;
+    qr = x2r + x3r;
+    qi = x2i + x3i;
+    er = x2r - x3r;
+    ei = x2i - x3i;
+
+    ur = p0[0] + c1 * pr + c2 * qr;
+    ui = p0[1] + c1 * pi + c2 * qi;
+    vr = p0[0] + c2 * pr + c1 * qr;
+    vi = p0[1] + c2 * pi + c1 * qi;
+
+    p0[0] += pr + qr;
+    p0[1] += pi + qi;
+
+    yr = s1 * di + s2 * ei;
+    yi = s1 * dr + s2 * er;
+    p1[0] = ur + yr;
+    p1[1] = ui - yi;
+    p4[0] = ur - yr;
+    p4[1] = ui + yi;
+
+    yr = s2 * di - s1 * ei;
+    yi = s2 * dr - s1 * er;
+    p2[0] = vr + yr;
+    p2[1] = vi - yi;
+    p3[0] = vr - yr;
+    p3[1] = vi + yi;
+
+    twIdx += tstep;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+/* Copy the input in digit reversed order, conjugating it for the inverse transform */
+static void riscv_cfft_mixed_digitrev_f32(
+  const riscv_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint8_t ifftFlag)
+{
+  const uint16_t *pRev = S->pDigitRevTable;
+#if defined (RISCV_MATH_VECTOR)
+  size_t blkCnt = S->fftLen;
+  size_t l;
+  vuint32m4_t v_off;
+  vfloat32m4x2_t v_x;
+
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    /* byte offset of each complex input sample */
+    v_off = __riscv_vsll_vx_u32m4(__riscv_vzext_vf2_u32m4(__riscv_vle16_v_u16m2(pRev, l), l), 3, l);
+    v_x = __riscv_vluxseg2ei32_v_f32m4x2(pSrc, v_off, l);
+    if (ifftFlag)
+    {
+      v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 1, __riscv_vfneg_v_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_x, 1), l));
+    }
+    __riscv_vsseg2e32_v_f32m4x2(pDst, v_x, l);
+    pRev += l;
+    pDst += l * 2;
+  }
+#else
+  uint32_t i;
+  uint32_t n = S->fftLen;
+
+  if (ifftFlag)
+  {
+    for (i = 0U; i < n; i++)
+    {
+      pDst[2U * i]      =  pSrc[2U * pRev[i]];
+      pDst[2U * i + 1U] = -pSrc[2U * pRev[i] + 1U];
+    }
+  }
+  else
+  {
+    for (i = 0U; i < n; i++)
+    {
+      pDst[2U * i]      = pSrc[2U * pRev[i]];
+      pDst[2U * i + 1U] = pSrc[2U * pRev[i] + 1U];
+    }
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MixedRadixFFT Mixed-Radix FFT Functions
+
+  @par
+                   The mixed-radix FFT functions compute complex and real FFTs whose length
+                   is any product of 2, 3 and 5, for instance the 480 and 960 point
+                   transforms of 10 ms frames at 48 kHz, without zero padding to the next
+                   power of two.
+  @par
+                   The length is split into radix-2, radix-3, radix-4 and radix-5 stages.
+                   The plan of a given length (stage radices, twiddle factors and digit
+                   reversal table) is computed once by \ref riscv_cfft_mixed_init_f32() or
+                   \ref riscv_rfft_mixed_init_f32() into buffers provided by the caller.
+                   Several instances of the same length can share those buffers.
+  @par
+                   The complex transform is out-of-place: the input is read in digit reversed
+                   order into the output buffer, and the butterflies run in-place on the output
+                   buffer. The input buffer is not modified. As for \ref riscv_cfft_f32(), the
+                   inverse transform is scaled by 1/fftLen.
+  @par
+                   The real transform uses a complex transform of half length and the same
+                   packed output format as \ref riscv_rfft_fast_f32(): the first complex number
+                   holds the DC value in the real part and the Nyquist value in the imaginary part.
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed-radix complex FFT.
+  @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     pSrc      points to the complex input buffer of size <code>2*fftLen</code>
+  @param[out]    pDst      points to the complex output buffer of size <code>2*fftLen</code>.
+                           Must not overlap pSrc.
+  @param[in]     ifftFlag  flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+ */
+
+void riscv_cfft_mixed_f32(
+  const riscv_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint8_t ifftFlag)
+{
+  const float32_t *pTw = S->pTwiddle;
+  uint32_t fftLen = S->fftLen;
+  uint32_t stage, radix, m, stride, i;
+  float32_t pW5[4];
+  float32_t *pBlk;
+
+  riscv_cfft_mixed_digitrev_f32(S, pSrc, pDst, ifftFlag);
+
+  m = 1U;
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->pRadix[stage];
+    /* number of groups in this stage, also the twiddle stride */
+    stride = fftLen / (radix * m);
+
+    if (radix == 5U)
+    {
+      pW5[0] = pTw[2U * (fftLen / 5U)];
+      pW5[1] = pTw[2U * (fftLen / 5U) + 1U];
+      pW5[2] = pTw[4U * (fftLen / 5U)];
+      pW5[3] = pTw[4U * (fftLen / 5U) + 1U];
+    }
+
+    /*
+     * Run the butterflies along the groups while the groups are long,
+     * and across the groups otherwise, so that vector length stays large.
+     */
+    if (m >= stride)
+    {
+      for (i = 0U; i < stride; i++)
+      {
+        pBlk = pDst + 2U * i * radix * m;
+        switch (radix)
+        {
+        case 2U:
+          riscv_cfft_mixed_radix2_f32(pBlk, 1U, m, pTw, 0U, stride, m);
+          break;
+        case 3U:
+          riscv_cfft_mixed_radix3_f32(pBlk, 1U, m, pTw, 0U, stride, m, pTw[2U * (fftLen / 3U) + 1U]);
+          break;
+        case 4U:
+          riscv_cfft_mixed_radix4_f32(pBlk, 1U, m, pTw, 0U, stride, m);
+          break;
+        default:
+          riscv_cfft_mixed_radix5_f32(pBlk, 1U, m, pTw, 0U, stride, m, pW5);
+          break;
+        }
+      }
+    }
+    else
+    {
+      for (i = 0U; i < m; i++)
+      {
+        pBlk = pDst + 2U * i;
+        switch (radix)
+        {
+        case 2U:
+          riscv_cfft_mixed_radix2_f32(pBlk, radix * m, m, pTw, i * stride, 0U, stride);
+          break;
+        case 3U:
+          riscv_cfft_mixed_radix3_f32(pBlk, radix * m, m, pTw, i * stride, 0U, stride, pTw[2U * (fftLen / 3U) + 1U]);
+          break;
+        case 4U:
+          riscv_cfft_mixed_radix4_f32(pBlk, radix * m, m, pTw, i * stride, 0U, stride);
+          break;
+        default:
+          riscv_cfft_mixed_radix5_f32(pBlk, radix * m, m, pTw, i * stride, 0U, stride, pW5);
+          break;
+        }
+      }
+    }
+
+    m *= radix;
+  }
+
+  /* Inverse transform: conjugate and scale the output */
+  if (ifftFlag)
+  {
+    float32_t invL = 1.0f / (float32_t) fftLen;
+#if defined (RISCV_MATH_VECTOR)
+    size_t blkCnt = fftLen;
+    size_t l;
+    float32_t *pOut = pDst;
+    vfloat32m4x2_t v_x;
+
+    for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+    {
+      v_x = __riscv_vlseg2e32_v_f32m4x2(pOut, l);
+      v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 0, __riscv_vfmul_vf_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_x, 0), invL, l));
+      v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 1, __riscv_vfmul_vf_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_x, 1), -invL, l));
+      __riscv_vsseg2e32_v_f32m4x2(pOut, v_x, l);
+      pOut += l * 2;
+    }
+#else
+    for (i = 0U; i < fftLen; i++)
+    {
+      pDst[2U * i]      *=  invL;
+      pDst[2U * i + 1U] *= -invL;
+    }
+#endif /* defined (RISCV_MATH_VECTOR) */
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix cfft f32 instance
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix CFFT.
+  @param[in,out] S               points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     fftLen          length of the FFT
+  @param[out]    pTwiddle        points to a buffer of 2*fftLen values receiving the twiddle factors
+  @param[out]    pDigitRevTable  points to a buffer of fftLen values receiving the digit reversal table
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen is not a product of 2, 3 and 5
+
+  @par           Details
+                   The length is split into radix-5, radix-3, radix-2 and radix-4 stages,
+                   executed in that order. The plan (stage radices, twiddle factors and
+                   digit reversal table) is computed once here so the processing function
+                   only performs butterflies.
+  @par
+                   The twiddle buffer is filled with
+  <pre>
+      pTwiddle[2*k]   = cos(2*pi*k/fftLen)
+      pTwiddle[2*k+1] = sin(2*pi*k/fftLen)
+  </pre>
+                   for k = 0 ... fftLen-1. Both buffers must stay valid for the lifetime of the instance
+                   and can be shared by instances of the same length.
+ */
+
+riscv_status riscv_cfft_mixed_init_f32(
+  riscv_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pDigitRevTable)
+{
+  uint8_t factors[RISCV_CFFT_MIXED_MAX_STAGES];  /* Radices, last stage first */
+  uint32_t numStages = 0U;
+  uint32_t n = fftLen;
+  uint32_t i, k, s;
+  uint32_t r, m, idx, stride;
+  float64_t phi;
+
+  if ((S == NULL) || (pTwiddle == NULL) || (pDigitRevTable == NULL) || (fftLen < 2U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Factor the length: radix-4 stages last, then radix-2, radix-3 and radix-5 */
+  while (n > 1U)
+  {
+    if ((n % 4U) == 0U)
+    {
+      factors[numStages] = 4U;
+    }
+    else if ((n % 2U) == 0U)
+    {
+      factors[numStages] = 2U;
+    }
+    else if ((n % 3U) == 0U)
+    {
+      factors[numStages] = 3U;
+    }
+    else if ((n % 5U) == 0U)
+    {
+      factors[numStages] = 5U;
+    }
+    else
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+    n /= factors[numStages];
+    numStages++;
+  }
+
+  S->fftLen = fftLen;
+  S->numStages = (uint16_t) numStages;
+
+  /* Stages are stored in execution order */
+  for (s = 0U; s < numStages; s++)
+  {
+    S->pRadix[s] = factors[numStages - 1U - s];
+  }
+
+  /* Twiddle factors exp(j*2*pi*k/N) */
+  for (k = 0U; k < fftLen; k++)
+  {
+    phi = 6.283185307179586476925286766559 * (float64_t) k / (float64_t) fftLen;
+    pTwiddle[2U * k]      = (float32_t) cos(phi);
+    pTwiddle[2U * k + 1U] = (float32_t) sin(phi);
+  }
+
+  /*
+   * Digit reversal: output position i = sum(q_s * m_s), with m_s the product of the
+   * radices of the stages executed before stage s, is fed by input sample sum(q_s * stride_s),
+   * with stride_s the product of the radices of the stages executed after stage s.
+   */
+  for (i = 0U; i < fftLen; i++)
+  {
+    r = i;
+    m = fftLen;
+    idx = 0U;
+    stride = 1U;
+    for (s = 0U; s < numStages; s++)
+    {
+      m /= factors[s];
+      idx += (r / m) * stride;
+      r = r % m;
+      stride *= factors[s];
+    }
+    pDigitRevTable[i] = (uint16_t) idx;
+  }
+
+  S->pTwiddle = pTwiddle;
+  S->pDigitRevTable = pDigitRevTable;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
@@ -34,6 +34,167 @@
  * Internal helper function used by the FFTs
  * -------------------------------------------------------------------- */
 
+#if defined (RISCV_MATH_VECTOR)
+/*
+  brief         Vector radix-8 butterfly applied to vl independent butterflies.
+  param[in,out] pIn       points to the first input of the first butterfly.
+  param[in]     bstride   distance in bytes between two consecutive butterflies.
+  param[in]     n2        distance in complex samples between the 8 inputs of a butterfly.
+  param[in]     pCoef     points to the twiddle of input 1 of the first butterfly, NULL when all twiddles are one.
+  param[in]     tstride   distance in bytes between the twiddles of input 1 of two consecutive butterflies,
+                          input m uses m times this stride (0 broadcasts the same twiddles to every butterfly).
+  param[in]     tstep     distance in floats between the twiddles of input m and input m + 1 of the first butterfly.
+  param[in]     vl        number of butterflies to compute.
+ */
+static void riscv_radix8_butterfly_vec_f32(
+        float32_t * pIn,
+        ptrdiff_t bstride,
+        uint32_t n2,
+  const float32_t * pCoef,
+        ptrdiff_t tstride,
+        uint32_t tstep,
+        size_t vl)
+{
+  const float32_t C81 = 0.70710678118f;
+  float32_t *p1, *p2, *p3, *p4, *p5, *p6, *p7, *p8;
+  vfloat32m1x2_t v_tuple;
+  vfloat32m1_t r1, r2, r3, r4, r5, r6, r7, r8;
+  vfloat32m1_t s1, s2, s3, s4, s5, s6, s7, s8;
+  vfloat32m1_t t1, t2, co, si, vr, vi;
+
+  p1 = pIn;
+  p2 = p1 + 2 * n2;
+  p3 = p2 + 2 * n2;
+  p4 = p3 + 2 * n2;
+  p5 = p4 + 2 * n2;
+  p6 = p5 + 2 * n2;
+  p7 = p6 + 2 * n2;
+  p8 = p7 + 2 * n2;
+
+  /* inputs 1 and 5 */
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p1, bstride, vl);
+  vr = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  vi = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p5, bstride, vl);
+  t1 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  t2 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  r1 = __riscv_vfadd_vv_f32m1 (vr, t1, vl);
+  r5 = __riscv_vfsub_vv_f32m1 (vr, t1, vl);
+  s1 = __riscv_vfadd_vv_f32m1 (vi, t2, vl);
+  s5 = __riscv_vfsub_vv_f32m1 (vi, t2, vl);
+
+  /* inputs 2 and 6 */
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p2, bstride, vl);
+  vr = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  vi = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p6, bstride, vl);
+  t1 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  t2 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  r2 = __riscv_vfadd_vv_f32m1 (vr, t1, vl);
+  r6 = __riscv_vfsub_vv_f32m1 (vr, t1, vl);
+  s2 = __riscv_vfadd_vv_f32m1 (vi, t2, vl);
+  s6 = __riscv_vfsub_vv_f32m1 (vi, t2, vl);
+
+  /* inputs 3 and 7 */
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p3, bstride, vl);
+  vr = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  vi = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p7, bstride, vl);
+  t1 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  t2 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  r3 = __riscv_vfadd_vv_f32m1 (vr, t1, vl);
+  r7 = __riscv_vfsub_vv_f32m1 (vr, t1, vl);
+  s3 = __riscv_vfadd_vv_f32m1 (vi, t2, vl);
+  s7 = __riscv_vfsub_vv_f32m1 (vi, t2, vl);
+
+  /* inputs 4 and 8 */
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p4, bstride, vl);
+  vr = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  vi = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (p8, bstride, vl);
+  t1 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);
+  t2 = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);
+  r4 = __riscv_vfadd_vv_f32m1 (vr, t1, vl);
+  r8 = __riscv_vfsub_vv_f32m1 (vr, t1, vl);
+  s4 = __riscv_vfadd_vv_f32m1 (vi, t2, vl);
+  s8 = __riscv_vfsub_vv_f32m1 (vi, t2, vl);
+
+  /* even outputs: radix-4 on (r1, s1) .. (r4, s4) */
+  t1 = __riscv_vfsub_vv_f32m1 (r1, r3, vl);
+  r1 = __riscv_vfadd_vv_f32m1 (r1, r3, vl);
+  r3 = __riscv_vfsub_vv_f32m1 (r2, r4, vl);
+  r2 = __riscv_vfadd_vv_f32m1 (r2, r4, vl);
+  t2 = __riscv_vfsub_vv_f32m1 (s1, s3, vl);
+  s1 = __riscv_vfadd_vv_f32m1 (s1, s3, vl);
+  s3 = __riscv_vfsub_vv_f32m1 (s2, s4, vl);
+  s2 = __riscv_vfadd_vv_f32m1 (s2, s4, vl);
+
+  /* output 1 never needs a twiddle */
+  v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 0, __riscv_vfadd_vv_f32m1 (r1, r2, vl));
+  v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 1, __riscv_vfadd_vv_f32m1 (s1, s2, vl));
+  __riscv_vssseg2e32_v_f32m1x2 (p1, bstride, v_tuple, vl);
+
+  /* (re, im) of outputs 5, 3 and 7 before the twiddle multiplication */
+  r2 = __riscv_vfsub_vv_f32m1 (r1, r2, vl);
+  s2 = __riscv_vfsub_vv_f32m1 (s1, s2, vl);
+  r1 = __riscv_vfadd_vv_f32m1 (t1, s3, vl);
+  t1 = __riscv_vfsub_vv_f32m1 (t1, s3, vl);
+  s1 = __riscv_vfsub_vv_f32m1 (t2, r3, vl);
+  t2 = __riscv_vfadd_vv_f32m1 (t2, r3, vl);
+
+  /* odd outputs */
+  r4 = __riscv_vfmul_vf_f32m1 (__riscv_vfsub_vv_f32m1 (r6, r8, vl), C81, vl);
+  r6 = __riscv_vfmul_vf_f32m1 (__riscv_vfadd_vv_f32m1 (r6, r8, vl), C81, vl);
+  s4 = __riscv_vfmul_vf_f32m1 (__riscv_vfsub_vv_f32m1 (s6, s8, vl), C81, vl);
+  s6 = __riscv_vfmul_vf_f32m1 (__riscv_vfadd_vv_f32m1 (s6, s8, vl), C81, vl);
+  r3 = __riscv_vfsub_vv_f32m1 (r5, r4, vl);
+  r5 = __riscv_vfadd_vv_f32m1 (r5, r4, vl);
+  r8 = __riscv_vfsub_vv_f32m1 (r7, r6, vl);
+  r7 = __riscv_vfadd_vv_f32m1 (r7, r6, vl);
+  s3 = __riscv_vfsub_vv_f32m1 (s5, s4, vl);
+  s5 = __riscv_vfadd_vv_f32m1 (s5, s4, vl);
+  s8 = __riscv_vfsub_vv_f32m1 (s7, s6, vl);
+  s7 = __riscv_vfadd_vv_f32m1 (s7, s6, vl);
+  r4 = __riscv_vfadd_vv_f32m1 (r5, s7, vl);     /* output 2 re */
+  r5 = __riscv_vfsub_vv_f32m1 (r5, s7, vl);     /* output 8 re */
+  r6 = __riscv_vfadd_vv_f32m1 (r3, s8, vl);     /* output 6 re */
+  r3 = __riscv_vfsub_vv_f32m1 (r3, s8, vl);     /* output 4 re */
+  s4 = __riscv_vfsub_vv_f32m1 (s5, r7, vl);     /* output 2 im */
+  s5 = __riscv_vfadd_vv_f32m1 (s5, r7, vl);     /* output 8 im */
+  s6 = __riscv_vfsub_vv_f32m1 (s3, r8, vl);     /* output 6 im */
+  s3 = __riscv_vfadd_vv_f32m1 (s3, r8, vl);     /* output 4 im */
+
+/* multiply (re, im) by the twiddle of input m and store it to pOut */
+#define RADIX8_VEC_TWIDDLE_STORE(pOut, m, re, im)                                        \
+  if (pCoef != NULL)                                                                     \
+  {                                                                                      \
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2 (pCoef + ((m) - 1) * tstep, (m) * tstride, vl); \
+    co = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 0);                                      \
+    si = __riscv_vget_v_f32m1x2_f32m1 (v_tuple, 1);                                      \
+    vr = __riscv_vfmacc_vv_f32m1 (__riscv_vfmul_vv_f32m1 (co, re, vl), si, im, vl);      \
+    vi = __riscv_vfnmsac_vv_f32m1 (__riscv_vfmul_vv_f32m1 (co, im, vl), si, re, vl);     \
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 0, vr);                             \
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 1, vi);                             \
+  }                                                                                      \
+  else                                                                                   \
+  {                                                                                      \
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 0, re);                             \
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2 (v_tuple, 1, im);                             \
+  }                                                                                      \
+  __riscv_vssseg2e32_v_f32m1x2 (pOut, bstride, v_tuple, vl);
+
+  RADIX8_VEC_TWIDDLE_STORE(p5, 4, r2, s2);
+  RADIX8_VEC_TWIDDLE_STORE(p3, 2, r1, s1);
+  RADIX8_VEC_TWIDDLE_STORE(p7, 6, t1, t2);
+  RADIX8_VEC_TWIDDLE_STORE(p2, 1, r4, s4);
+  RADIX8_VEC_TWIDDLE_STORE(p8, 7, r5, s5);
+  RADIX8_VEC_TWIDDLE_STORE(p6, 5, r6, s6);
+  RADIX8_VEC_TWIDDLE_STORE(p4, 3, r3, s3);
+
+#undef RADIX8_VEC_TWIDDLE_STORE
+}
+#endif /* defined (RISCV_MATH_VECTOR) */
+
 /**
   brief         Core function for the floating-point CFFT butterfly process.
   param[in,out] pSrc             points to the in-place buffer of floating-point data type.
@@ -49,6 +210,54 @@ void riscv_radix8_butterfly_f32(
   const float32_t * pCoef,
   uint16_t twidCoefModifier)
 {
+#if defined (RISCV_MATH_VECTOR)
+   uint32_t n1, n2, j, i1;
+   uint32_t groupCnt;
+   size_t l;
+
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+      groupCnt = fftLen / n1;
+
+      if (n2 >= groupCnt)
+      {
+         /* Long butterfly groups: one vector holds consecutive butterflies of a group,
+            their twiddles are read with a stride of twidCoefModifier */
+         for (i1 = 0; i1 < fftLen; i1 += n1)
+         {
+            for (j = 0; j < n2; j += l)
+            {
+               l = __riscv_vsetvl_e32m1(n2 - j);
+               riscv_radix8_butterfly_vec_f32(pSrc + 2 * (i1 + j), 8, n2,
+                                              pCoef + 2 * j * twidCoefModifier,
+                                              (ptrdiff_t)twidCoefModifier * 8,
+                                              2 * j * twidCoefModifier, l);
+            }
+         }
+      }
+      else
+      {
+         /* Many short groups: one vector holds the same butterfly of several groups,
+            all lanes share the same twiddles */
+         for (j = 0; j < n2; j++)
+         {
+            for (i1 = j; i1 < fftLen; i1 += l * n1)
+            {
+               l = __riscv_vsetvl_e32m1((fftLen - i1 + n1 - 1) / n1);
+               riscv_radix8_butterfly_vec_f32(pSrc + 2 * i1, (ptrdiff_t)n1 * 8, n2,
+                                              (j == 0) ? NULL : pCoef + 2 * j * twidCoefModifier,
+                                              0, 2 * j * twidCoefModifier, l);
+            }
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   } while (n2 > 7);
+#else
    uint32_t ia1, ia2, ia3, ia4, ia5, ia6, ia7;
    uint32_t i1, i2, i3, i4, i5, i6, i7, i8;
    uint32_t id;
@@ -283,4 +492,5 @@ void riscv_radix8_butterfly_f32(
 
       twidCoefModifier <<= 3;
    } while (n2 > 7);
+#endif /* defined (RISCV_MATH_VECTOR) */
 }
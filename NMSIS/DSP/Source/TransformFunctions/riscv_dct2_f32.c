@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_dct2_f32.c
+ * Description:  Processing function of DCT type II for floating-point data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup DCT2_DCT3 DCT Type II and III Functions
+
+  The type-II DCT is the transform used by most audio and image codecs and by the
+  cepstral stage of the MFCC. Its inverse is the type-III DCT. Both are computed
+  with a real FFT of the same length, so only <code>N</code> twiddle factors are
+  stored instead of a dense <code>N x N</code> matrix.
+
+  @par           Algorithm
+                   The N-point orthonormal type-II DCT is defined as:
+                   \f[
+                   X(k) = c(k)\sqrt{\frac{2}{N}}\sum_{n=0}^{N-1} x(n)cos\Big[\frac{\pi k(2n+1)}{2N}\Big]
+                   \f]
+                   where <code>k = 0, 1, 2, ..., N-1</code>, <code>c(0) = 1/sqrt(2)</code> and <code>c(k) = 1</code> otherwise.
+  @par
+                   The type-III DCT is its inverse:
+                   \f[
+                   x(n) = \sqrt{\frac{2}{N}}\sum_{k=0}^{N-1} c(k)X(k)cos\Big[\frac{\pi k(2n+1)}{2N}\Big]
+                   \f]
+  @par
+                   The input is reordered as <code>v(n) = x(2n)</code> and <code>v(N-1-n) = x(2n+1)</code>,
+                   then <code>X(k)</code> and <code>X(N-k)</code> are the real parts of the real FFT bin
+                   <code>V(k)</code> rotated by <code>exp(-j*pi*k/(2N))</code> and <code>exp(-j*pi*(N-k)/(2N))</code>.
+                   The type-III DCT runs the same steps backward with the inverse real FFT.
+                   The vector version computes the bins <code>k</code> and <code>N-k</code> with
+                   ascending and descending strided accesses.
+
+  @par           Lengths supported by the transform:
+                   The lengths of \ref riscv_rfft_fast_f32: 32, 64, 128, 256, 512, 1024, 2048 and 4096.
+
+  @par           Instance Structure
+                   The same instance is used for the DCT2 and the DCT3. It holds the length,
+                   the normalizing factor, the twiddle factors
+                   <code>{cos, sin}(pi*k/(2N))</code>, <code>k = 0 ... N/2-1</code>, and
+                   the real FFT instance. It is initialized by \ref riscv_dct2_init_f32.
+ */
+
+/**
+  @addtogroup DCT2_DCT3
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point DCT2.
+  @param[in]     S             points to an instance of the floating-point DCT2/DCT3 structure
+  @param[in]     pState        points to state buffer of <code>N</code> values
+  @param[in,out] pInlineBuffer points to the in-place input and output buffer of <code>N</code> values
+  @return        none
+ */
+void riscv_dct2_f32(
+  const riscv_dct2_instance_f32 * S,
+        float32_t * pState,
+        float32_t * pInlineBuffer)
+{
+  const float32_t *pTw = S->pTwiddle + 2;
+        uint32_t N = S->N;
+        float32_t norm = S->normalize;
+        float32_t *pV, *pX1, *pX2;
+#if defined (RISCV_MATH_VECTOR)
+        uint32_t blkCnt;
+        size_t l;
+        vfloat32m4x2_t v_x, v_tw;
+        vfloat32m4_t v_re, v_im, v_c, v_s;
+#else
+        float32_t *pS1, *pS2, *pbuff;
+        float32_t re, im, c, s;
+        uint32_t k;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Reordering: v(n) = x(2n) and v(N-1-n) = x(2n+1) */
+#if defined (RISCV_MATH_VECTOR)
+  pV = pState;
+  pX1 = pInlineBuffer;
+  pX2 = pState + N - 1U;
+  blkCnt = N >> 1U;
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x = __riscv_vlseg2e32_v_f32m4x2(pX1, l);
+    __riscv_vse32_v_f32m4(pV, __riscv_vget_v_f32m4x2_f32m4(v_x, 0), l);
+    __riscv_vsse32_v_f32m4(pX2, -4, __riscv_vget_v_f32m4x2_f32m4(v_x, 1), l);
+    pX1 += 2U * l;
+    pV += l;
+    pX2 -= l;
+  }
+#else
+  pS1 = pState;
+  pS2 = pState + N - 1U;
+  pbuff = pInlineBuffer;
+  for (k = 0U; k < (N >> 1U); k++)
+  {
+    *pS1++ = *pbuff++;
+    *pS2-- = *pbuff++;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* V = RFFT(v), the input buffer is free and receives the spectrum */
+  riscv_rfft_fast_f32(&(S->rfft), pState, pInlineBuffer, 0U);
+
+  /*
+   * X(k)   = norm * ( cos * Re(V(k)) + sin * Im(V(k)))
+   * X(N-k) = norm * ( sin * Re(V(k)) - cos * Im(V(k)))
+   * DC and Nyquist bins are packed in the first complex value.
+   */
+  pState[0] = pInlineBuffer[0] * norm * 0.70710678118654752440f;
+  pState[N >> 1U] = pInlineBuffer[1] * norm * 0.70710678118654752440f;
+
+  pV = pInlineBuffer + 2;
+  pX1 = pState + 1;
+  pX2 = pState + N - 1U;
+#if defined (RISCV_MATH_VECTOR)
+  blkCnt = (N >> 1U) - 1U;
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x = __riscv_vlseg2e32_v_f32m4x2(pV, l);
+    v_tw = __riscv_vlseg2e32_v_f32m4x2(pTw, l);
+    v_re = __riscv_vfmul_vf_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_x, 0), norm, l);
+    v_im = __riscv_vfmul_vf_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_x, 1), norm, l);
+    v_c = __riscv_vget_v_f32m4x2_f32m4(v_tw, 0);
+    v_s = __riscv_vget_v_f32m4x2_f32m4(v_tw, 1);
+    __riscv_vse32_v_f32m4(pX1, __riscv_vfmacc_vv_f32m4(__riscv_vfmul_vv_f32m4(v_c, v_re, l), v_s, v_im, l), l);
+    __riscv_vsse32_v_f32m4(pX2, -4, __riscv_vfnmsac_vv_f32m4(__riscv_vfmul_vv_f32m4(v_s, v_re, l), v_c, v_im, l), l);
+    pV += 2U * l;
+    pTw += 2U * l;
+    pX1 += l;
+    pX2 -= l;
+  }
+#else
+  for (k = 1U; k < (N >> 1U); k++)
+  {
+    re = *pV++ * norm;
+    im = *pV++ * norm;
+    c = *pTw++;
+    s = *pTw++;
+    *pX1++ = c * re + s * im;
+    *pX2-- = s * re - c * im;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  riscv_copy_f32(pState, pInlineBuffer, N);
+}
+
+/**
+  @} end of DCT2_DCT3 group
+ */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_dct2_init_f32.c
+ * Description:  Initialization function of DCT type II and III for floating-point data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/*
+ * Computes the twiddle factors and sets the instance fields once the real FFT is initialized.
+ */
+static void riscv_dct2_setup_f32(
+        riscv_dct2_instance_f32 * S,
+        uint16_t N,
+        float32_t * pTwiddle)
+{
+  float64_t phi;
+  uint32_t k;
+
+  /* {cos, sin}(pi*k/(2N)) */
+  for (k = 0U; k < ((uint32_t) N >> 1U); k++)
+  {
+    phi = 1.5707963267948966192313216916398 * (float64_t) k / (float64_t) N;
+    pTwiddle[2U * k]      = (float32_t) cos(phi);
+    pTwiddle[2U * k + 1U] = (float32_t) sin(phi);
+  }
+
+  S->N = N;
+  S->normalize = (float32_t) sqrt(2.0 / (float64_t) N);
+  S->pTwiddle = pTwiddle;
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup DCT2_DCT3
+  @{
+ */
+
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
+/**
+  @brief         Initialization function for the floating-point DCT2/DCT3.
+  @param[in,out] S          points to an instance of the floating-point DCT2/DCT3 structure
+  @param[in]     N          length of the DCT
+  @param[out]    pTwiddle   points to a buffer of <code>N</code> values receiving the twiddle factors
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>N</code> is not a supported transform length
+
+  @par           Details
+                   The real FFT is initialized with \ref riscv_rfft_fast_init_f32 and the
+                   normalizing factor is set to <code>sqrt(2/N)</code>. The twiddle buffer must
+                   stay valid for the lifetime of the instance.
+ */
+riscv_status riscv_dct2_init_f32(
+        riscv_dct2_instance_f32 * S,
+        uint16_t N,
+        float32_t * pTwiddle)
+{
+  riscv_status status;
+
+  if (pTwiddle == NULL)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_rfft_fast_init_f32(&(S->rfft), N);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  riscv_dct2_setup_f32(S, N, pTwiddle);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+  @brief         Initialization function for the floating-point DCT2/DCT3 with FFT tables computed at runtime.
+  @param[in,out] S          points to an instance of the floating-point DCT2/DCT3 structure
+  @param[in]     N          length of the DCT
+  @param[out]    pTwiddle   points to a buffer of <code>N</code> values receiving the twiddle factors
+  @param[out]    pBuffer    points to a buffer of <code>RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(N)</code>
+                            values receiving the FFT tables
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>N</code> is not a supported transform length
+
+  @par           Details
+                   Same as \ref riscv_dct2_init_f32 but the real FFT is initialized with
+                   \ref riscv_rfft_fast_init_dynamic_f32. It is also available when the library
+                   is built with <code>RISCV_FFT_NO_ROM_TABLES</code>.
+ */
+riscv_status riscv_dct2_init_dynamic_f32(
+        riscv_dct2_instance_f32 * S,
+        uint16_t N,
+        float32_t * pTwiddle,
+        float32_t * pBuffer)
+{
+  riscv_status status;
+
+  if (pTwiddle == NULL)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_rfft_fast_init_dynamic_f32(&(S->rfft), N, pBuffer);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  riscv_dct2_setup_f32(S, N, pTwiddle);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of DCT2_DCT3 group
+ */
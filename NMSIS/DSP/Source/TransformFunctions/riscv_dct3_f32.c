@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_dct3_f32.c
+ * Description:  Processing function of DCT type III for floating-point data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup DCT2_DCT3
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point DCT3, the inverse of \ref riscv_dct2_f32.
+  @param[in]     S             points to an instance of the floating-point DCT2/DCT3 structure
+  @param[in]     pState        points to state buffer of <code>N</code> values
+  @param[in,out] pInlineBuffer points to the in-place input and output buffer of <code>N</code> values
+  @return        none
+ */
+void riscv_dct3_f32(
+  const riscv_dct2_instance_f32 * S,
+        float32_t * pState,
+        float32_t * pInlineBuffer)
+{
+  const float32_t *pTw = S->pTwiddle + 2;
+        uint32_t N = S->N;
+        float32_t gain = 1.0f / S->normalize;
+        float32_t *pV, *pX1, *pX2;
+#if defined (RISCV_MATH_VECTOR)
+        uint32_t blkCnt;
+        size_t l;
+        vfloat32m4x2_t v_x, v_tw;
+        vfloat32m4_t v_a, v_b, v_c, v_s;
+#else
+        float32_t a, b, c, s;
+        uint32_t k;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /*
+   * Spectrum of the reordered sequence, with a = X(k) / norm and b = X(N-k) / norm:
+   * V(k) = (cos + j*sin) * (a - j*b)
+   * DC and Nyquist bins are packed in the first complex value.
+   */
+  pState[0] = pInlineBuffer[0] * gain * 1.41421356237309504880f;
+  pState[1] = pInlineBuffer[N >> 1U] * gain * 1.41421356237309504880f;
+
+  pV = pState + 2;
+  pX1 = pInlineBuffer + 1;
+  pX2 = pInlineBuffer + N - 1U;
+#if defined (RISCV_MATH_VECTOR)
+  blkCnt = (N >> 1U) - 1U;
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_tw = __riscv_vlseg2e32_v_f32m4x2(pTw, l);
+    v_c = __riscv_vget_v_f32m4x2_f32m4(v_tw, 0);
+    v_s = __riscv_vget_v_f32m4x2_f32m4(v_tw, 1);
+    v_a = __riscv_vfmul_vf_f32m4(__riscv_vle32_v_f32m4(pX1, l), gain, l);
+    v_b = __riscv_vfmul_vf_f32m4(__riscv_vlse32_v_f32m4(pX2, -4, l), gain, l);
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_tw, 0, __riscv_vfmacc_vv_f32m4(__riscv_vfmul_vv_f32m4(v_c, v_a, l), v_s, v_b, l));
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 1, __riscv_vfnmsac_vv_f32m4(__riscv_vfmul_vv_f32m4(v_s, v_a, l), v_c, v_b, l));
+    __riscv_vsseg2e32_v_f32m4x2(pV, v_x, l);
+    pV += 2U * l;
+    pTw += 2U * l;
+    pX1 += l;
+    pX2 -= l;
+  }
+#else
+  for (k = 1U; k < (N >> 1U); k++)
+  {
+    a = *pX1++ * gain;
+    b = *pX2-- * gain;
+    c = *pTw++;
+    s = *pTw++;
+    *pV++ = c * a + s * b;
+    *pV++ = s * a - c * b;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* v = RIFFT(V), the input buffer is free and receives the sequence */
+  riscv_rfft_fast_f32(&(S->rfft), pState, pInlineBuffer, 1U);
+
+  /* Inverse reordering: x(2n) = v(n) and x(2n+1) = v(N-1-n) */
+  pX1 = pInlineBuffer;
+  pX2 = pInlineBuffer + N - 1U;
+  pV = pState;
+#if defined (RISCV_MATH_VECTOR)
+  blkCnt = N >> 1U;
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 0, __riscv_vle32_v_f32m4(pX1, l));
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 1, __riscv_vlse32_v_f32m4(pX2, -4, l));
+    __riscv_vsseg2e32_v_f32m4x2(pV, v_x, l);
+    pV += 2U * l;
+    pX1 += l;
+    pX2 -= l;
+  }
+#else
+  for (k = 0U; k < (N >> 1U); k++)
+  {
+    *pV++ = *pX1++;
+    *pV++ = *pX2--;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  riscv_copy_f32(pState, pInlineBuffer, N);
+}
+
+/**
+  @} end of DCT2_DCT3 group
+ */
@@ -28,6 +28,7 @@
  */
 
 #include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
 
 /**
   @ingroup groupTransforms
@@ -140,6 +141,11 @@ void riscv_dct4_f32(
         float32_t *pS1, *pS2, *pbuff;                  /* Temporary pointers for input buffer and pState buffer */
         float32_t in;                                  /* Temporary variable */
         uint32_t i;                                    /* Loop counter */
+#if defined (RISCV_MATH_VECTOR)
+        size_t l;
+        vfloat32m4x2_t v_x, v_cos;
+        vfloat32m4_t v_in;
+#endif /* defined (RISCV_MATH_VECTOR) */
 
 
   /* DCT4 computation involves DCT2 (which is calculated using RFFT)
@@ -163,8 +169,10 @@ void riscv_dct4_f32(
 
   /*-------- Pre-processing ------------*/
   /* Multiplying input with cos factor i.e. r(n) = 2 * x(n) * cos(pi*(2*n+1)/(4*n)) */
+#if !defined (RISCV_MATH_VECTOR)
   riscv_scale_f32(pInlineBuffer, 2.0f, pInlineBuffer, S->N);
   riscv_mult_f32(pInlineBuffer, cosFact, pInlineBuffer, S->N);
+#endif /* !defined (RISCV_MATH_VECTOR) */
 
   /* ----------------------------------------------------------------
    * Step1: Re-ordering of even and odd elements as
@@ -182,7 +190,82 @@ void riscv_dct4_f32(
   pbuff = pInlineBuffer;
 
 
-#if defined (RISCV_MATH_LOOPUNROLL)
+#if defined (RISCV_MATH_VECTOR)
+
+  /* Pre-processing fused with the re-ordering of even and odd elements:
+   *             pState[i] =  2 * pInlineBuffer[2*i] * cosFact[2*i] and
+   *             pState[N-i-1] = 2 * pInlineBuffer[2*i+1] * cosFact[2*i+1] */
+  i = S->Nby2;
+  for (; (l = __riscv_vsetvl_e32m4(i)) > 0; i -= l)
+  {
+    v_x = __riscv_vlseg2e32_v_f32m4x2(pbuff, l);
+    v_cos = __riscv_vlseg2e32_v_f32m4x2(cosFact, l);
+    v_in = __riscv_vfmul_vv_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_x, 0), __riscv_vget_v_f32m4x2_f32m4(v_cos, 0), l);
+    __riscv_vse32_v_f32m4(pS1, __riscv_vfadd_vv_f32m4(v_in, v_in, l), l);
+    v_in = __riscv_vfmul_vv_f32m4(__riscv_vget_v_f32m4x2_f32m4(v_x, 1), __riscv_vget_v_f32m4x2_f32m4(v_cos, 1), l);
+    __riscv_vsse32_v_f32m4(pS2, -4, __riscv_vfadd_vv_f32m4(v_in, v_in, l), l);
+    pbuff += 2U * l;
+    cosFact += 2U * l;
+    pS1 += l;
+    pS2 -= l;
+  }
+
+  /* Writing the re-ordered output back to inplace input buffer */
+  riscv_copy_f32(pState, pInlineBuffer, S->N);
+
+
+  /* ---------------------------------------------------------
+   *     Step2: Calculate RFFT for N-point input
+   * ---------------------------------------------------------- */
+  /* pInlineBuffer is real input of length N , pState is the complex output of length 2N */
+  riscv_rfft_f32 (S->pRfft, pInlineBuffer, pState);
+
+  /*----------------------------------------------------------------------
+   *  Step3: Multiply the FFT output with the weights.
+   *----------------------------------------------------------------------*/
+  riscv_cmplx_mult_cmplx_f32 (pState, weights, pState, S->N);
+
+  /* ----------- Post-processing ---------- */
+  /* DCT-IV can be obtained from DCT-II by the equation,
+   *       Y4(k) = Y2(k) - Y4(k-1) and Y4(-1) = Y4(0)
+   *       Hence, Y4(0) = Y2(0)/2  */
+  /* Getting only real part from the output and Converting to DCT-IV */
+
+  /* pbuff initialized to input buffer. */
+  pbuff = pInlineBuffer;
+
+  /* pS1 initialized to pState */
+  pS1 = pState;
+
+  /* Calculating Y4(0) from Y2(0) using Y4(0) = Y2(0)/2 */
+  in = *pS1++ * (float32_t) 0.5;
+  /* input buffer acts as inplace, so output values are stored in the input itself. */
+  *pbuff++ = in;
+
+  /* pState pointer is incremented twice as the real values are located alternatively in the array */
+  pS1++;
+
+  /* Initializing the loop counter */
+  i = (S->N - 1U);
+
+  do
+  {
+    /* Calculating Y4(1) to Y4(N-1) from Y2 using equation Y4(k) = Y2(k) - Y4(k-1) */
+    /* pState pointer (pS1) is incremented twice as the real values are located alternatively in the array */
+    in = *pS1++ - in;
+    *pbuff++ = in;
+
+    /* points to the next real value */
+    pS1++;
+
+    /* Decrement loop counter */
+    i--;
+  } while (i > 0U);
+
+  /*------------ Normalizing the output by multiplying with the normalizing factor ----------*/
+  riscv_scale_f32(pInlineBuffer, S->normalize, pInlineBuffer, S->N);
+
+#elif defined (RISCV_MATH_LOOPUNROLL)
 
   /* Initializing the loop counter to N/2 >> 2 for loop unrolling by 4 */
   i = S->Nby2 >> 2U;
@@ -28,6 +28,7 @@
  */
 
 #include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
 
 /**
   @addtogroup DCT4Q15
@@ -66,6 +67,11 @@ void riscv_dct4_q15(
         q15_t *pS1, *pS2, *pbuff;                      /* Temporary pointers for input buffer and pState buffer */
         q15_t in;                                      /* Temporary variable */
         uint32_t i;                                    /* Loop counter */
+#if defined (RISCV_MATH_VECTOR)
+        size_t l;
+        vint16m4x2_t v_x;
+        vint16m4_t v_in;
+#endif /* defined (RISCV_MATH_VECTOR) */
 
 
   /* DCT4 computation involves DCT2 (which is calculated using RFFT)
@@ -108,7 +114,87 @@ void riscv_dct4_q15(
   pbuff = pInlineBuffer;
 
 
-#if defined (RISCV_MATH_LOOPUNROLL)
+#if defined (RISCV_MATH_VECTOR)
+
+  /* Re-ordering of even and odd elements, the odd elements are stored backward */
+  i = S->Nby2;
+  for (; (l = __riscv_vsetvl_e16m4(i)) > 0; i -= l)
+  {
+    v_x = __riscv_vlseg2e16_v_i16m4x2(pbuff, l);
+    __riscv_vse16_v_i16m4(pS1, __riscv_vget_v_i16m4x2_i16m4(v_x, 0), l);
+    __riscv_vsse16_v_i16m4(pS2, -2, __riscv_vget_v_i16m4x2_i16m4(v_x, 1), l);
+    pbuff += 2U * l;
+    pS1 += l;
+    pS2 -= l;
+  }
+
+  /* Writing the re-ordered output back to inplace input buffer */
+  riscv_copy_q15(pState, pInlineBuffer, S->N);
+
+
+  /* ---------------------------------------------------------
+   *     Step2: Calculate RFFT for N-point input
+   * ---------------------------------------------------------- */
+  /* pInlineBuffer is real input of length N , pState is the complex output of length 2N */
+  riscv_rfft_q15 (S->pRfft, pInlineBuffer, pState);
+
+  /*----------------------------------------------------------------------
+   *  Step3: Multiply the FFT output with the weights.
+   *----------------------------------------------------------------------*/
+  riscv_cmplx_mult_cmplx_q15 (pState, weights, pState, S->N);
+
+  /* The output of complex multiplication is in 3.13 format.
+   * Hence changing the format of N (i.e. 2*N elements) complex numbers to 1.15 format by shifting left by 2 bits. */
+  riscv_shift_q15 (pState, 2, pState, S->N * 2);
+
+  /* ----------- Post-processing ---------- */
+  /* DCT-IV can be obtained from DCT-II by the equation,
+   *       Y4(k) = Y2(k) - Y4(k-1) and Y4(-1) = Y4(0)
+   *       Hence, Y4(0) = Y2(0)/2  */
+  /* Getting only real part from the output and Converting to DCT-IV */
+
+  /* pbuff initialized to input buffer. */
+  pbuff = pInlineBuffer;
+
+  /* pS1 initialized to pState */
+  pS1 = pState;
+
+  /* Calculating Y4(0) from Y2(0) using Y4(0) = Y2(0)/2 */
+  in = *pS1++ >> 1U;
+  /* input buffer acts as inplace, so output values are stored in the input itself. */
+  *pbuff++ = in;
+
+  /* pState pointer is incremented twice as the real values are located alternatively in the array */
+  pS1++;
+
+  /* Initializing the loop counter */
+  i = (S->N - 1U);
+
+  do
+  {
+    /* Calculating Y4(1) to Y4(N-1) from Y2 using equation Y4(k) = Y2(k) - Y4(k-1) */
+    /* pState pointer (pS1) is incremented twice as the real values are located alternatively in the array */
+    in = *pS1++ - in;
+    *pbuff++ = in;
+
+    /* points to the next real value */
+    pS1++;
+
+    /* Decrement loop counter */
+    i--;
+  } while (i > 0U);
+
+  /*------------ Normalizing the output by multiplying with the normalizing factor ----------*/
+  i = S->N;
+  pbuff = pInlineBuffer;
+  for (; (l = __riscv_vsetvl_e16m4(i)) > 0; i -= l)
+  {
+    v_in = __riscv_vle16_v_i16m4(pbuff, l);
+    __riscv_vse16_v_i16m4(pbuff, __riscv_vnsra_wx_i16m4(__riscv_vwmul_vx_i32m8(v_in, S->normalize, l), 15, l), l);
+    pbuff += l;
+  }
+
+#elif defined (RISCV_MATH_LOOPUNROLL)
 
   /* Initializing the loop counter to N/2 >> 2 for loop unrolling by 4 */
   i = S->Nby2 >> 2U;
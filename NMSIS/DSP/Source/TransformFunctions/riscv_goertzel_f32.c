@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_f32.c
+ * Description:  Multi-bin Goertzel algorithm for floating-point data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Algorithm
+
+  The Goertzel algorithm computes single DFT values of a block of samples. Each bin costs
+  one multiply and two additions per input sample, so when only a few frequencies are
+  needed, as in DTMF or pilot-tone detection, it is much cheaper than a full FFT.
+  The frequencies do not have to be multiples of <code>1/blockSize</code>.
+
+  @par           Algorithm
+                   For each bin of normalized frequency <code>f</code> (in cycles per sample)
+                   and <code>w = 2*pi*f</code>, the recursion
+  <pre>
+      s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]
+  </pre>
+                   is run over the block. The DFT value
+  <pre>
+      X(f) = sum(x[n] * exp(-j*w*n)), n = 0 ... blockSize-1
+  </pre>
+                   is then obtained from the last two states. The bins are processed in
+                   parallel, and the vector version keeps the states of a group of bins
+                   in registers for the whole block.
+
+  @par           Instance Structure
+                   The instance holds the number of bins and a table with the cosine,
+                   sine and normalized frequency of every bin, computed by the
+                   initialization function. The table has <code>3*numBins</code> values.
+
+  @par           Fixed-Point Behavior
+                   The Q15 functions keep the states in 32 bits and return the DFT values in
+                   17.15 format; the Q31 functions keep the states in 64 bits and return the
+                   DFT values in 33.31 format. The states grow with the block length and
+                   the inverse of the distance between the frequency and 0 or 0.5: for Q15
+                   data, <code>blockSize / sin(w)</code> must stay below 2^15.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Multi-bin Goertzel algorithm for floating-point data.
+  @param[in]     S          points to an instance of the floating-point Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of input samples
+  @param[out]    pDst       points to the complex DFT values, 2*numBins values
+  @return        none
+ */
+void riscv_goertzel_f32(
+  const riscv_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst)
+{
+  uint32_t numBins = S->numBins;
+  const float32_t *pCos = S->pCoeffs;
+  const float32_t *pSin = pCos + numBins;
+  const float32_t *pFreq = pSin + numBins;
+  float32_t yr, yi, cp, sp, phase;
+  uint32_t i, n;
+
+  if (blockSize == 0U)
+  {
+    riscv_fill_f32(0.0f, pDst, 2U * numBins);
+    return;
+  }
+
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt = numBins;
+  float32_t *pOut = pDst;
+  size_t l;
+  vfloat32m4_t v_c, v_c2, v_s0, v_s1, v_s2;
+
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_c = __riscv_vle32_v_f32m4(pCos, l);
+    v_c2 = __riscv_vfadd_vv_f32m4(v_c, v_c, l);
+    v_s1 = __riscv_vfmv_v_f_f32m4(0.0f, l);
+    v_s2 = __riscv_vfmv_v_f_f32m4(0.0f, l);
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* s0 = x + 2*cos*s1 - s2 */
+      v_s0 = __riscv_vfadd_vf_f32m4(__riscv_vfmsac_vv_f32m4(v_s2, v_c2, v_s1, l), pSrc[n], l);
+      v_s2 = v_s1;
+      v_s1 = v_s0;
+    }
+    /* y = s1 - exp(-j*w)*s2 */
+    __riscv_vsse32_v_f32m4(pOut, 2 * sizeof(float32_t), __riscv_vfnmsac_vv_f32m4(v_s1, v_c, v_s2, l), l);
+    __riscv_vsse32_v_f32m4(pOut + 1, 2 * sizeof(float32_t),
+                           __riscv_vfmul_vv_f32m4(__riscv_vle32_v_f32m4(pSin, l), v_s2, l), l);
+
+    pCos += l;
+    pSin += l;
+    pOut += 2U * l;
+  }
+#else
+  float32_t c2, s0, s1, s2;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    c2 = 2.0f * pCos[i];
+    s1 = 0.0f;
+    s2 = 0.0f;
+    for (n = 0U; n < blockSize; n++)
+    {
+      s0 = pSrc[n] + c2 * s1 - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+    /* y = s1 - exp(-j*w)*s2 */
+    pDst[2U * i]      = s1 - pCos[i] * s2;
+    pDst[2U * i + 1U] = pSin[i] * s2;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* X = exp(-j*w*(blockSize-1)) * y */
+  for (i = 0U; i < numBins; i++)
+  {
+    phase = pFreq[i] * (float32_t) (blockSize - 1U);
+    phase = 6.28318530717959f * (phase - (float32_t) (int32_t) phase);
+    cp = riscv_cos_f32(phase);
+    sp = riscv_sin_f32(phase);
+    yr = pDst[2U * i];
+    yi = pDst[2U * i + 1U];
+    pDst[2U * i]      = yr * cp + yi * sp;
+    pDst[2U * i + 1U] = yi * cp - yr * sp;
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_init_q15.c
+ * Description:  Initialization function for the Q15 Goertzel algorithm
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 Goertzel algorithm.
+  @param[in,out] S        points to an instance of the Q15 Goertzel structure
+  @param[in]     numBins  number of frequencies
+  @param[in]     pFreqs   points to the normalized frequencies, in cycles per sample, in the range [0 0.5]
+  @param[out]    pCoeffs  points to a table of 3*numBins values receiving the coefficients
+  @return        none
+
+  @par           Details
+                   The coefficients are computed in floating-point and rounded to Q15.
+                   The frequencies are stored in Q15 format.
+ */
+void riscv_goertzel_init_q15(
+        riscv_goertzel_instance_q15 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        q15_t * pCoeffs)
+{
+  float64_t phi, v;
+  uint32_t i, k;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    phi = 6.283185307179586476925286766559 * (float64_t) pFreqs[i];
+    for (k = 0U; k < 3U; k++)
+    {
+      v = (k == 0U) ? cos(phi) : ((k == 1U) ? sin(phi) : (float64_t) pFreqs[i]);
+      v = v * 32768.0;
+      v += (v > 0.0) ? 0.5 : -0.5;
+      pCoeffs[k * numBins + i] = (q15_t) ((v >= (float64_t) 0x7FFF) ? 0x7FFF : v);
+    }
+  }
+
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_q15.c
+ * Description:  Multi-bin Goertzel algorithm for Q15 data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "dsp/fast_math_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Multi-bin Goertzel algorithm for Q15 data.
+  @param[in]     S          points to an instance of the Q15 Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of input samples
+  @param[out]    pDst       points to the complex DFT values in 17.15 format, 2*numBins values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The states are kept in 32 bits with 16 guard bits and are not saturated.
+                   <code>blockSize / sin(2*pi*f)</code> must stay below 2^15 for every bin.
+ */
+void riscv_goertzel_q15(
+  const riscv_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst)
+{
+  uint32_t numBins = S->numBins;
+  const q15_t *pCos = S->pCoeffs;
+  const q15_t *pSin = pCos + numBins;
+  const q15_t *pFreq = pSin + numBins;
+  q31_t yr, yi;
+  q15_t cp, sp, phase;
+  uint32_t i, n;
+
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt = numBins;
+  q31_t *pOut = pDst;
+  size_t l;
+  vint32m4_t v_c, v_s, v_s0, v_s1, v_s2;
+
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_c = __riscv_vsext_vf2_i32m4(__riscv_vle16_v_i16m2(pCos, l), l);
+    v_s1 = __riscv_vmv_v_x_i32m4(0, l);
+    v_s2 = __riscv_vmv_v_x_i32m4(0, l);
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* s0 = x + 2*cos*s1 - s2 */
+      v_s0 = __riscv_vnsra_wx_i32m4(__riscv_vwmul_vv_i64m8(v_c, v_s1, l), 14, l);
+      v_s0 = __riscv_vadd_vx_i32m4(__riscv_vsub_vv_i32m4(v_s0, v_s2, l), pSrc[n], l);
+      v_s2 = v_s1;
+      v_s1 = v_s0;
+    }
+    /* y = s1 - exp(-j*w)*s2 */
+    v_s = __riscv_vsext_vf2_i32m4(__riscv_vle16_v_i16m2(pSin, l), l);
+    __riscv_vsse32_v_i32m4(pOut, 2 * sizeof(q31_t),
+                           __riscv_vsub_vv_i32m4(v_s1, __riscv_vnsra_wx_i32m4(__riscv_vwmul_vv_i64m8(v_c, v_s2, l), 15, l), l), l);
+    __riscv_vsse32_v_i32m4(pOut + 1, 2 * sizeof(q31_t),
+                           __riscv_vnsra_wx_i32m4(__riscv_vwmul_vv_i64m8(v_s, v_s2, l), 15, l), l);
+
+    pCos += l;
+    pSin += l;
+    pOut += 2U * l;
+  }
+#else
+  q31_t c, s0, s1, s2;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    c = pCos[i];
+    s1 = 0;
+    s2 = 0;
+    for (n = 0U; n < blockSize; n++)
+    {
+      s0 = pSrc[n] + (q31_t) (((q63_t) c * s1) >> 14) - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+    /* y = s1 - exp(-j*w)*s2 */
+    pDst[2U * i]      = s1 - (q31_t) (((q63_t) c * s2) >> 15);
+    pDst[2U * i + 1U] = (q31_t) (((q63_t) pSin[i] * s2) >> 15);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* X = exp(-j*w*(blockSize-1)) * y, the phase wraps modulo one cycle */
+  for (i = 0U; i < numBins; i++)
+  {
+    phase = (q15_t) (((uint32_t) pFreq[i] * (blockSize - 1U)) & 0x7FFFU);
+    cp = riscv_cos_q15(phase);
+    sp = riscv_sin_q15(phase);
+    yr = pDst[2U * i];
+    yi = pDst[2U * i + 1U];
+    pDst[2U * i]      = (q31_t) (((q63_t) yr * cp + (q63_t) yi * sp) >> 15);
+    pDst[2U * i + 1U] = (q31_t) (((q63_t) yi * cp - (q63_t) yr * sp) >> 15);
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
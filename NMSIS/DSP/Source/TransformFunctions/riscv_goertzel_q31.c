@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_q31.c
+ * Description:  Multi-bin Goertzel algorithm for Q31 data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "dsp/fast_math_functions.h"
+
+/*
+ * Product of a 64-bit state and a Q31 coefficient shifted right by shift bits,
+ * computed on the two halves of the state to stay in 64 bits.
+ */
+static q63_t riscv_goertzel_mult_q31(
+  q63_t a,
+  q31_t b,
+  uint32_t shift)
+{
+  return ((a >> 32) * b) * ((q63_t) 1 << (32U - shift)) + (((a & 0xFFFFFFFFLL) * b) >> shift);
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Multi-bin Goertzel algorithm for Q31 data.
+  @param[in]     S          points to an instance of the Q31 Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of input samples
+  @param[out]    pDst       points to the complex DFT values in 33.31 format, 2*numBins values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The states are kept in 64 bits with 32 guard bits and are not saturated.
+ */
+void riscv_goertzel_q31(
+  const riscv_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q63_t * pDst)
+{
+  uint32_t numBins = S->numBins;
+  const q31_t *pCos = S->pCoeffs;
+  const q31_t *pSin = pCos + numBins;
+  const q31_t *pFreq = pSin + numBins;
+  q63_t yr, yi;
+  q31_t cp, sp, phase;
+  uint32_t i, n;
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  uint32_t blkCnt = numBins;
+  q63_t *pOut = pDst;
+  size_t l;
+  vint64m4_t v_c, v_s, v_s0, v_s1, v_s2, v_hi, v_lo;
+
+  for (; (l = __riscv_vsetvl_e64m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_c = __riscv_vsext_vf2_i64m4(__riscv_vle32_v_i32m2(pCos, l), l);
+    v_s1 = __riscv_vmv_v_x_i64m4(0, l);
+    v_s2 = __riscv_vmv_v_x_i64m4(0, l);
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* s0 = x + 2*cos*s1 - s2, the product is computed on the two halves of s1 */
+      v_hi = __riscv_vsll_vx_i64m4(__riscv_vmul_vv_i64m4(__riscv_vsra_vx_i64m4(v_s1, 32, l), v_c, l), 2, l);
+      v_lo = __riscv_vsra_vx_i64m4(__riscv_vmul_vv_i64m4(__riscv_vand_vx_i64m4(v_s1, 0xFFFFFFFFLL, l), v_c, l), 30, l);
+      v_s0 = __riscv_vadd_vx_i64m4(__riscv_vsub_vv_i64m4(__riscv_vadd_vv_i64m4(v_hi, v_lo, l), v_s2, l), pSrc[n], l);
+      v_s2 = v_s1;
+      v_s1 = v_s0;
+    }
+    /* y = s1 - exp(-j*w)*s2 */
+    v_hi = __riscv_vmul_vv_i64m4(__riscv_vsra_vx_i64m4(v_s2, 32, l), v_c, l);
+    v_lo = __riscv_vmul_vv_i64m4(__riscv_vand_vx_i64m4(v_s2, 0xFFFFFFFFLL, l), v_c, l);
+    v_s0 = __riscv_vadd_vv_i64m4(__riscv_vsll_vx_i64m4(v_hi, 1, l), __riscv_vsra_vx_i64m4(v_lo, 31, l), l);
+    __riscv_vsse64_v_i64m4(pOut, 2 * sizeof(q63_t), __riscv_vsub_vv_i64m4(v_s1, v_s0, l), l);
+    v_s = __riscv_vsext_vf2_i64m4(__riscv_vle32_v_i32m2(pSin, l), l);
+    v_hi = __riscv_vmul_vv_i64m4(__riscv_vsra_vx_i64m4(v_s2, 32, l), v_s, l);
+    v_lo = __riscv_vmul_vv_i64m4(__riscv_vand_vx_i64m4(v_s2, 0xFFFFFFFFLL, l), v_s, l);
+    v_s0 = __riscv_vadd_vv_i64m4(__riscv_vsll_vx_i64m4(v_hi, 1, l), __riscv_vsra_vx_i64m4(v_lo, 31, l), l);
+    __riscv_vsse64_v_i64m4(pOut + 1, 2 * sizeof(q63_t), v_s0, l);
+
+    pCos += l;
+    pSin += l;
+    pOut += 2U * l;
+  }
+#else
+  q63_t s0, s1, s2;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    s1 = 0;
+    s2 = 0;
+    for (n = 0U; n < blockSize; n++)
+    {
+      s0 = pSrc[n] + riscv_goertzel_mult_q31(s1, pCos[i], 30U) - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+    /* y = s1 - exp(-j*w)*s2 */
+    pDst[2U * i]      = s1 - riscv_goertzel_mult_q31(s2, pCos[i], 31U);
+    pDst[2U * i + 1U] = riscv_goertzel_mult_q31(s2, pSin[i], 31U);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* X = exp(-j*w*(blockSize-1)) * y, the phase wraps modulo one cycle */
+  for (i = 0U; i < numBins; i++)
+  {
+    phase = (q31_t) (((uint32_t) pFreq[i] * (blockSize - 1U)) & 0x7FFFFFFFU);
+    cp = riscv_cos_q31(phase);
+    sp = riscv_sin_q31(phase);
+    yr = pDst[2U * i];
+    yi = pDst[2U * i + 1U];
+    pDst[2U * i]      = riscv_goertzel_mult_q31(yr, cp, 31U) + riscv_goertzel_mult_q31(yi, sp, 31U);
+    pDst[2U * i + 1U] = riscv_goertzel_mult_q31(yi, cp, 31U) - riscv_goertzel_mult_q31(yr, sp, 31U);
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
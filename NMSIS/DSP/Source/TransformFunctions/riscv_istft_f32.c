@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_istft_f32.c
+ * Description:  Streaming ISTFT (overlap-add synthesis) Floating point process function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point streaming ISTFT.
+  @param[in,out] S     points to an instance of the floating-point ISTFT structure
+  @param[in]     pSrc  points to one frame in the packed format of \ref riscv_rfft_fast_f32()
+                       (fftLen values). The frame is modified by this function.
+  @param[out]    pDst  points to the block of hopSize output samples
+  @return        none
+ */
+
+void riscv_istft_f32(
+        riscv_istft_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst)
+{
+  float32_t *pState = S->pState;
+  float32_t *pScratch = S->pScratch;
+  uint32_t fftLen = S->fftLen;
+  uint32_t hopSize = S->hopSize;
+  uint32_t readIndex = S->readIndex;
+  uint32_t n;
+
+  /* Time frame, weighted by the synthesis window */
+  riscv_rfft_fast_f32(&(S->rfft), pSrc, pScratch, 1);
+  riscv_mult_f32(pScratch, S->pWindow, pScratch, fftLen);
+
+  /* Overlap-add into the ring buffer, starting at the oldest sample */
+  riscv_add_f32(pState + readIndex, pScratch, pState + readIndex, fftLen - readIndex);
+  riscv_add_f32(pState, pScratch + (fftLen - readIndex), pState, readIndex);
+
+  /* The oldest hopSize samples are complete: output and clear them */
+  n = fftLen - readIndex;
+  if (n > hopSize)
+  {
+    n = hopSize;
+  }
+  riscv_copy_f32(pState + readIndex, pDst, n);
+  riscv_fill_f32(0.0f, pState + readIndex, n);
+  riscv_copy_f32(pState, pDst + n, hopSize - n);
+  riscv_fill_f32(0.0f, pState, hopSize - n);
+
+  readIndex += hopSize;
+  if (readIndex >= fftLen)
+  {
+    readIndex -= fftLen;
+  }
+  S->readIndex = (uint16_t) readIndex;
+}
+
+/**
+  @} end of STFT group
+ */
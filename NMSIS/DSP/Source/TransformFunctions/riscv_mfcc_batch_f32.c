@@ -0,0 +1,194 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_mfcc_batch_f32.c
+ * Description:  Multi-frame MFCC function for the f32 version
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/statistics_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup MFCC
+ */
+
+/**
+  @defgroup MFCCBatchF32 MFCC Batch F32
+
+  MFCC features of a sequence of overlapping frames, computed with the
+  instance of \ref riscv_mfcc_init_f32. The mel filterbank and the log
+  stage have vector implementations.
+ */
+
+/*
+ * Mel filterbank applied as a packed sparse matrix-vector product:
+ * row i has filterLengths[i] coefficients starting at column filterPos[i].
+ */
+static void riscv_mfcc_batch_mel_f32(
+  const riscv_mfcc_instance_f32 * S,
+  const float32_t * pMag,
+        float32_t * pMel)
+{
+  const float32_t *coefs = S->filterCoefs;
+  const float32_t *pIn;
+  uint32_t i, blkCnt;
+
+#if defined(RISCV_MATH_VECTOR)
+  size_t l;
+  vfloat32m1_t v_sum;
+
+  for (i = 0U; i < S->nbMelFilters; i++)
+  {
+    pIn = pMag + S->filterPos[i];
+    blkCnt = S->filterLengths[i];
+    l = __riscv_vsetvl_e32m1(1);
+    v_sum = __riscv_vfmv_v_f_f32m1(0.0f, l);
+
+    for (; (l = __riscv_vsetvl_e32m8(blkCnt)) > 0; blkCnt -= l)
+    {
+      v_sum = __riscv_vfredusum_vs_f32m8_f32m1(__riscv_vfmul_vv_f32m8(__riscv_vle32_v_f32m8(pIn, l),
+                                                                       __riscv_vle32_v_f32m8(coefs, l), l), v_sum, l);
+      pIn += l;
+      coefs += l;
+    }
+    pMel[i] = __riscv_vfmv_f_s_f32m1_f32(v_sum);
+  }
+#else
+  float32_t sum;
+
+  for (i = 0U; i < S->nbMelFilters; i++)
+  {
+    pIn = pMag + S->filterPos[i];
+    blkCnt = S->filterLengths[i];
+    sum = 0.0f;
+
+    while (blkCnt > 0U)
+    {
+      sum += (*pIn++) * (*coefs++);
+      blkCnt--;
+    }
+    pMel[i] = sum;
+  }
+#endif /* defined(RISCV_MATH_VECTOR) */
+}
+
+/**
+  @addtogroup MFCCBatchF32
+  @{
+ */
+
+/**
+  @brief         MFCC F32 on a batch of overlapping frames
+  @param[in]     S         points to the mfcc instance structure
+  @param[in]     pSrc      points to the input samples
+  @param[in]     nbFrames  number of frames to compute
+  @param[in]     hopSize   distance in samples between the start of two consecutive frames
+  @param[out]    pDst      points to the output feature matrix
+  @param[inout]  pTmp      points to a temporary buffer
+  @return        none
+
+  @par           Description
+                   Frame f starts at <code>pSrc + f * hopSize</code>, so the input
+                   must hold <code>(nbFrames - 1) * hopSize + fftLen</code> samples.
+                   The source buffer is not modified.
+  @par
+                   The output is a row-major matrix of nbFrames rows and
+                   nbDctOutputs columns: row f holds the same values as
+                   \ref riscv_mfcc_f32 applied to frame f.
+  @par
+                   The temporary buffer has length 2*fftLen + 2 with the
+                   default RFFT based implementation and 3*fftLen when MFCC
+                   is implemented with CFFT. It is reused for every frame.
+  @par
+                   A frame with only zero samples is not normalized.
+ */
+void riscv_mfcc_batch_f32(
+  const riscv_mfcc_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t nbFrames,
+        uint32_t hopSize,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+  float32_t *pFrame = pTmp;                  /* Windowed frame, then magnitude */
+  float32_t *pSpec = pTmp + S->fftLen;       /* Spectrum, then Mel energies */
+  float32_t maxValue;
+  uint32_t index;
+  uint32_t f;
+  riscv_matrix_instance_f32 pDctMat;
+
+  pDctMat.numRows = S->nbDctOutputs;
+  pDctMat.numCols = S->nbMelFilters;
+  pDctMat.pData = (float32_t *) S->dctCoefs;
+
+  for (f = 0U; f < nbFrames; f++)
+  {
+    /* Normalize and multiply by window */
+    riscv_absmax_f32(pSrc, S->fftLen, &maxValue, &index);
+    riscv_mult_f32(pSrc, S->windowCoefs, pFrame, S->fftLen);
+    if (maxValue != 0.0f)
+    {
+      riscv_scale_f32(pFrame, 1.0f / maxValue, pFrame, S->fftLen);
+    }
+
+    /* Compute spectrum magnitude */
+#if defined(RISCV_MFCC_CFFT_BASED)
+    /* Convert from real to complex */
+    for (index = 0U; index < S->fftLen; index++)
+    {
+      pSpec[2U * index] = pFrame[index];
+      pSpec[2U * index + 1U] = 0.0f;
+    }
+    riscv_cfft_f32(&(S->cfft), pSpec, 0, 1);
+#else
+    riscv_rfft_fast_f32(&(S->rfft), pFrame, pSpec, 0);
+    /* Unpack real values */
+    pSpec[S->fftLen] = pSpec[1];
+    pSpec[S->fftLen + 1U] = 0.0f;
+    pSpec[1] = 0.0f;
+#endif
+    riscv_cmplx_mag_f32(pSpec, pFrame, (S->fftLen >> 1U) + 1U);
+
+    /* Apply MEL filters */
+    riscv_mfcc_batch_mel_f32(S, pFrame, pSpec);
+
+    /* Compute the log */
+    riscv_offset_f32(pSpec, 1.0e-6f, pSpec, S->nbMelFilters);
+    riscv_vlog_f32(pSpec, pSpec, S->nbMelFilters);
+
+    /* Multiply with the DCT matrix */
+    riscv_mat_vec_mult_f32(&pDctMat, pSpec, pDst);
+
+    pSrc += hopSize;
+    pDst += S->nbDctOutputs;
+  }
+}
+
+/**
+  @} end of MFCCBatchF32 group
+ */
@@ -47,6 +47,8 @@
 
 
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
 /**
   @brief         Generic initialization of the MFCC F32 instance structure
   @param[out]    S       points to the mfcc instance structure
@@ -380,6 +382,69 @@ MFCC_INIT_F32(2048);
  */
 MFCC_INIT_F32(4096);
 
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+  @brief         Initialization of the MFCC F32 instance structure with FFT tables computed at runtime
+  @param[out]    S       points to the mfcc instance structure
+  @param[in]     fftLen  fft length
+  @param[in]     nbMelFilters  number of Mel filters
+  @param[in]     nbDctOutputs  number of Dct outputs
+  @param[in]     dctCoefs  points to an array of DCT coefficients
+  @param[in]     filterPos  points of the array of filter positions
+  @param[in]     filterLengths  points to the array of filter lengths
+  @param[in]     filterCoefs  points to the array of filter coefficients
+  @param[in]     windowCoefs  points to the array of window coefficients
+  @param[out]    pBuffer  points to a buffer of <code>RISCV_MFCC_DYNAMIC_BUFFER_SIZE_F32(fftLen)</code>
+                          values receiving the FFT tables
+
+  @return        error status
+
+  @par           Description
+                   Same as \ref riscv_mfcc_init_f32 but the FFT is initialized with
+                   \ref riscv_rfft_fast_init_dynamic_f32, or \ref riscv_cfft_init_dynamic_f32
+                   when <code>RISCV_MFCC_CFFT_BASED</code> is defined. The buffer must stay
+                   valid for the lifetime of the instance.
+
+  @par
+                This function is also available when the library is built with
+                <code>RISCV_FFT_NO_ROM_TABLES</code>, where the other MFCC F32
+                initialization functions are not.
+ */
+
+riscv_status riscv_mfcc_init_dynamic_f32(
+  riscv_mfcc_instance_f32 * S,
+  uint32_t fftLen,
+  uint32_t nbMelFilters,
+  uint32_t nbDctOutputs,
+  const float32_t *dctCoefs,
+  const uint32_t *filterPos,
+  const uint32_t *filterLengths,
+  const float32_t *filterCoefs,
+  const float32_t *windowCoefs,
+  float32_t *pBuffer
+  )
+{
+ riscv_status status;
+
+ S->fftLen=fftLen;
+ S->nbMelFilters=nbMelFilters;
+ S->nbDctOutputs=nbDctOutputs;
+ S->dctCoefs=dctCoefs;
+ S->filterPos=filterPos;
+ S->filterLengths=filterLengths;
+ S->filterCoefs=filterCoefs;
+ S->windowCoefs=windowCoefs;
+
+ #if defined(RISCV_MFCC_CFFT_BASED)
+ status=riscv_cfft_init_dynamic_f32(&(S->cfft),fftLen,pBuffer);
+ #else
+ status=riscv_rfft_fast_init_dynamic_f32(&(S->rfft),fftLen,pBuffer);
+ #endif
+
+ return(status);
+}
+
 /**
   @} end of MFCCF32 group
  */
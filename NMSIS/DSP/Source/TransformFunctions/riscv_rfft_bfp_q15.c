@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_bfp_q15.c
+ * Description:  Block floating-point RFFT & RIFFT for Q15
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/statistics_functions.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions prototypes
+ * -------------------------------------------------------------------- */
+
+void riscv_split_rfft_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pATable,
+  const q15_t * pBTable,
+        q15_t * pDst,
+        uint32_t modifier);
+
+void riscv_split_rifft_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pATable,
+  const q15_t * pBTable,
+        q15_t * pDst,
+        uint32_t modifier);
+
+/*
+ * The split stages can grow a value by sqrt(2) before their final halving:
+ * the data must stay below 0.5 to avoid wrapping.
+ */
+static int32_t riscv_rfft_bfp_headroom_q15(
+  q15_t * pData,
+  uint32_t blockSize)
+{
+  q15_t maxValue;
+  uint32_t index;
+
+  riscv_absmax_q15(pData, blockSize, &maxValue, &index);
+  if (maxValue >= 0x4000)
+  {
+    riscv_shift_q15(pData, -1, pData, blockSize);
+    return 1;
+  }
+  return 0;
+}
+
+/**
+  @addtogroup RealFFTQ15
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 RFFT/RIFFT with block floating-point scaling.
+  @param[in]     S     points to an instance of the Q15 RFFT/RIFFT structure
+  @param[in]     pSrc  points to input buffer (Source buffer is modified by this function.)
+  @param[out]    pDst  points to output buffer
+  @return        block exponent of the result
+
+  @par           Scaling
+                   The internal complex transform is computed with \ref riscv_cfft_bfp_q15,
+                   so the data is only shifted when an overflow is possible instead of
+                   being halved at every stage. The result, read as Q15 values, must be
+                   multiplied by <code>2^exponent</code>: the RFFT gives the unscaled DFT
+                   and the RIFFT the inverse DFT including the <code>1/fftLenReal</code> factor.
+  @par
+                   Buffer sizes and layouts are the same as for \ref riscv_rfft_q15.
+ */
+int32_t riscv_rfft_bfp_q15(
+  const riscv_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst)
+{
+  const riscv_cfft_instance_q15 *S_CFFT = S->pCfft;
+        uint32_t L2 = S->fftLenReal >> 1U;
+        int32_t exponent;
+
+  if (S->ifftFlagR == 1U)
+  {
+     /*  Real IFFT core process */
+     exponent = riscv_rfft_bfp_headroom_q15(pSrc, S->fftLenReal + 2U);
+     riscv_split_rifft_q15 (pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+
+     /* Complex IFFT process, the split output is half of the spectrum of the complex sequence */
+     exponent += riscv_cfft_bfp_q15 (S_CFFT, pDst, S->ifftFlagR, S->bitReverseFlagR) + 1;
+  }
+  else
+  {
+     /* Complex FFT process */
+     exponent = riscv_cfft_bfp_q15 (S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR);
+
+     /*  Real FFT core process, the split output is halved */
+     exponent += riscv_rfft_bfp_headroom_q15(pSrc, S->fftLenReal);
+     riscv_split_rfft_q15 (pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+     exponent += 1;
+  }
+
+  return exponent;
+}
+
+/**
+  @} end of RealFFTQ15 group
+ */
@@ -35,13 +35,19 @@ void stage_rfft_f64(
         float64_t * pOut)
 {
         uint32_t  k;                                /* Loop Counter */
-        float64_t twR, twI;                         /* RFFT Twiddle coefficients */
   const float64_t * pCoeff = S->pTwiddleRFFT;       /* Points to RFFT Twiddle factors */
         float64_t *pA = p;                          /* increasing pointer */
         float64_t *pB = p;                          /* decreasing pointer */
         float64_t xAR, xAI, xBR, xBI;               /* temporary variables */
         float64_t t1a, t1b;                         /* temporary variables */
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+        size_t l;
+        vfloat64m2x2_t v_a, v_b, v_w;
+        vfloat64m2_t v_xar, v_xai, v_xbr, v_xbi, v_twr, v_twi, v_t1a, v_t1b, v_re, v_im;
+#else
+        float64_t twR, twI;                         /* RFFT Twiddle coefficients */
         float64_t p0, p1, p2, p3;                   /* temporary variables */
+#endif
 
 
    k = (S->Sint).fftLen - 1;
@@ -53,8 +59,7 @@ void stage_rfft_f64(
    xAR = pA[0];
    xAI = pA[1];
 
-   twR = *pCoeff++ ;
-   twI = *pCoeff++ ;
+   pCoeff += 2 ;
 
    // U1 = XA(1) + XB(1); % It is real
    t1a = xBR + xAR  ;
@@ -71,6 +76,38 @@ void stage_rfft_f64(
    pB  = p + 2*k;
    pA += 2;
 
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+   /* pB walks backwards: its complex values are read with a negative stride */
+   for (; (l = __riscv_vsetvl_e64m2(k)) > 0; k -= l)
+   {
+      v_a = __riscv_vlseg2e64_v_f64m2x2(pA, l);
+      v_b = __riscv_vlsseg2e64_v_f64m2x2(pB, -16, l);
+      v_w = __riscv_vlseg2e64_v_f64m2x2(pCoeff, l);
+      v_xar = __riscv_vget_v_f64m2x2_f64m2(v_a, 0);
+      v_xai = __riscv_vget_v_f64m2x2_f64m2(v_a, 1);
+      v_xbr = __riscv_vget_v_f64m2x2_f64m2(v_b, 0);
+      v_xbi = __riscv_vget_v_f64m2x2_f64m2(v_b, 1);
+      v_twr = __riscv_vget_v_f64m2x2_f64m2(v_w, 0);
+      v_twi = __riscv_vget_v_f64m2x2_f64m2(v_w, 1);
+
+      v_t1a = __riscv_vfsub_vv_f64m2(v_xbr, v_xar, l);
+      v_t1b = __riscv_vfadd_vv_f64m2(v_xbi, v_xai, l);
+
+      /* 0.5 * (xAR + xBR + twR * t1a + twI * t1b), 0.5 * (xAI - xBI + twI * t1a - twR * t1b) */
+      v_re = __riscv_vfmacc_vv_f64m2(__riscv_vfadd_vv_f64m2(v_xar, v_xbr, l), v_twr, v_t1a, l);
+      v_re = __riscv_vfmacc_vv_f64m2(v_re, v_twi, v_t1b, l);
+      v_im = __riscv_vfmacc_vv_f64m2(__riscv_vfsub_vv_f64m2(v_xai, v_xbi, l), v_twi, v_t1a, l);
+      v_im = __riscv_vfnmsac_vv_f64m2(v_im, v_twr, v_t1b, l);
+      v_a = __riscv_vset_v_f64m2_f64m2x2(v_a, 0, __riscv_vfmul_vf_f64m2(v_re, 0.5, l));
+      v_a = __riscv_vset_v_f64m2_f64m2x2(v_a, 1, __riscv_vfmul_vf_f64m2(v_im, 0.5, l));
+      __riscv_vsseg2e64_v_f64m2x2(pOut, v_a, l);
+
+      pA += 2 * l;
+      pB -= 2 * l;
+      pCoeff += 2 * l;
+      pOut += 2 * l;
+   }
+#else
    do
    {
       /*
@@ -113,6 +150,7 @@ void stage_rfft_f64(
       pB -= 2;
       k--;
    } while (k > 0U);
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64)) */
 }
 
 /* Prepares data for inverse cfft */
@@ -122,12 +160,19 @@ void merge_rfft_f64(
         float64_t * pOut)
 {
         uint32_t  k;                                /* Loop Counter */
-        float64_t twR, twI;                         /* RFFT Twiddle coefficients */
   const float64_t *pCoeff = S->pTwiddleRFFT;        /* Points to RFFT Twiddle factors */
         float64_t *pA = p;                          /* increasing pointer */
         float64_t *pB = p;                          /* decreasing pointer */
-        float64_t xAR, xAI, xBR, xBI;               /* temporary variables */
+        float64_t xAR, xAI;                         /* temporary variables */
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+        size_t l;
+        vfloat64m2x2_t v_a, v_b, v_w;
+        vfloat64m2_t v_xar, v_xai, v_xbr, v_xbi, v_twr, v_twi, v_t1a, v_t1b, v_re, v_im;
+#else
+        float64_t twR, twI;                         /* RFFT Twiddle coefficients */
+        float64_t xBR, xBI;                         /* temporary variables */
         float64_t t1a, t1b, r, s, t, u;             /* temporary variables */
+#endif
 
    k = (S->Sint).fftLen - 1;
 
@@ -142,6 +187,38 @@ void merge_rfft_f64(
    pB  =  p + 2*k ;
    pA +=  2	   ;
 
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64))
+   /* pB walks backwards: its complex values are read with a negative stride */
+   for (; (l = __riscv_vsetvl_e64m2(k)) > 0; k -= l)
+   {
+      v_a = __riscv_vlseg2e64_v_f64m2x2(pA, l);
+      v_b = __riscv_vlsseg2e64_v_f64m2x2(pB, -16, l);
+      v_w = __riscv_vlseg2e64_v_f64m2x2(pCoeff, l);
+      v_xar = __riscv_vget_v_f64m2x2_f64m2(v_a, 0);
+      v_xai = __riscv_vget_v_f64m2x2_f64m2(v_a, 1);
+      v_xbr = __riscv_vget_v_f64m2x2_f64m2(v_b, 0);
+      v_xbi = __riscv_vget_v_f64m2x2_f64m2(v_b, 1);
+      v_twr = __riscv_vget_v_f64m2x2_f64m2(v_w, 0);
+      v_twi = __riscv_vget_v_f64m2x2_f64m2(v_w, 1);
+
+      v_t1a = __riscv_vfsub_vv_f64m2(v_xar, v_xbr, l);
+      v_t1b = __riscv_vfadd_vv_f64m2(v_xai, v_xbi, l);
+
+      /* 0.5 * (xAR + xBR - twR * t1a - twI * t1b), 0.5 * (xAI - xBI + twI * t1a - twR * t1b) */
+      v_re = __riscv_vfnmsac_vv_f64m2(__riscv_vfadd_vv_f64m2(v_xar, v_xbr, l), v_twr, v_t1a, l);
+      v_re = __riscv_vfnmsac_vv_f64m2(v_re, v_twi, v_t1b, l);
+      v_im = __riscv_vfmacc_vv_f64m2(__riscv_vfsub_vv_f64m2(v_xai, v_xbi, l), v_twi, v_t1a, l);
+      v_im = __riscv_vfnmsac_vv_f64m2(v_im, v_twr, v_t1b, l);
+      v_a = __riscv_vset_v_f64m2_f64m2x2(v_a, 0, __riscv_vfmul_vf_f64m2(v_re, 0.5, l));
+      v_a = __riscv_vset_v_f64m2_f64m2x2(v_a, 1, __riscv_vfmul_vf_f64m2(v_im, 0.5, l));
+      __riscv_vsseg2e64_v_f64m2x2(pOut, v_a, l);
+
+      pA += 2 * l;
+      pB -= 2 * l;
+      pCoeff += 2 * l;
+      pOut += 2 * l;
+   }
+#else
    while (k > 0U)
    {
       /* G is half of the frequency complex spectrum */
@@ -172,7 +249,7 @@ void merge_rfft_f64(
       pB -= 2;
       k--;
    }
-
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) && (defined (__riscv_flen) && (__riscv_flen == 64)) */
 }
 
 /**
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_fast_init_dynamic_f32.c
+ * Description:  Initialization function for rfft fast f32 instance with tables computed at runtime
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup RealFFT
+ */
+
+/**
+  @addtogroup RealFFTF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point real FFT with tables computed at runtime.
+  @param[in,out] S        points to an riscv_rfft_fast_instance_f32 structure
+  @param[in]     fftLen   length of the Real Sequence
+  @param[out]    pBuffer  points to a buffer of <code>RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(fftLen)</code>
+                          values receiving the twiddle factors and the bit reversal table
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Description
+                   Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+                   The internal CFFT is initialized with \ref riscv_cfft_init_dynamic_f32 at the
+                   start of the buffer and the <code>fftLen</code> twiddle factors of the real
+                   stage follow it. The buffer must stay valid for the lifetime of the instance.
+  @par
+                   With <code>RISCV_FFT_NO_ROM_TABLES</code> defined, the table based
+                   initialization functions and the <code>riscv_rfft_fast_sR_f32_lenXXX</code>
+                   structures, which hold the <code>twiddleCoef_rfft_XXX</code> tables, are neither
+                   built nor declared and this function is the way to initialize the floating-point
+                   real FFT. The initialization functions built on them are replaced the same way
+                   by \ref riscv_stft_init_dynamic_f32, \ref riscv_istft_init_dynamic_f32,
+                   \ref riscv_dct2_init_dynamic_f32, \ref riscv_mfcc_init_dynamic_f32,
+                   \ref riscv_fir_partitioned_init_dynamic_f32, \ref riscv_fir_partitioned_init_dynamic_q31
+                   and \ref riscv_lms_fd_init_dynamic_f32.
+  @par
+                   The deprecated \ref riscv_rfft_init_f32 is still built with the option: it uses
+                   <code>realCoefA</code>, <code>realCoefB</code> and the tables of
+                   \ref riscv_cfft_radix4_init_f32, which stay in the image when it is called.
+ */
+riscv_status riscv_rfft_fast_init_dynamic_f32(
+  riscv_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  riscv_status status;
+  float32_t *pTwiddle;
+  uint32_t k, n8, n4, n2;
+  float64_t phi;
+
+  if ((S == NULL) || (pBuffer == NULL))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_cfft_init_dynamic_f32(&(S->Sint), fftLen >> 1U, pBuffer);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* Twiddle factors {sin, cos}(2*pi*k/fftLen): first octant from the math library, the rest by symmetry */
+  pTwiddle = pBuffer + RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(fftLen >> 1U);
+  n8 = (uint32_t) fftLen >> 3U;
+  n4 = (uint32_t) fftLen >> 2U;
+  n2 = (uint32_t) fftLen >> 1U;
+  for (k = 0U; k <= n8; k++)
+  {
+    phi = 6.283185307179586476925286766559 * (float64_t) k / (float64_t) fftLen;
+    pTwiddle[2U * k]      = (float32_t) sin(phi);
+    pTwiddle[2U * k + 1U] = (float32_t) cos(phi);
+  }
+  for (; k <= n4; k++)
+  {
+    pTwiddle[2U * k]      =  pTwiddle[2U * (n4 - k) + 1U];
+    pTwiddle[2U * k + 1U] =  pTwiddle[2U * (n4 - k)];
+  }
+  for (; k < n2; k++)
+  {
+    pTwiddle[2U * k]      =  pTwiddle[2U * (n2 - k)];
+    pTwiddle[2U * k + 1U] = -pTwiddle[2U * (n2 - k) + 1U];
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddle;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of RealFFTF32 group
+ */
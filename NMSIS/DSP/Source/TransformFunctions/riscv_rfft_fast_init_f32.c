@@ -40,6 +40,8 @@
  */
 
 
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
 /**
   @brief         Initialization function for the 32pt floating-point real FFT.
   @param[in,out] S  points to an riscv_rfft_fast_instance_f32 structure
@@ -316,6 +318,8 @@ riscv_status riscv_rfft_fast_init_f32(
 
 }
 
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
 /**
   @} end of RealFFTF32 group
  */
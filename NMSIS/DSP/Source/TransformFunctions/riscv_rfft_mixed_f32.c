@@ -0,0 +1,277 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_mixed_f32.c
+ * Description:  Mixed-radix RFFT & RIFFT Floating point process function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/*
+ * Real FFT extraction, in-place.
+ * Same computation as stage_rfft_f32(), but bins k and L-k are computed
+ * together from the same pair of CFFT outputs so no second buffer is needed.
+ */
+static void stage_rfft_mixed_f32(
+  const riscv_rfft_mixed_instance_f32 * S,
+        float32_t * p)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+        uint32_t L = (S->Sint).fftLen;
+        float32_t xAR, xAI;
+#if defined (RISCV_MATH_VECTOR)
+        size_t blkCnt = L >> 1U;                   /* Bins 1 ... L/2 and their mirrors */
+        size_t l;
+        float32_t *pA = p + 2;
+        float32_t *pB = p + 2U * (L - 1U);
+  const float32_t *pCoefA = pCoeff + 2;
+  const float32_t *pCoefB = pCoeff + 2U * (L - 1U);
+        vfloat32m2x2_t v_a, v_b, v_wa, v_wb;
+        vfloat32m2_t v_ar, v_ai, v_br, v_bi, v_sr, v_di, v_t1a, v_t1b;
+        vfloat32m2_t v_ca, v_sa, v_cb, v_sb;
+#else
+        uint32_t k;
+        float32_t xBR, xBI, t1a, t1b, sr, di;
+        float32_t twR, twI;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Pack DC and Nyquist values together */
+  xAR = p[0];
+  xAI = p[1];
+  p[0] = xAR + xAI;
+  p[1] = xAR - xAI;
+
+#if defined (RISCV_MATH_VECTOR)
+  for (; (l = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_a = __riscv_vlseg2e32_v_f32m2x2(pA, l);
+    v_b = __riscv_vlsseg2e32_v_f32m2x2(pB, -8, l);
+    v_wa = __riscv_vlseg2e32_v_f32m2x2(pCoefA, l);
+    v_wb = __riscv_vlsseg2e32_v_f32m2x2(pCoefB, -8, l);
+    v_ar = __riscv_vget_v_f32m2x2_f32m2(v_a, 0);
+    v_ai = __riscv_vget_v_f32m2x2_f32m2(v_a, 1);
+    v_br = __riscv_vget_v_f32m2x2_f32m2(v_b, 0);
+    v_bi = __riscv_vget_v_f32m2x2_f32m2(v_b, 1);
+    v_ca = __riscv_vget_v_f32m2x2_f32m2(v_wa, 0);
+    v_sa = __riscv_vget_v_f32m2x2_f32m2(v_wa, 1);
+    v_cb = __riscv_vget_v_f32m2x2_f32m2(v_wb, 0);
+    v_sb = __riscv_vget_v_f32m2x2_f32m2(v_wb, 1);
+
+    v_sr = __riscv_vfadd_vv_f32m2(v_ar, v_br, l);
+    v_di = __riscv_vfsub_vv_f32m2(v_ai, v_bi, l);
+    v_t1a = __riscv_vfsub_vv_f32m2(v_br, v_ar, l);
+    v_t1b = __riscv_vfadd_vv_f32m2(v_bi, v_ai, l);
+
+    /* bin k */
+    v_ar = __riscv_vfmacc_vv_f32m2(__riscv_vfmacc_vv_f32m2(v_sr, v_ca, v_t1a, l), v_sa, v_t1b, l);
+    v_ai = __riscv_vfnmsac_vv_f32m2(__riscv_vfmacc_vv_f32m2(v_di, v_sa, v_t1a, l), v_ca, v_t1b, l);
+    v_a = __riscv_vset_v_f32m2_f32m2x2(v_a, 0, __riscv_vfmul_vf_f32m2(v_ar, 0.5f, l));
+    v_a = __riscv_vset_v_f32m2_f32m2x2(v_a, 1, __riscv_vfmul_vf_f32m2(v_ai, 0.5f, l));
+
+    /* bin L-k */
+    v_br = __riscv_vfmacc_vv_f32m2(__riscv_vfnmsac_vv_f32m2(v_sr, v_cb, v_t1a, l), v_sb, v_t1b, l);
+    v_bi = __riscv_vfnmsac_vv_f32m2(__riscv_vfnmsac_vv_f32m2(__riscv_vfneg_v_f32m2(v_di, l), v_sb, v_t1a, l), v_cb, v_t1b, l);
+    v_b = __riscv_vset_v_f32m2_f32m2x2(v_b, 0, __riscv_vfmul_vf_f32m2(v_br, 0.5f, l));
+    v_b = __riscv_vset_v_f32m2_f32m2x2(v_b, 1, __riscv_vfmul_vf_f32m2(v_bi, 0.5f, l));
+
+    __riscv_vsseg2e32_v_f32m2x2(pA, v_a, l);
+    __riscv_vssseg2e32_v_f32m2x2(pB, -8, v_b, l);
+
+    pA += l * 2;
+    pB -= l * 2;
+    pCoefA += l * 2;
+    pCoefB -= l * 2;
+  }
+#else
+  for (k = 1U; k <= (L >> 1U); k++)
+  {
+    xAR = p[2U * k];
+    xAI = p[2U * k + 1U];
+    xBR = p[2U * (L - k)];
+    xBI = p[2U * (L - k) + 1U];
+
+    sr = xAR + xBR;
+    di = xAI - xBI;
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    twR = pCoeff[2U * k];
+    twI = pCoeff[2U * k + 1U];
+    p[2U * k]      = 0.5f * (sr + twR * t1a + twI * t1b);
+    p[2U * k + 1U] = 0.5f * (di + twI * t1a - twR * t1b);
+
+    twR = pCoeff[2U * (L - k)];
+    twI = pCoeff[2U * (L - k) + 1U];
+    p[2U * (L - k)]      = 0.5f * (sr - twR * t1a + twI * t1b);
+    p[2U * (L - k) + 1U] = 0.5f * (-di - twI * t1a - twR * t1b);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+/*
+ * Prepares data for the inverse cfft, in-place.
+ * Same computation as merge_rfft_f32(), bins k and L-k computed together.
+ */
+static void merge_rfft_mixed_f32(
+  const riscv_rfft_mixed_instance_f32 * S,
+        float32_t * p)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+        uint32_t L = (S->Sint).fftLen;
+        float32_t xAR, xAI;
+#if defined (RISCV_MATH_VECTOR)
+        size_t blkCnt = L >> 1U;
+        size_t l;
+        float32_t *pA = p + 2;
+        float32_t *pB = p + 2U * (L - 1U);
+  const float32_t *pCoefA = pCoeff + 2;
+  const float32_t *pCoefB = pCoeff + 2U * (L - 1U);
+        vfloat32m2x2_t v_a, v_b, v_wa, v_wb;
+        vfloat32m2_t v_ar, v_ai, v_br, v_bi, v_sr, v_di, v_t1a, v_t1b;
+        vfloat32m2_t v_ca, v_sa, v_cb, v_sb;
+#else
+        uint32_t k;
+        float32_t xBR, xBI, t1a, t1b, sr, di;
+        float32_t twR, twI;
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  xAR = p[0];
+  xAI = p[1];
+  p[0] = 0.5f * (xAR + xAI);
+  p[1] = 0.5f * (xAR - xAI);
+
+#if defined (RISCV_MATH_VECTOR)
+  for (; (l = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_a = __riscv_vlseg2e32_v_f32m2x2(pA, l);
+    v_b = __riscv_vlsseg2e32_v_f32m2x2(pB, -8, l);
+    v_wa = __riscv_vlseg2e32_v_f32m2x2(pCoefA, l);
+    v_wb = __riscv_vlsseg2e32_v_f32m2x2(pCoefB, -8, l);
+    v_ar = __riscv_vget_v_f32m2x2_f32m2(v_a, 0);
+    v_ai = __riscv_vget_v_f32m2x2_f32m2(v_a, 1);
+    v_br = __riscv_vget_v_f32m2x2_f32m2(v_b, 0);
+    v_bi = __riscv_vget_v_f32m2x2_f32m2(v_b, 1);
+    v_ca = __riscv_vget_v_f32m2x2_f32m2(v_wa, 0);
+    v_sa = __riscv_vget_v_f32m2x2_f32m2(v_wa, 1);
+    v_cb = __riscv_vget_v_f32m2x2_f32m2(v_wb, 0);
+    v_sb = __riscv_vget_v_f32m2x2_f32m2(v_wb, 1);
+
+    v_sr = __riscv_vfadd_vv_f32m2(v_ar, v_br, l);
+    v_di = __riscv_vfsub_vv_f32m2(v_ai, v_bi, l);
+    v_t1a = __riscv_vfsub_vv_f32m2(v_ar, v_br, l);
+    v_t1b = __riscv_vfadd_vv_f32m2(v_ai, v_bi, l);
+
+    /* bin k */
+    v_ar = __riscv_vfnmsac_vv_f32m2(__riscv_vfnmsac_vv_f32m2(v_sr, v_ca, v_t1a, l), v_sa, v_t1b, l);
+    v_ai = __riscv_vfnmsac_vv_f32m2(__riscv_vfmacc_vv_f32m2(v_di, v_sa, v_t1a, l), v_ca, v_t1b, l);
+    v_a = __riscv_vset_v_f32m2_f32m2x2(v_a, 0, __riscv_vfmul_vf_f32m2(v_ar, 0.5f, l));
+    v_a = __riscv_vset_v_f32m2_f32m2x2(v_a, 1, __riscv_vfmul_vf_f32m2(v_ai, 0.5f, l));
+
+    /* bin L-k */
+    v_br = __riscv_vfnmsac_vv_f32m2(__riscv_vfmacc_vv_f32m2(v_sr, v_cb, v_t1a, l), v_sb, v_t1b, l);
+    v_bi = __riscv_vfnmsac_vv_f32m2(__riscv_vfnmsac_vv_f32m2(__riscv_vfneg_v_f32m2(v_di, l), v_sb, v_t1a, l), v_cb, v_t1b, l);
+    v_b = __riscv_vset_v_f32m2_f32m2x2(v_b, 0, __riscv_vfmul_vf_f32m2(v_br, 0.5f, l));
+    v_b = __riscv_vset_v_f32m2_f32m2x2(v_b, 1, __riscv_vfmul_vf_f32m2(v_bi, 0.5f, l));
+
+    __riscv_vsseg2e32_v_f32m2x2(pA, v_a, l);
+    __riscv_vssseg2e32_v_f32m2x2(pB, -8, v_b, l);
+
+    pA += l * 2;
+    pB -= l * 2;
+    pCoefA += l * 2;
+    pCoefB -= l * 2;
+  }
+#else
+  for (k = 1U; k <= (L >> 1U); k++)
+  {
+    xAR = p[2U * k];
+    xAI = p[2U * k + 1U];
+    xBR = p[2U * (L - k)];
+    xBI = p[2U * (L - k) + 1U];
+
+    sr = xAR + xBR;
+    di = xAI - xBI;
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+
+    twR = pCoeff[2U * k];
+    twI = pCoeff[2U * k + 1U];
+    p[2U * k]      = 0.5f * (sr - twR * t1a - twI * t1b);
+    p[2U * k + 1U] = 0.5f * (di + twI * t1a - twR * t1b);
+
+    twR = pCoeff[2U * (L - k)];
+    twI = pCoeff[2U * (L - k) + 1U];
+    p[2U * (L - k)]      = 0.5f * (sr + twR * t1a - twI * t1b);
+    p[2U * (L - k) + 1U] = 0.5f * (-di - twI * t1a - twR * t1b);
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+}
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed-radix real FFT.
+  @param[in]     S         points to an riscv_rfft_mixed_instance_f32 structure
+  @param[in]     p         points to input buffer (Source buffer is modified by the inverse transform.)
+  @param[out]    pOut      points to output buffer
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+
+  @par
+                   The output of the forward transform (and input of the inverse transform)
+                   uses the packed format of \ref riscv_rfft_fast_f32().
+ */
+
+void riscv_rfft_mixed_f32(
+  const riscv_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+  const riscv_cfft_mixed_instance_f32 * Sint = &(S->Sint);
+
+  if (ifftFlag)
+  {
+    /*  Real FFT compression */
+    merge_rfft_mixed_f32(S, p);
+    /* Complex IFFT process */
+    riscv_cfft_mixed_f32(Sint, p, pOut, ifftFlag);
+  }
+  else
+  {
+    /* Calculation of RFFT of input */
+    riscv_cfft_mixed_f32(Sint, p, pOut, ifftFlag);
+    /*  Real FFT extraction */
+    stage_rfft_mixed_f32(S, pOut);
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
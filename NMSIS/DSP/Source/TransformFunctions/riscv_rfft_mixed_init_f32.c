@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix rfft f32 instance
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix real FFT.
+  @param[in,out] S               points to an riscv_rfft_mixed_instance_f32 structure
+  @param[in]     fftLen          length of the real sequence. Must be even, with fftLen/2 a product of 2, 3 and 5
+  @param[out]    pTwiddle        points to a buffer of fftLen values receiving the twiddle factors of the internal CFFT
+  @param[out]    pTwiddleRFFT    points to a buffer of fftLen values receiving the twiddle factors of the real stage
+  @param[out]    pDigitRevTable  points to a buffer of fftLen/2 values receiving the digit reversal table of the internal CFFT
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen is not a supported length
+
+  @par           Details
+                   The real stage twiddle factors use the same layout as the
+                   <code>twiddleCoef_rfft_N</code> tables of \ref riscv_rfft_fast_init_f32():
+  <pre>
+      pTwiddleRFFT[2*k]   = sin(2*pi*k/fftLen)
+      pTwiddleRFFT[2*k+1] = cos(2*pi*k/fftLen)
+  </pre>
+                   for k = 0 ... fftLen/2-1.
+ */
+
+riscv_status riscv_rfft_mixed_init_f32(
+  riscv_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pTwiddleRFFT,
+  uint16_t * pDigitRevTable)
+{
+  riscv_status status;
+  uint32_t k;
+  float64_t phi;
+
+  if ((S == NULL) || (pTwiddleRFFT == NULL) || ((fftLen & 1U) != 0U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_cfft_mixed_init_f32(&(S->Sint), fftLen >> 1U, pTwiddle, pDigitRevTable);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  for (k = 0U; k < (fftLen >> 1U); k++)
+  {
+    phi = 6.283185307179586476925286766559 * (float64_t) k / (float64_t) fftLen;
+    pTwiddleRFFT[2U * k]      = (float32_t) sin(phi);
+    pTwiddleRFFT[2U * k + 1U] = (float32_t) cos(phi);
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_f32.c
+ * Description:  Sliding DFT for floating-point data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SlidingDFT Sliding DFT
+
+  The sliding DFT updates a set of bins of the DFT of the last <code>windowLen</code>
+  input samples each time a new sample is received. The cost is one complex
+  multiplication per bin and per sample, independent of the window length, which
+  suits per-sample streaming and the tracking of a few tones.
+
+  @par           Algorithm
+                   For bin <code>k</code> of a window of <code>N = windowLen</code> samples
+  <pre>
+      X[k] = exp(j*2*pi*k/N) * (X[k] + x[n] - x[n-N])
+  </pre>
+                   After the processing function returns, <code>pBins</code> holds the
+                   complex values
+  <pre>
+      X[k] = sum(x[n-N+1+m] * exp(-j*2*pi*k*m/N)), m = 0 ... N-1
+  </pre>
+                   where <code>x[n]</code> is the last input sample. The vector version
+                   keeps a group of bins in registers for the whole block.
+
+  @par           Instance Structure
+                   The instance holds the twiddle factors of the bins, the complex bins
+                   and a delay line of <code>windowLen</code> samples indexed by
+                   <code>stateIndex</code>. The initialization function computes the
+                   twiddle factors with a magnitude not larger than 1, so the recursion
+                   cannot diverge, and clears the bins and the delay line.
+
+  @par           Fixed-Point Behavior
+                   The twiddle factors are Q31 values for both fixed-point types. The Q15 bins
+                   are kept in 17.15 format and the Q31 bins in 33.31 format, with
+                   <code>log2(windowLen) + 1</code> guard bits needed for full scale inputs.
+                   The rotations are rounded.
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Sliding DFT update for floating-point data.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of input samples
+  @return        none
+ */
+void riscv_sdft_f32(
+        riscv_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t windowLen = S->windowLen;
+  uint32_t numBins = S->numBins;
+  const float32_t *pCos = S->pTwiddle;
+  const float32_t *pSin = pCos + numBins;
+  float32_t *pBins = S->pBins;
+  float32_t *pDelay = S->pDelay;
+  float32_t d;
+  uint32_t n, j;
+
+#if defined (RISCV_MATH_VECTOR)
+  uint32_t blkCnt = numBins;
+  size_t l;
+  vfloat32m4x2_t v_x;
+  vfloat32m4_t v_c, v_s, v_re, v_im, v_t;
+
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_x = __riscv_vlseg2e32_v_f32m4x2(pBins, l);
+    v_re = __riscv_vget_v_f32m4x2_f32m4(v_x, 0);
+    v_im = __riscv_vget_v_f32m4x2_f32m4(v_x, 1);
+    v_c = __riscv_vle32_v_f32m4(pCos, l);
+    v_s = __riscv_vle32_v_f32m4(pSin, l);
+    j = S->stateIndex;
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n] - x[n-N], the oldest samples of a long block are in the block itself */
+      d = pSrc[n] - ((n < windowLen) ? pDelay[j] : pSrc[n - windowLen]);
+      j = (j + 1U == windowLen) ? 0U : (j + 1U);
+
+      v_t = __riscv_vfadd_vf_f32m4(v_re, d, l);
+      v_re = __riscv_vfnmsac_vv_f32m4(__riscv_vfmul_vv_f32m4(v_t, v_c, l), v_im, v_s, l);
+      v_im = __riscv_vfmacc_vv_f32m4(__riscv_vfmul_vv_f32m4(v_im, v_c, l), v_t, v_s, l);
+    }
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 0, v_re);
+    v_x = __riscv_vset_v_f32m4_f32m4x2(v_x, 1, v_im);
+    __riscv_vsseg2e32_v_f32m4x2(pBins, v_x, l);
+
+    pBins += 2U * l;
+    pCos += l;
+    pSin += l;
+  }
+#else
+  uint32_t i;
+  float32_t re, im, t;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    re = pBins[2U * i];
+    im = pBins[2U * i + 1U];
+    j = S->stateIndex;
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n] - x[n-N], the oldest samples of a long block are in the block itself */
+      d = pSrc[n] - ((n < windowLen) ? pDelay[j] : pSrc[n - windowLen]);
+      j = (j + 1U == windowLen) ? 0U : (j + 1U);
+
+      t = re + d;
+      re = t * pCos[i] - im * pSin[i];
+      im = t * pSin[i] + im * pCos[i];
+    }
+    pBins[2U * i] = re;
+    pBins[2U * i + 1U] = im;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) */
+
+  /* Update the delay line */
+  j = S->stateIndex;
+  for (n = 0U; n < blockSize; n++)
+  {
+    pDelay[j] = pSrc[n];
+    j = (j + 1U == windowLen) ? 0U : (j + 1U);
+  }
+  S->stateIndex = (uint16_t) j;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_init_f32.c
+ * Description:  Initialization function for the floating-point sliding DFT
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     windowLen  length of the DFT window
+  @param[in]     numBins    number of tracked bins
+  @param[in]     pBinIndex  points to the indexes of the tracked bins, smaller than <code>windowLen</code>
+  @param[out]    pTwiddle   points to a table of <code>2*numBins</code> values receiving the twiddle factors
+  @param[out]    pBins      points to the <code>2*numBins</code> values of the complex bins
+  @param[out]    pDelay     points to the delay line of <code>windowLen</code> samples
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>windowLen</code> is 0 or a bin index is out of range
+
+  @par           Details
+                   The twiddle factors are rounded toward zero when the rounded value would
+                   have a magnitude larger than 1. The bins and the delay line are cleared.
+ */
+riscv_status riscv_sdft_init_f32(
+        riscv_sdft_instance_f32 * S,
+        uint16_t windowLen,
+        uint16_t numBins,
+  const uint16_t * pBinIndex,
+        float32_t * pTwiddle,
+        float32_t * pBins,
+        float32_t * pDelay)
+{
+  float64_t phi;
+  float32_t c, s;
+  uint32_t i;
+
+  if (windowLen == 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    if (pBinIndex[i] >= windowLen)
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+    phi = 6.283185307179586476925286766559 * (float64_t) pBinIndex[i] / (float64_t) windowLen;
+    c = (float32_t) cos(phi);
+    s = (float32_t) sin(phi);
+    while ((float64_t) c * c + (float64_t) s * s > 1.0)
+    {
+      if (fabsf(c) > fabsf(s))
+      {
+        c = nextafterf(c, 0.0f);
+      }
+      else
+      {
+        s = nextafterf(s, 0.0f);
+      }
+    }
+    pTwiddle[i] = c;
+    pTwiddle[numBins + i] = s;
+  }
+
+  memset(pBins, 0, 2U * numBins * sizeof(float32_t));
+  memset(pDelay, 0, windowLen * sizeof(float32_t));
+
+  S->windowLen = windowLen;
+  S->numBins = numBins;
+  S->stateIndex = 0U;
+  S->pTwiddle = pTwiddle;
+  S->pBins = pBins;
+  S->pDelay = pDelay;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_q15.c
+ * Description:  Sliding DFT for Q15 data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Sliding DFT update for Q15 data.
+  @param[in,out] S          points to an instance of the Q15 sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of input samples
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The bins are kept in 17.15 format and are not saturated:
+                   <code>windowLen</code> must not be larger than 32768.
+ */
+void riscv_sdft_q15(
+        riscv_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t windowLen = S->windowLen;
+  uint32_t numBins = S->numBins;
+  const q31_t *pCos = S->pTwiddle;
+  const q31_t *pSin = pCos + numBins;
+  q31_t *pBins = S->pBins;
+  q15_t *pDelay = S->pDelay;
+  q31_t d;
+  uint32_t n, j;
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  uint32_t blkCnt = numBins;
+  size_t l;
+  vint32m4_t v_c, v_s, v_re, v_im, v_t;
+  vint64m8_t v_acc;
+
+  for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_re = __riscv_vlse32_v_i32m4(pBins, 2 * sizeof(q31_t), l);
+    v_im = __riscv_vlse32_v_i32m4(pBins + 1, 2 * sizeof(q31_t), l);
+    v_c = __riscv_vle32_v_i32m4(pCos, l);
+    v_s = __riscv_vle32_v_i32m4(pSin, l);
+    j = S->stateIndex;
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n] - x[n-N], the oldest samples of a long block are in the block itself */
+      d = (q31_t) pSrc[n] - ((n < windowLen) ? pDelay[j] : pSrc[n - windowLen]);
+      j = (j + 1U == windowLen) ? 0U : (j + 1U);
+
+      v_t = __riscv_vadd_vx_i32m4(v_re, d, l);
+      v_acc = __riscv_vsub_vv_i64m8(__riscv_vwmul_vv_i64m8(v_t, v_c, l), __riscv_vwmul_vv_i64m8(v_im, v_s, l), l);
+      v_re = __riscv_vnsra_wx_i32m4(__riscv_vadd_vx_i64m8(v_acc, 0x40000000LL, l), 31, l);
+      v_acc = __riscv_vadd_vv_i64m8(__riscv_vwmul_vv_i64m8(v_t, v_s, l), __riscv_vwmul_vv_i64m8(v_im, v_c, l), l);
+      v_im = __riscv_vnsra_wx_i32m4(__riscv_vadd_vx_i64m8(v_acc, 0x40000000LL, l), 31, l);
+    }
+    __riscv_vsse32_v_i32m4(pBins, 2 * sizeof(q31_t), v_re, l);
+    __riscv_vsse32_v_i32m4(pBins + 1, 2 * sizeof(q31_t), v_im, l);
+
+    pBins += 2U * l;
+    pCos += l;
+    pSin += l;
+  }
+#else
+  uint32_t i;
+  q31_t re, im, t;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    re = pBins[2U * i];
+    im = pBins[2U * i + 1U];
+    j = S->stateIndex;
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n] - x[n-N], the oldest samples of a long block are in the block itself */
+      d = (q31_t) pSrc[n] - ((n < windowLen) ? pDelay[j] : pSrc[n - windowLen]);
+      j = (j + 1U == windowLen) ? 0U : (j + 1U);
+
+      t = re + d;
+      re = (q31_t) (((q63_t) t * pCos[i] - (q63_t) im * pSin[i] + 0x40000000LL) >> 31);
+      im = (q31_t) (((q63_t) t * pSin[i] + (q63_t) im * pCos[i] + 0x40000000LL) >> 31);
+    }
+    pBins[2U * i] = re;
+    pBins[2U * i + 1U] = im;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* Update the delay line */
+  j = S->stateIndex;
+  for (n = 0U; n < blockSize; n++)
+  {
+    pDelay[j] = pSrc[n];
+    j = (j + 1U == windowLen) ? 0U : (j + 1U);
+  }
+  S->stateIndex = (uint16_t) j;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
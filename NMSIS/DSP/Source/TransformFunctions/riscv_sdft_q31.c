@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_q31.c
+ * Description:  Sliding DFT for Q31 data
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+#if !(defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64))
+/*
+ * Rounded product of a 64-bit value and a Q31 coefficient, shifted right by 31 bits
+ * and computed on the two halves of the value to stay in 64 bits.
+ */
+static q63_t riscv_sdft_mult_q31(
+  q63_t a,
+  q31_t b)
+{
+  return ((a >> 32) * b) * 2 + (((a & 0xFFFFFFFFLL) * b + 0x40000000LL) >> 31);
+}
+#endif /* !(defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)) */
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Sliding DFT update for Q31 data.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of input samples
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The bins are kept in 33.31 format and do not overflow.
+ */
+void riscv_sdft_q31(
+        riscv_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+  uint32_t windowLen = S->windowLen;
+  uint32_t numBins = S->numBins;
+  const q31_t *pCos = S->pTwiddle;
+  const q31_t *pSin = pCos + numBins;
+  q63_t *pBins = S->pBins;
+  q31_t *pDelay = S->pDelay;
+  q63_t d;
+  uint32_t n, j;
+
+#if defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64)
+  uint32_t blkCnt = numBins;
+  size_t l;
+  vint64m4_t v_c, v_s, v_re, v_im, v_t, v_a, v_b;
+
+  for (; (l = __riscv_vsetvl_e64m4(blkCnt)) > 0; blkCnt -= l)
+  {
+    v_re = __riscv_vlse64_v_i64m4(pBins, 2 * sizeof(q63_t), l);
+    v_im = __riscv_vlse64_v_i64m4(pBins + 1, 2 * sizeof(q63_t), l);
+    v_c = __riscv_vsext_vf2_i64m4(__riscv_vle32_v_i32m2(pCos, l), l);
+    v_s = __riscv_vsext_vf2_i64m4(__riscv_vle32_v_i32m2(pSin, l), l);
+    j = S->stateIndex;
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n] - x[n-N], the oldest samples of a long block are in the block itself */
+      d = (q63_t) pSrc[n] - ((n < windowLen) ? pDelay[j] : pSrc[n - windowLen]);
+      j = (j + 1U == windowLen) ? 0U : (j + 1U);
+
+      v_t = __riscv_vadd_vx_i64m4(v_re, d, l);
+
+      /* Products on the two halves of t and im: (hi * c) * 2 + ((lo * c + 2^30) >> 31) */
+      v_a = __riscv_vsub_vv_i64m4(__riscv_vmul_vv_i64m4(__riscv_vsra_vx_i64m4(v_t, 32, l), v_c, l),
+                                  __riscv_vmul_vv_i64m4(__riscv_vsra_vx_i64m4(v_im, 32, l), v_s, l), l);
+      v_b = __riscv_vsub_vv_i64m4(
+              __riscv_vsra_vx_i64m4(__riscv_vadd_vx_i64m4(__riscv_vmul_vv_i64m4(__riscv_vand_vx_i64m4(v_t, 0xFFFFFFFFLL, l), v_c, l), 0x40000000LL, l), 31, l),
+              __riscv_vsra_vx_i64m4(__riscv_vadd_vx_i64m4(__riscv_vmul_vv_i64m4(__riscv_vand_vx_i64m4(v_im, 0xFFFFFFFFLL, l), v_s, l), 0x40000000LL, l), 31, l), l);
+      v_re = __riscv_vadd_vv_i64m4(__riscv_vsll_vx_i64m4(v_a, 1, l), v_b, l);
+
+      v_a = __riscv_vadd_vv_i64m4(__riscv_vmul_vv_i64m4(__riscv_vsra_vx_i64m4(v_t, 32, l), v_s, l),
+                                  __riscv_vmul_vv_i64m4(__riscv_vsra_vx_i64m4(v_im, 32, l), v_c, l), l);
+      v_b = __riscv_vadd_vv_i64m4(
+              __riscv_vsra_vx_i64m4(__riscv_vadd_vx_i64m4(__riscv_vmul_vv_i64m4(__riscv_vand_vx_i64m4(v_t, 0xFFFFFFFFLL, l), v_s, l), 0x40000000LL, l), 31, l),
+              __riscv_vsra_vx_i64m4(__riscv_vadd_vx_i64m4(__riscv_vmul_vv_i64m4(__riscv_vand_vx_i64m4(v_im, 0xFFFFFFFFLL, l), v_c, l), 0x40000000LL, l), 31, l), l);
+      v_im = __riscv_vadd_vv_i64m4(__riscv_vsll_vx_i64m4(v_a, 1, l), v_b, l);
+    }
+    __riscv_vsse64_v_i64m4(pBins, 2 * sizeof(q63_t), v_re, l);
+    __riscv_vsse64_v_i64m4(pBins + 1, 2 * sizeof(q63_t), v_im, l);
+
+    pBins += 2U * l;
+    pCos += l;
+    pSin += l;
+  }
+#else
+  uint32_t i;
+  q63_t re, im, t;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    re = pBins[2U * i];
+    im = pBins[2U * i + 1U];
+    j = S->stateIndex;
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n] - x[n-N], the oldest samples of a long block are in the block itself */
+      d = (q63_t) pSrc[n] - ((n < windowLen) ? pDelay[j] : pSrc[n - windowLen]);
+      j = (j + 1U == windowLen) ? 0U : (j + 1U);
+
+      t = re + d;
+      re = riscv_sdft_mult_q31(t, pCos[i]) - riscv_sdft_mult_q31(im, pSin[i]);
+      im = riscv_sdft_mult_q31(t, pSin[i]) + riscv_sdft_mult_q31(im, pCos[i]);
+    }
+    pBins[2U * i] = re;
+    pBins[2U * i + 1U] = im;
+  }
+#endif /* defined (RISCV_MATH_VECTOR) && (__RISCV_XLEN == 64) */
+
+  /* Update the delay line */
+  j = S->stateIndex;
+  for (n = 0U; n < blockSize; n++)
+  {
+    pDelay[j] = pSrc[n];
+    j = (j + 1U == windowLen) ? 0U : (j + 1U);
+  }
+  S->stateIndex = (uint16_t) j;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
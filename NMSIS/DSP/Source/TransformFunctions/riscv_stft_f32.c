@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_stft_f32.c
+ * Description:  Streaming STFT (analysis) Floating point process function
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFT Short-Time Fourier Transform
+
+  @par
+                   The STFT functions turn a stream of real samples into a sequence of
+                   overlapping windowed spectra, and back.
+                   They are built on \ref riscv_rfft_fast_f32() and a precomputed window.
+  @par
+                   The analysis instance keeps the last fftLen input samples in a ring buffer.
+                   \ref riscv_stft_f32() accepts input blocks of any size and, each time hopSize
+                   new samples have been received, multiplies the ring buffer by the window
+                   directly into the scratch buffer and computes the RFFT of the scratch buffer
+                   directly into the next frame of the output buffer.
+                   Frames use the packed format of \ref riscv_rfft_fast_f32() (fftLen values).
+  @par
+                   The synthesis instance keeps an overlap-add accumulator of fftLen samples,
+                   also managed as a ring buffer, so no state is shifted between frames.
+                   \ref riscv_istft_f32() takes one frame and produces hopSize output samples.
+                   The synthesis window is derived from the analysis window by
+                   \ref riscv_istft_init_f32() so that an unmodified stream is reconstructed
+                   exactly, delayed by fftLen - hopSize samples.
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point streaming STFT.
+  @param[in,out] S          points to an instance of the floating-point STFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of input samples, any value
+  @param[out]    pDst       points to the output frames, fftLen values per frame
+  @return        number of frames written to pDst
+
+  @par           Details
+                   A frame is written each time hopSize new samples have been received.
+                   Samples left over from previous calls are less than hopSize, so a block
+                   produces at most <code>ceil(blockSize / hopSize)</code> frames and pDst
+                   must be sized accordingly.
+ */
+
+uint32_t riscv_stft_f32(
+        riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst)
+{
+  const float32_t *pWindow = S->pWindow;
+        float32_t *pState = S->pState;
+        float32_t *pScratch = S->pScratch;
+        uint32_t fftLen = S->fftLen;
+        uint32_t hopSize = S->hopSize;
+        uint32_t writeIndex = S->writeIndex;
+        uint32_t fill = S->fill;
+        uint32_t nbFrames = 0U;
+        uint32_t n;
+
+  while (blockSize > 0U)
+  {
+    /* Copy as many samples as possible into the ring buffer, without wrapping */
+    n = hopSize - fill;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+    if (n > (fftLen - writeIndex))
+    {
+      n = fftLen - writeIndex;
+    }
+
+    riscv_copy_f32(pSrc, pState + writeIndex, n);
+    pSrc += n;
+    blockSize -= n;
+    fill += n;
+    writeIndex += n;
+    if (writeIndex == fftLen)
+    {
+      writeIndex = 0U;
+    }
+
+    if (fill == hopSize)
+    {
+      /* Oldest sample is at writeIndex: window both parts of the ring buffer */
+      riscv_mult_f32(pState + writeIndex, pWindow, pScratch, fftLen - writeIndex);
+      riscv_mult_f32(pState, pWindow + (fftLen - writeIndex), pScratch + (fftLen - writeIndex), writeIndex);
+
+      riscv_rfft_fast_f32(&(S->rfft), pScratch, pDst, 0);
+
+      pDst += fftLen;
+      nbFrames++;
+      fill = 0U;
+    }
+  }
+
+  S->writeIndex = (uint16_t) writeIndex;
+  S->fill = (uint16_t) fill;
+
+  return nbFrames;
+}
+
+/**
+  @} end of STFT group
+ */
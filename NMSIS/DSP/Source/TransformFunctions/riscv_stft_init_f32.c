@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_stft_init_f32.c
+ * Description:  Initialization function for the streaming STFT f32 instance
+ *
+ * $Date:        16 October 2026
+ * $Revision:    V1.9.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/*
+ * Sets the instance fields once the real FFT is initialized and clears the ring buffer.
+ */
+static void riscv_stft_setup_f32(
+        riscv_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pScratch)
+{
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->writeIndex = 0U;
+  S->fill = 0U;
+  S->pWindow = pWindow;
+  S->pState = pState;
+  S->pScratch = pScratch;
+
+  riscv_fill_f32(0.0f, pState, fftLen);
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+#if !defined(RISCV_FFT_NO_ROM_TABLES)
+
+/**
+  @brief         Initialization function for the floating-point streaming STFT.
+  @param[in,out] S         points to an instance of the floating-point STFT structure
+  @param[in]     fftLen    length of the FFT (any length supported by \ref riscv_rfft_fast_init_f32())
+  @param[in]     hopSize   number of new samples between two frames, 1 <= hopSize <= fftLen
+  @param[in]     pWindow   points to the analysis window of fftLen values
+  @param[in]     pState    points to the ring buffer of fftLen values
+  @param[in]     pScratch  points to the scratch buffer of fftLen values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen or hopSize is not supported
+
+  @par           Details
+                   The window is typically generated once with \ref riscv_hanning_f32()
+                   or \ref riscv_hamming_f32() and may be shared by several instances.
+                   The ring buffer is cleared so the first frames see zeros before
+                   the first input sample.
+ */
+
+riscv_status riscv_stft_init_f32(
+        riscv_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pScratch)
+{
+  riscv_status status;
+
+  if ((hopSize == 0U) || (hopSize > fftLen))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_rfft_fast_init_f32(&(S->rfft), fftLen);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  riscv_stft_setup_f32(S, fftLen, hopSize, pWindow, pState, pScratch);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+#endif /* !defined(RISCV_FFT_NO_ROM_TABLES) */
+
+/**
+  @brief         Initialization function for the floating-point streaming STFT with FFT tables computed at runtime.
+  @param[in,out] S         points to an instance of the floating-point STFT structure
+  @param[in]     fftLen    length of the FFT (any length supported by \ref riscv_rfft_fast_init_dynamic_f32())
+  @param[in]     hopSize   number of new samples between two frames, 1 <= hopSize <= fftLen
+  @param[in]     pWindow   points to the analysis window of fftLen values
+  @param[in]     pState    points to the ring buffer of fftLen values
+  @param[in]     pScratch  points to the scratch buffer of fftLen values
+  @param[out]    pBuffer   points to a buffer of <code>RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(fftLen)</code>
+                           values receiving the FFT tables
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen or hopSize is not supported
+
+  @par           Details
+                   Same as \ref riscv_stft_init_f32() but the real FFT is initialized with
+                   \ref riscv_rfft_fast_init_dynamic_f32(). It is also available when the library
+                   is built with <code>RISCV_FFT_NO_ROM_TABLES</code>.
+ */
+
+riscv_status riscv_stft_init_dynamic_f32(
+        riscv_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pScratch,
+        float32_t * pBuffer)
+{
+  riscv_status status;
+
+  if ((hopSize == 0U) || (hopSize > fftLen))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_rfft_fast_init_dynamic_f32(&(S->rfft), fftLen, pBuffer);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  riscv_stft_setup_f32(S, fftLen, hopSize, pWindow, pState, pScratch);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of STFT group
+ */
@@ -25,6 +25,13 @@ float32_t test_conv_input_f32_A[ARRAYA_SIZE_F32];
 float32_t test_conv_input_f32_B[ARRAYB_SIZE_F32];
 float32_t output_f32[2 * max(ARRAYA_SIZE_F32, ARRAYB_SIZE_F32)];
 float32_t output_f32_ref[2 * max(ARRAYA_SIZE_F32, ARRAYB_SIZE_F32)];
+#define FFT_LEN_F32 256
+riscv_rfft_fast_instance_f32 rfft_f32;
+float32_t f32_pScratch[RISCV_CONV_FFT_SCRATCH_SIZE_F32(FFT_LEN_F32)];
+#define ARRAYL_SIZE_F32 1000     /* several overlap-add blocks of FFT_LEN_F32 */
+float32_t test_conv_input_f32_L[ARRAYL_SIZE_F32];
+float32_t output_long_f32[2 * ARRAYL_SIZE_F32];
+float32_t output_long_f32_ref[2 * ARRAYL_SIZE_F32];
 
 #define ARRAYA_SIZE_Q31 200
 #define ARRAYB_SIZE_Q31 100
@@ -66,6 +73,62 @@ void riscv_conv_functions(void)
     }
     BENCH_STATUS(riscv_conv_f32);
 
+    BENCH_START(riscv_conv_fft_f32);
+    riscv_conv_fft_f32(&rfft_f32, test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                       output_f32, f32_pScratch);
+    BENCH_END(riscv_conv_fft_f32);
+    s = verify_results_f32(output_f32_ref, output_f32, ARRAYA_SIZE_F32 + ARRAYB_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_conv_fft_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_conv_fft_f32);
+
+    BENCH_START(riscv_conv_auto_f32);
+    riscv_conv_auto_f32(&rfft_f32, test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                        output_f32, f32_pScratch);
+    BENCH_END(riscv_conv_auto_f32);
+    s = verify_results_f32(output_f32_ref, output_f32, ARRAYA_SIZE_F32 + ARRAYB_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_conv_auto_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_conv_auto_f32);
+
+    // without an RFFT instance the direct form is used
+    riscv_conv_auto_f32(NULL, test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                        output_f32, NULL);
+    s = verify_results_f32(output_f32_ref, output_f32, ARRAYA_SIZE_F32 + ARRAYB_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_conv_auto_f32);
+        test_flag_error = 1;
+    }
+
+    // input longer than one FFT, shorter sequence first
+    ref_conv_f32(test_conv_input_f32_B, ARRAYB_SIZE_F32, test_conv_input_f32_L, ARRAYL_SIZE_F32,
+                 output_long_f32_ref);
+    BENCH_START(riscv_conv_fft_f32);
+    riscv_conv_fft_f32(&rfft_f32, test_conv_input_f32_B, ARRAYB_SIZE_F32, test_conv_input_f32_L, ARRAYL_SIZE_F32,
+                       output_long_f32, f32_pScratch);
+    BENCH_END(riscv_conv_fft_f32);
+    s = verify_results_f32(output_long_f32_ref, output_long_f32, ARRAYL_SIZE_F32 + ARRAYB_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_conv_fft_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_conv_fft_f32);
+
+    BENCH_START(riscv_conv_auto_f32);
+    riscv_conv_auto_f32(&rfft_f32, test_conv_input_f32_L, ARRAYL_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                        output_long_f32, f32_pScratch);
+    BENCH_END(riscv_conv_auto_f32);
+    s = verify_results_f32(output_long_f32_ref, output_long_f32, ARRAYL_SIZE_F32 + ARRAYB_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_conv_auto_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_conv_auto_f32);
+
     BENCH_START(riscv_conv_q31);
     riscv_conv_q31(test_conv_input_q31_A, ARRAYA_SIZE_Q31, test_conv_input_q31_B, ARRAYB_SIZE_Q31,
                  output_q31);
@@ -189,6 +252,80 @@ void riscv_correlate_functions(void)
     }
     BENCH_STATUS(riscv_correlate_f32);
 
+    BENCH_START(riscv_correlate_fft_f32);
+    riscv_correlate_fft_f32(&rfft_f32, test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                            output_f32, f32_pScratch);
+    BENCH_END(riscv_correlate_fft_f32);
+    s = verify_results_f32(output_f32_ref + zero_padding, output_f32 + zero_padding, ARRAYA_SIZE_F32 + ARRAYB_SIZE_F32 - 2);
+    if (s != 0) {
+        BENCH_ERROR(riscv_correlate_fft_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_correlate_fft_f32);
+
+    memset(output_f32, 0, sizeof(output_f32));
+    BENCH_START(riscv_correlate_auto_f32);
+    riscv_correlate_auto_f32(&rfft_f32, test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                             output_f32, f32_pScratch);
+    BENCH_END(riscv_correlate_auto_f32);
+    s = verify_results_f32(output_f32_ref + zero_padding, output_f32 + zero_padding, ARRAYA_SIZE_F32 + ARRAYB_SIZE_F32 - 2);
+    if (s != 0) {
+        BENCH_ERROR(riscv_correlate_auto_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_correlate_auto_f32);
+
+    // srcALen < srcBLen: reversed output followed by the zero padding
+    memset(output_f32_ref, 0, sizeof(output_f32_ref));
+    ref_correlate_f32(test_conv_input_f32_B, ARRAYB_SIZE_F32, test_conv_input_f32_A, ARRAYA_SIZE_F32,
+                      output_f32_ref);
+    BENCH_START(riscv_correlate_fft_f32);
+    riscv_correlate_fft_f32(&rfft_f32, test_conv_input_f32_B, ARRAYB_SIZE_F32, test_conv_input_f32_A, ARRAYA_SIZE_F32,
+                            output_f32, f32_pScratch);
+    BENCH_END(riscv_correlate_fft_f32);
+    s = verify_results_f32(output_f32_ref, output_f32, 2 * ARRAYA_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_correlate_fft_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_correlate_fft_f32);
+
+    memset(output_f32, 0, sizeof(output_f32));
+    riscv_correlate_auto_f32(&rfft_f32, test_conv_input_f32_B, ARRAYB_SIZE_F32, test_conv_input_f32_A, ARRAYA_SIZE_F32,
+                             output_f32, f32_pScratch);
+    s = verify_results_f32(output_f32_ref, output_f32, 2 * ARRAYA_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_correlate_auto_f32);
+        test_flag_error = 1;
+    }
+
+    // input longer than one FFT, in both orders
+    memset(output_long_f32_ref, 0, sizeof(output_long_f32_ref));
+    ref_correlate_f32(test_conv_input_f32_L, ARRAYL_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                      output_long_f32_ref);
+    memset(output_long_f32, 0, sizeof(output_long_f32));
+    BENCH_START(riscv_correlate_auto_f32);
+    riscv_correlate_auto_f32(&rfft_f32, test_conv_input_f32_L, ARRAYL_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                             output_long_f32, f32_pScratch);
+    BENCH_END(riscv_correlate_auto_f32);
+    s = verify_results_f32(output_long_f32_ref, output_long_f32, 2 * ARRAYL_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_correlate_auto_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_correlate_auto_f32);
+
+    memset(output_long_f32_ref, 0, sizeof(output_long_f32_ref));
+    ref_correlate_f32(test_conv_input_f32_B, ARRAYB_SIZE_F32, test_conv_input_f32_L, ARRAYL_SIZE_F32,
+                      output_long_f32_ref);
+    riscv_correlate_fft_f32(&rfft_f32, test_conv_input_f32_B, ARRAYB_SIZE_F32, test_conv_input_f32_L, ARRAYL_SIZE_F32,
+                            output_long_f32, f32_pScratch);
+    s = verify_results_f32(output_long_f32_ref, output_long_f32, 2 * ARRAYL_SIZE_F32 - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_correlate_fft_f32);
+        test_flag_error = 1;
+    }
+
     BENCH_START(riscv_correlate_q31);
     riscv_correlate_q31(test_conv_input_q31_A, ARRAYA_SIZE_Q31, test_conv_input_q31_B, ARRAYB_SIZE_Q31,
                       output_q31);
@@ -324,6 +461,30 @@ void riscv_conv_partial_functions(void)
     }
     BENCH_STATUS(riscv_conv_partial_f32);
 
+    BENCH_START(riscv_conv_partial_fft_f32);
+    riscv_conv_partial_fft_f32(&rfft_f32, test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                               output_f32, firstIndex, numPoints, f32_pScratch);
+    BENCH_END(riscv_conv_partial_fft_f32);
+    s = verify_results_f32(output_f32_ref + firstIndex, output_f32 + firstIndex, numPoints - 1);
+    if (s != 0) {
+        BENCH_ERROR(riscv_conv_partial_fft_f32);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_conv_partial_fft_f32);
+
+    // requested points in the later blocks of an input longer than one FFT
+    firstIndex = 500;
+    numPoints = 300;
+    ref_conv_partial_f32(test_conv_input_f32_L, ARRAYL_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                         output_long_f32_ref, firstIndex, numPoints);
+    riscv_conv_partial_fft_f32(&rfft_f32, test_conv_input_f32_L, ARRAYL_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                               output_long_f32, firstIndex, numPoints, f32_pScratch);
+    s = verify_results_f32(output_long_f32_ref + firstIndex, output_long_f32 + firstIndex, numPoints);
+    if (s != 0) {
+        BENCH_ERROR(riscv_conv_partial_fft_f32);
+        test_flag_error = 1;
+    }
+
     firstIndex = 10;
     numPoints = 100;
     BENCH_START(riscv_conv_partial_q31);
@@ -466,6 +627,8 @@ int main(void)
     }
     generate_rand_f32(test_conv_input_f32_A, ARRAYA_SIZE_F32);
     generate_rand_f32(test_conv_input_f32_B, ARRAYB_SIZE_F32);
+    generate_rand_f32(test_conv_input_f32_L, ARRAYL_SIZE_F32);
+    riscv_rfft_fast_init_f32(&rfft_f32, FFT_LEN_F32);
 
     // *****************************************************
     // conv part
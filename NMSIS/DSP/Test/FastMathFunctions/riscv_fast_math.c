@@ -132,6 +132,41 @@ static int DSP_LOG(void)
     BENCH_STATUS(riscv_vlog_f32);
 }
 
+#define LOG_SPECIALS 6
+static const float32_t log_special_in[LOG_SPECIALS] = {0.0f, -0.0f, -1.0f, INFINITY, -INFINITY, NAN};
+
+static int DSP_LOG_RANGE(void)
+{
+    float32_t err, maxErr = 0.0f;
+    uint32_t i;
+
+    /* positive values from subnormals to the largest finite values */
+    for (i = 0; i < BLOCK_TESTSZ - LOG_SPECIALS; i++) {
+        f32_pIN[i] = ldexpf(1.0f + (float32_t)(rand() % 1000) / 1000.0f, (int)(i * 277 / (BLOCK_TESTSZ - LOG_SPECIALS)) - 149);
+    }
+    for (i = 0; i < LOG_SPECIALS; i++) {
+        f32_pIN[BLOCK_TESTSZ - LOG_SPECIALS + i] = log_special_in[i];
+    }
+    riscv_vlog_f32(f32_pIN, f32_pOUT, BLOCK_TESTSZ);
+    ref_vlog_f32(f32_pIN, f32_pOUT_ref, BLOCK_TESTSZ);
+    for (i = 0; i < BLOCK_TESTSZ - LOG_SPECIALS; i++) {
+        err = fabsf(f32_pOUT[i] - f32_pOUT_ref[i]) / fmaxf(1.0f, fabsf(f32_pOUT_ref[i]));
+        maxErr = fmaxf(maxErr, err);
+    }
+    /* log(+-0) = -inf, log(x < 0) = NaN, log(inf) = inf, log(NaN) = NaN */
+    if ((maxErr > 1e-6f) ||
+        !(isinf(f32_pOUT[BLOCK_TESTSZ - 6]) && (f32_pOUT[BLOCK_TESTSZ - 6] < 0.0f)) ||
+        !(isinf(f32_pOUT[BLOCK_TESTSZ - 5]) && (f32_pOUT[BLOCK_TESTSZ - 5] < 0.0f)) ||
+        !isnan(f32_pOUT[BLOCK_TESTSZ - 4]) ||
+        !(isinf(f32_pOUT[BLOCK_TESTSZ - 3]) && (f32_pOUT[BLOCK_TESTSZ - 3] > 0.0f)) ||
+        !isnan(f32_pOUT[BLOCK_TESTSZ - 2]) ||
+        !isnan(f32_pOUT[BLOCK_TESTSZ - 1])) {
+        BENCH_ERROR(riscv_vlog_f32);
+        printf("riscv_vlog_f32 range test failed with max relative error:%e\n", maxErr);
+        test_flag_error = 1;
+    }
+}
+
 static int DSP_COS(void)
 {
     // f32_cos
@@ -250,6 +285,7 @@ int main(void)
     DSP_DIVIDE();
     DSP_EXP();
     DSP_LOG();
+    DSP_LOG_RANGE();
     DSP_COS();
     DSP_SIN();
 
@@ -62,6 +62,19 @@ q15_t firStateq15_LMS[TEST_LENGTH_SAMPLES + NUM_TAPS - 1];
 q15_t testInput_q15_50Hz_200Hz[TEST_LENGTH_SAMPLES] = {0}, testOutput_q15[TEST_LENGTH_SAMPLES] = {0},testOutput_q15_ref[TEST_LENGTH_SAMPLES] = {0};
 q15_t firCoeffs32LP_q15[NUM_TAPS] = {0};
 
+// frequency domain block LMS: identification of a long random echo path
+#define FD_NUM_TAPS 512
+#define FD_BLOCK_LEN 64
+#define FD_LENGTH 8192
+float32_t fdEchoPath[FD_NUM_TAPS];
+float32_t fdCoeffs[FD_NUM_TAPS];
+float32_t fdInput[FD_LENGTH];
+float32_t fdRef[FD_LENGTH];
+float32_t fdOut[FD_BLOCK_LEN];
+float32_t fdErr[FD_LENGTH];
+float32_t fdCoeffSpectra[RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(FD_NUM_TAPS, FD_BLOCK_LEN)];
+float32_t fdState[RISCV_LMS_FD_STATE_SIZE_F32(FD_NUM_TAPS, FD_BLOCK_LEN)];
+
 //***************************************************************************************
 // Normalized LMS Filters
 //***************************************************************************************
@@ -181,6 +194,45 @@ static void riscv_fir_q15_NLMS_lp(void)
     BENCH_STATUS(riscv_lms_norm_q15);
 #endif
 }
+static void riscv_fir_f32_LMS_FD_lp(void)
+{
+    riscv_lms_fd_instance_f32 S;
+    float32_t errStart, errEnd, decay = 1.0f;
+    uint32_t i, k, n;
+
+    /* Random echo path with an exponentially decaying envelope */
+    generate_rand_f32(fdEchoPath, FD_NUM_TAPS);
+    for (i = 0; i < FD_NUM_TAPS; i++) {
+        fdEchoPath[i] *= decay;
+        decay *= 0.995f;
+    }
+    generate_rand_f32(fdInput, FD_LENGTH);
+    memset(fdCoeffs, 0, sizeof(fdCoeffs));
+    /* Echo of the input through the unknown path */
+    for (n = 0; n < FD_LENGTH; n++) {
+        fdRef[n] = 0.0f;
+        for (k = 0; (k < FD_NUM_TAPS) && (k <= n); k++) {
+            fdRef[n] += fdEchoPath[k] * fdInput[n - k];
+        }
+    }
+    riscv_lms_fd_init_f32(&S, FD_NUM_TAPS, fdCoeffs, fdCoeffSpectra, fdState, FD_BLOCK_LEN, 0.5f, 0.9f);
+    BENCH_START(riscv_lms_fd_f32);
+    for (n = 0; n < FD_LENGTH; n += FD_BLOCK_LEN) {
+        riscv_lms_fd_f32(&S, &fdInput[n], &fdRef[n], fdOut, &fdErr[n], FD_BLOCK_LEN);
+    }
+    BENCH_END(riscv_lms_fd_f32);
+    riscv_power_f32(fdErr, FD_NUM_TAPS, &errStart);
+    riscv_power_f32(&fdErr[FD_LENGTH - FD_NUM_TAPS], FD_NUM_TAPS, &errEnd);
+    /* The error power must drop by more than 30 dB once the filter has converged */
+    float atten = 10.0f * log10f(errStart / errEnd);
+
+    if (!(atten > 30.0f)) {
+        BENCH_ERROR(riscv_lms_fd_f32);
+        printf("f32 lms_fd failed with attenuation:%f\n", atten);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_lms_fd_f32);
+}
 
 int main()
 {
@@ -189,6 +241,7 @@ int main()
     riscv_fir_f32_NLMS_lp();
     riscv_fir_q31_NLMS_lp();
     riscv_fir_q15_NLMS_lp();
+    riscv_fir_f32_LMS_FD_lp();
 
     if (test_flag_error) {
         printf("test error apprears, please recheck.\n");
@@ -360,3 +360,66 @@ void ref_fir_decimate_fast_q15(const riscv_fir_decimate_instance_q15 *S,
         i--;
     }
 }
+
+void ref_cic_decimate_q15(const riscv_cic_decimate_instance_q15 *S, q15_t *pSrc,
+                          q15_t *pDst, uint32_t blockSize)
+{
+    uint32_t N = S->numStages;
+    int64_t *integ = (int64_t *)S->pState; /* integrators */
+    int64_t *comb = integ + N;             /* comb delays */
+    uint32_t i, k, n;
+    int64_t acc, prev;
+
+    for (n = 0; n < blockSize; n++) {
+        /* Integrate the new sample through all the stages */
+        acc = pSrc[n];
+        for (k = 0; k < N; k++) {
+            integ[k] += acc;
+            acc = integ[k];
+        }
+
+        if ((n % S->M) == (S->M - 1U)) {
+            /* Differentiate at the output rate */
+            for (k = 0; k < N; k++) {
+                prev = comb[k];
+                comb[k] = acc;
+                acc -= prev;
+            }
+            *pDst++ = ref_sat_q15((q31_t)(acc >> S->postShift));
+        }
+    }
+}
+
+void ref_cic_decimate_pdm_q15(const riscv_cic_decimate_pdm_instance_q15 *S,
+                              uint8_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+    uint32_t N = S->numStages;
+    int32_t *integ = (int32_t *)S->pState; /* integrators */
+    int32_t *comb = integ + N;             /* comb delays */
+    uint32_t k, n;
+    int64_t acc, prev;
+
+    for (n = 0; n < blockSize; n++) {
+        /* Bits are sent MSB first, 1 is +1 and 0 is -1 */
+        acc = ((pSrc[n >> 3] >> (7U - (n & 7U))) & 1U) ? 1 : -1;
+        for (k = 0; k < N; k++) {
+            integ[k] = (int32_t)(integ[k] + acc);
+            acc = integ[k];
+        }
+
+        if ((n % S->M) == (S->M - 1U)) {
+            /* Differentiate at the output rate */
+            for (k = 0; k < N; k++) {
+                prev = comb[k];
+                comb[k] = (int32_t)acc;
+                acc = (int32_t)(acc - prev);
+            }
+            if (S->postShift >= 0) {
+                acc >>= S->postShift;
+            } else {
+                acc *= (int64_t)1 << -S->postShift;
+            }
+            *pDst++ = ref_sat_q15((q31_t)acc);
+        }
+    }
+}
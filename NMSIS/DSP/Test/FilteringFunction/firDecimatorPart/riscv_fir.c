@@ -60,6 +60,41 @@ q15_t testOutput_q15[TEST_LENGTH_SAMPLES / M];
 q15_t testOutput_q15_ref[TEST_LENGTH_SAMPLES / M];
 q15_t firCoeffs32LP_q15[NUM_TAPS];
 
+// half-band
+#define HB_NUM_TAPS 23
+const float32_t hbCoeffs32[HB_NUM_TAPS] = {
+  -0.00231498099f, 0.0f, 0.005412094783f, 0.0f, -0.01586588772f, 0.0f, 0.03854508795f, 0.0f,
+  -0.08925790519f, 0.0f, 0.3123787442f, 0.5f, 0.3123787442f, 0.0f, -0.08925790519f, 0.0f,
+  0.03854508795f, 0.0f, -0.01586588772f, 0.0f, 0.005412094783f, 0.0f, -0.00231498099f};
+float32_t hbStatef32[TEST_LENGTH_SAMPLES / 2 + HB_NUM_TAPS - 1];
+q31_t hbCoeffs32_q31[HB_NUM_TAPS];
+q31_t hbStateq31[TEST_LENGTH_SAMPLES / 2 + HB_NUM_TAPS - 1];
+q15_t hbCoeffs32_q15[HB_NUM_TAPS];
+q15_t hbStateq15[TEST_LENGTH_SAMPLES / 2 + HB_NUM_TAPS - 1];
+
+// CIC
+#define CIC_STAGES 4
+#define CIC_M 16
+#define PDM_M 64
+#define PDM_BYTES TEST_LENGTH_SAMPLES
+q63_t cicState[2 * CIC_STAGES];
+q63_t cicStateRef[2 * CIC_STAGES];
+q31_t pdmState[RISCV_CIC_DECIMATE_PDM_STATE_SIZE(CIC_STAGES)];
+q31_t pdmStateRef[2 * CIC_STAGES];
+uint8_t pdmInput[PDM_BYTES];
+
+// filter chain: biquad, decimator, half-band decimator and gain, processed by tiles
+#define CHAIN_STAGES 4
+#define CHAIN_TILE 48           /* TEST_LENGTH_SAMPLES is not a multiple, the last tile is shorter */
+#define CHAIN_SCRATCH (CHAIN_TILE + CHAIN_TILE / M)
+#define CHAIN_TILES ((TEST_LENGTH_SAMPLES + CHAIN_TILE - 1) / CHAIN_TILE)
+const float32_t chainBiquadCoeffs32[5] = {0.2f, 0.4f, 0.2f, 0.5f, -0.3f};
+float32_t chainBiquadState[4], chainBiquadStateRef[4];
+float32_t chainDecimState[CHAIN_TILE + NUM_TAPS - 1];
+float32_t chainHbState[CHAIN_TILE / M + HB_NUM_TAPS - 1];
+float32_t chainScratch[CHAIN_SCRATCH];
+float32_t chainTmp[TEST_LENGTH_SAMPLES];
+
 //***************************************************************************************
 //				fir Decimator
 //***************************************************************************************
@@ -247,6 +282,372 @@ static void riscv_fir_decimate_fast_q15_lp(void)
 #endif
 }
 
+static void riscv_fir_halfband_decimate_f32_lp(void)
+{
+    riscv_fir_decimate_instance_f32 S_ref;
+    riscv_fir_halfband_decimate_instance_f32 S;
+
+    riscv_fir_halfband_decimate_init_f32(&S, HB_NUM_TAPS, hbCoeffs32, hbStatef32, TEST_LENGTH_SAMPLES / 2);
+    BENCH_START(riscv_fir_halfband_decimate_f32);
+    riscv_fir_halfband_decimate_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, TEST_LENGTH_SAMPLES / 2);
+    riscv_fir_halfband_decimate_f32(&S, testInput_f32_50Hz_200Hz + TEST_LENGTH_SAMPLES / 2, testOutput_f32 + TEST_LENGTH_SAMPLES / 4, TEST_LENGTH_SAMPLES / 2);
+    BENCH_END(riscv_fir_halfband_decimate_f32);
+    riscv_fir_decimate_init_f32(&S_ref, HB_NUM_TAPS, 2, hbCoeffs32, firStatef32, TEST_LENGTH_SAMPLES);
+    ref_fir_decimate_f32(&S_ref, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES / 2);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_halfband_decimate_f32);
+        printf("f32 fir_halfband_decimate failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_halfband_decimate_f32);
+}
+
+static void riscv_fir_halfband_decimate_q31_lp(void)
+{
+    riscv_fir_decimate_instance_q31 S_ref;
+    riscv_fir_halfband_decimate_instance_q31 S;
+
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(hbCoeffs32, hbCoeffs32_q31, HB_NUM_TAPS);
+    riscv_fir_halfband_decimate_init_q31(&S, HB_NUM_TAPS, hbCoeffs32_q31, hbStateq31, TEST_LENGTH_SAMPLES / 2);
+    BENCH_START(riscv_fir_halfband_decimate_q31);
+    riscv_fir_halfband_decimate_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, TEST_LENGTH_SAMPLES / 2);
+    riscv_fir_halfband_decimate_q31(&S, testInput_q31_50Hz_200Hz + TEST_LENGTH_SAMPLES / 2, testOutput_q31 + TEST_LENGTH_SAMPLES / 4, TEST_LENGTH_SAMPLES / 2);
+    BENCH_END(riscv_fir_halfband_decimate_q31);
+    riscv_fir_decimate_init_q31(&S_ref, HB_NUM_TAPS, 2, hbCoeffs32_q31, firStateq31, TEST_LENGTH_SAMPLES);
+    ref_fir_decimate_q31(&S_ref, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES);
+    riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES / 2);
+    riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES / 2);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES / 2);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_halfband_decimate_q31);
+        printf("q31 fir_halfband_decimate failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_halfband_decimate_q31);
+}
+
+static void riscv_fir_halfband_decimate_q15_lp(void)
+{
+    riscv_fir_decimate_instance_q15 S_ref;
+    riscv_fir_halfband_decimate_instance_q15 S;
+
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q15(hbCoeffs32, hbCoeffs32_q15, HB_NUM_TAPS);
+    riscv_fir_halfband_decimate_init_q15(&S, HB_NUM_TAPS, hbCoeffs32_q15, hbStateq15, TEST_LENGTH_SAMPLES / 2);
+    BENCH_START(riscv_fir_halfband_decimate_q15);
+    riscv_fir_halfband_decimate_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15, TEST_LENGTH_SAMPLES / 2);
+    riscv_fir_halfband_decimate_q15(&S, testInput_q15_50Hz_200Hz + TEST_LENGTH_SAMPLES / 2, testOutput_q15 + TEST_LENGTH_SAMPLES / 4, TEST_LENGTH_SAMPLES / 2);
+    BENCH_END(riscv_fir_halfband_decimate_q15);
+    riscv_fir_decimate_init_q15(&S_ref, HB_NUM_TAPS, 2, hbCoeffs32_q15, firStateq15, TEST_LENGTH_SAMPLES);
+    ref_fir_decimate_q15(&S_ref, testInput_q15_50Hz_200Hz, testOutput_q15_ref, TEST_LENGTH_SAMPLES);
+    riscv_q15_to_float(testOutput_q15, testOutput_f32, TEST_LENGTH_SAMPLES / 2);
+    riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES / 2);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES / 2);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_halfband_decimate_q15);
+        printf("q15 fir_halfband_decimate failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_halfband_decimate_q15);
+}
+
+static void riscv_cic_decimate_q15_lp(void)
+{
+    riscv_cic_decimate_instance_q15 S, S_ref;
+
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_cic_decimate_init_q15(&S, CIC_STAGES, CIC_M, cicState, TEST_LENGTH_SAMPLES / 2);
+    BENCH_START(riscv_cic_decimate_q15);
+    riscv_cic_decimate_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15, TEST_LENGTH_SAMPLES / 2);
+    riscv_cic_decimate_q15(&S, testInput_q15_50Hz_200Hz + TEST_LENGTH_SAMPLES / 2, testOutput_q15 + TEST_LENGTH_SAMPLES / (2 * CIC_M), TEST_LENGTH_SAMPLES / 2);
+    BENCH_END(riscv_cic_decimate_q15);
+    riscv_cic_decimate_init_q15(&S_ref, CIC_STAGES, CIC_M, cicStateRef, TEST_LENGTH_SAMPLES);
+    ref_cic_decimate_q15(&S_ref, testInput_q15_50Hz_200Hz, testOutput_q15_ref, TEST_LENGTH_SAMPLES);
+    riscv_q15_to_float(testOutput_q15, testOutput_f32, TEST_LENGTH_SAMPLES / CIC_M);
+    riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES / CIC_M);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES / CIC_M);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_cic_decimate_q15);
+        printf("q15 cic_decimate failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_cic_decimate_q15);
+}
+
+static void riscv_cic_decimate_pdm_q15_lp(void)
+{
+    riscv_cic_decimate_pdm_instance_q15 S, S_ref;
+    uint32_t numBits = 8 * PDM_BYTES;
+
+    generate_rand_q7((q7_t *)pdmInput, PDM_BYTES);
+    riscv_cic_decimate_pdm_init_q15(&S, CIC_STAGES, PDM_M, pdmState, numBits / 2);
+    BENCH_START(riscv_cic_decimate_pdm_q15);
+    riscv_cic_decimate_pdm_q15(&S, pdmInput, testOutput_q15, numBits / 2);
+    riscv_cic_decimate_pdm_q15(&S, pdmInput + PDM_BYTES / 2, testOutput_q15 + numBits / (2 * PDM_M), numBits / 2);
+    BENCH_END(riscv_cic_decimate_pdm_q15);
+    /* The reference only uses the integrators and comb delays of the state */
+    S_ref = S;
+    S_ref.pState = pdmStateRef;
+    memset(pdmStateRef, 0, sizeof(pdmStateRef));
+    ref_cic_decimate_pdm_q15(&S_ref, pdmInput, testOutput_q15_ref, numBits);
+    riscv_q15_to_float(testOutput_q15, testOutput_f32, numBits / PDM_M);
+    riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, numBits / PDM_M);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], numBits / PDM_M);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_cic_decimate_pdm_q15);
+        printf("q15 cic_decimate_pdm failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_cic_decimate_pdm_q15);
+}
+
+/* Library functions take their own instance type, so each stage calls them from a wrapper */
+static void chain_biquad_f32(const void *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+    riscv_biquad_cascade_df1_f32((const riscv_biquad_casd_df1_inst_f32 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_decimate_f32(const void *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+    riscv_fir_decimate_f32((const riscv_fir_decimate_instance_f32 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_halfband_f32(const void *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+    riscv_fir_halfband_decimate_f32((const riscv_fir_halfband_decimate_instance_f32 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_gain_f32(const void *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+    riscv_scale_f32(pSrc, 0.5f, pDst, blockSize);
+}
+
+static void chain_biquad_q31(const void *S, const q31_t *pSrc, q31_t *pDst, uint32_t blockSize)
+{
+    riscv_biquad_cascade_df1_q31((const riscv_biquad_casd_df1_inst_q31 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_decimate_q31(const void *S, const q31_t *pSrc, q31_t *pDst, uint32_t blockSize)
+{
+    riscv_fir_decimate_q31((const riscv_fir_decimate_instance_q31 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_halfband_q31(const void *S, const q31_t *pSrc, q31_t *pDst, uint32_t blockSize)
+{
+    riscv_fir_halfband_decimate_q31((const riscv_fir_halfband_decimate_instance_q31 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_gain_q31(const void *S, const q31_t *pSrc, q31_t *pDst, uint32_t blockSize)
+{
+    riscv_shift_q31(pSrc, -1, pDst, blockSize);
+}
+
+static void chain_biquad_q15(const void *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+    riscv_biquad_cascade_df1_q15((const riscv_biquad_casd_df1_inst_q15 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_decimate_q15(const void *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+    riscv_fir_decimate_q15((const riscv_fir_decimate_instance_q15 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_halfband_q15(const void *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+    riscv_fir_halfband_decimate_q15((const riscv_fir_halfband_decimate_instance_q15 *) S, pSrc, pDst, blockSize);
+}
+
+static void chain_gain_q15(const void *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+    riscv_shift_q15(pSrc, -1, pDst, blockSize);
+}
+
+/* Cycle counter of the chains, advanced by one on each read so that each stage counts its tiles */
+static uint64_t chainCounter;
+
+static uint64_t chain_read_cycle(void)
+{
+    return chainCounter++;
+}
+
+static void riscv_filter_chain_check(const char *name, const uint64_t *pCycles)
+{
+    float snr = riscv_snr_f32(testOutput_f32_ref, testOutput_f32, TEST_LENGTH_SAMPLES / M / 2);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        printf("%s filter_chain failed with snr:%f\n", name, snr);
+        test_flag_error = 1;
+    }
+    for (int i = 0; i < CHAIN_STAGES; i++) {
+        if (pCycles[i] != CHAIN_TILES) {
+            printf("%s filter_chain stage %d counted %lu instead of %d\n", name, i, (unsigned long)pCycles[i], CHAIN_TILES);
+            test_flag_error = 1;
+        }
+    }
+}
+
+static void riscv_filter_chain_f32_lp(void)
+{
+    riscv_biquad_casd_df1_inst_f32 biquad, biquadRef;
+    riscv_fir_decimate_instance_f32 decim, decimRef;
+    riscv_fir_halfband_decimate_instance_f32 hb, hbRef;
+    riscv_filter_chain_instance_f32 S;
+    riscv_filter_chain_stage_f32 stages[CHAIN_STAGES] = {
+        {chain_biquad_f32, &biquad, 1, 1, 0},
+        {chain_decimate_f32, &decim, 1, M, 0},
+        {chain_halfband_f32, &hb, 1, 2, 0},
+        {chain_gain_f32, NULL, 1, 1, 0}
+    };
+    uint64_t cycles[CHAIN_STAGES];
+    riscv_status status;
+
+    generate_rand_f32(testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_biquad_cascade_df1_init_f32(&biquad, 1, chainBiquadCoeffs32, chainBiquadState);
+    riscv_fir_decimate_init_f32(&decim, NUM_TAPS, M, firCoeffs32LP, chainDecimState, CHAIN_TILE);
+    riscv_fir_halfband_decimate_init_f32(&hb, HB_NUM_TAPS, hbCoeffs32, chainHbState, CHAIN_TILE / M);
+    status = riscv_filter_chain_init_f32(&S, stages, CHAIN_STAGES, CHAIN_TILE, chainScratch, CHAIN_SCRATCH, chain_read_cycle);
+    BENCH_START(riscv_filter_chain_f32);
+    riscv_filter_chain_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_filter_chain_f32);
+
+    /* Same filters on the whole block, one after the other */
+    riscv_biquad_cascade_df1_init_f32(&biquadRef, 1, chainBiquadCoeffs32, chainBiquadStateRef);
+    riscv_fir_decimate_init_f32(&decimRef, NUM_TAPS, M, firCoeffs32LP, firStatef32, TEST_LENGTH_SAMPLES);
+    riscv_fir_halfband_decimate_init_f32(&hbRef, HB_NUM_TAPS, hbCoeffs32, hbStatef32, TEST_LENGTH_SAMPLES / M);
+    riscv_biquad_cascade_df1_f32(&biquadRef, testInput_f32_50Hz_200Hz, chainTmp, TEST_LENGTH_SAMPLES);
+    riscv_fir_decimate_f32(&decimRef, chainTmp, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    riscv_fir_halfband_decimate_f32(&hbRef, testOutput_f32_ref, chainTmp, TEST_LENGTH_SAMPLES / M);
+    riscv_scale_f32(chainTmp, 0.5f, testOutput_f32_ref, TEST_LENGTH_SAMPLES / M / 2);
+
+    if (status != RISCV_MATH_SUCCESS) {
+        BENCH_ERROR(riscv_filter_chain_f32);
+        printf("f32 filter_chain init failed, status: %d\n", status);
+        test_flag_error = 1;
+    }
+    for (int i = 0; i < CHAIN_STAGES; i++)
+        cycles[i] = stages[i].cycles;
+    riscv_filter_chain_check("f32", cycles);
+    BENCH_STATUS(riscv_filter_chain_f32);
+}
+
+static void riscv_filter_chain_q31_lp(void)
+{
+    riscv_biquad_casd_df1_inst_q31 biquad, biquadRef;
+    riscv_fir_decimate_instance_q31 decim, decimRef;
+    riscv_fir_halfband_decimate_instance_q31 hb, hbRef;
+    riscv_filter_chain_instance_q31 S;
+    riscv_filter_chain_stage_q31 stages[CHAIN_STAGES] = {
+        {chain_biquad_q31, &biquad, 1, 1, 0},
+        {chain_decimate_q31, &decim, 1, M, 0},
+        {chain_halfband_q31, &hb, 1, 2, 0},
+        {chain_gain_q31, NULL, 1, 1, 0}
+    };
+    uint64_t cycles[CHAIN_STAGES];
+    q31_t biquadCoeffs[5];
+    q31_t *pTmp = (q31_t *) chainTmp;
+    riscv_status status;
+
+    /* Coefficients are halved for the post shift of 1 */
+    riscv_scale_f32(chainBiquadCoeffs32, 0.5f, chainTmp, 5);
+    riscv_float_to_q31(chainTmp, biquadCoeffs, 5);
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(firCoeffs32LP, firCoeffs32LP_q31, NUM_TAPS);
+    riscv_float_to_q31(hbCoeffs32, hbCoeffs32_q31, HB_NUM_TAPS);
+    riscv_biquad_cascade_df1_init_q31(&biquad, 1, biquadCoeffs, (q31_t *) chainBiquadState, 1);
+    riscv_fir_decimate_init_q31(&decim, NUM_TAPS, M, firCoeffs32LP_q31, (q31_t *) chainDecimState, CHAIN_TILE);
+    riscv_fir_halfband_decimate_init_q31(&hb, HB_NUM_TAPS, hbCoeffs32_q31, (q31_t *) chainHbState, CHAIN_TILE / M);
+    status = riscv_filter_chain_init_q31(&S, stages, CHAIN_STAGES, CHAIN_TILE, (q31_t *) chainScratch, CHAIN_SCRATCH, chain_read_cycle);
+    BENCH_START(riscv_filter_chain_q31);
+    riscv_filter_chain_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_filter_chain_q31);
+
+    riscv_biquad_cascade_df1_init_q31(&biquadRef, 1, biquadCoeffs, (q31_t *) chainBiquadStateRef, 1);
+    riscv_fir_decimate_init_q31(&decimRef, NUM_TAPS, M, firCoeffs32LP_q31, firStateq31, TEST_LENGTH_SAMPLES);
+    riscv_fir_halfband_decimate_init_q31(&hbRef, HB_NUM_TAPS, hbCoeffs32_q31, hbStateq31, TEST_LENGTH_SAMPLES / M);
+    riscv_biquad_cascade_df1_q31(&biquadRef, testInput_q31_50Hz_200Hz, pTmp, TEST_LENGTH_SAMPLES);
+    riscv_fir_decimate_q31(&decimRef, pTmp, testOutput_q31_ref, TEST_LENGTH_SAMPLES);
+    riscv_fir_halfband_decimate_q31(&hbRef, testOutput_q31_ref, pTmp, TEST_LENGTH_SAMPLES / M);
+    riscv_shift_q31(pTmp, -1, testOutput_q31_ref, TEST_LENGTH_SAMPLES / M / 2);
+
+    if (status != RISCV_MATH_SUCCESS) {
+        BENCH_ERROR(riscv_filter_chain_q31);
+        printf("q31 filter_chain init failed, status: %d\n", status);
+        test_flag_error = 1;
+    }
+    riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES / M / 2);
+    riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES / M / 2);
+    for (int i = 0; i < CHAIN_STAGES; i++)
+        cycles[i] = stages[i].cycles;
+    riscv_filter_chain_check("q31", cycles);
+    BENCH_STATUS(riscv_filter_chain_q31);
+}
+
+static void riscv_filter_chain_q15_lp(void)
+{
+    riscv_biquad_casd_df1_inst_q15 biquad, biquadRef;
+    riscv_fir_decimate_instance_q15 decim, decimRef;
+    riscv_fir_halfband_decimate_instance_q15 hb, hbRef;
+    riscv_filter_chain_instance_q15 S;
+    riscv_filter_chain_stage_q15 stages[CHAIN_STAGES] = {
+        {chain_biquad_q15, &biquad, 1, 1, 0},
+        {chain_decimate_q15, &decim, 1, M, 0},
+        {chain_halfband_q15, &hb, 1, 2, 0},
+        {chain_gain_q15, NULL, 1, 1, 0}
+    };
+    uint64_t cycles[CHAIN_STAGES];
+    q15_t coeffs[5];
+    q15_t biquadCoeffs[6];
+    q15_t *pTmp = (q15_t *) chainTmp;
+    riscv_status status;
+
+    /* Coefficients are halved for the post shift of 1, with the q15 layout {b0, 0, b1, b2, a1, a2} */
+    riscv_scale_f32(chainBiquadCoeffs32, 0.5f, chainTmp, 5);
+    riscv_float_to_q15(chainTmp, coeffs, 5);
+    biquadCoeffs[0] = coeffs[0];
+    biquadCoeffs[1] = 0;
+    biquadCoeffs[2] = coeffs[1];
+    biquadCoeffs[3] = coeffs[2];
+    biquadCoeffs[4] = coeffs[3];
+    biquadCoeffs[5] = coeffs[4];
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q15(firCoeffs32LP, firCoeffs32LP_q15, NUM_TAPS);
+    riscv_float_to_q15(hbCoeffs32, hbCoeffs32_q15, HB_NUM_TAPS);
+    riscv_biquad_cascade_df1_init_q15(&biquad, 1, biquadCoeffs, (q15_t *) chainBiquadState, 1);
+    riscv_fir_decimate_init_q15(&decim, NUM_TAPS, M, firCoeffs32LP_q15, (q15_t *) chainDecimState, CHAIN_TILE);
+    riscv_fir_halfband_decimate_init_q15(&hb, HB_NUM_TAPS, hbCoeffs32_q15, (q15_t *) chainHbState, CHAIN_TILE / M);
+    status = riscv_filter_chain_init_q15(&S, stages, CHAIN_STAGES, CHAIN_TILE, (q15_t *) chainScratch, CHAIN_SCRATCH, chain_read_cycle);
+    BENCH_START(riscv_filter_chain_q15);
+    riscv_filter_chain_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_filter_chain_q15);
+
+    riscv_biquad_cascade_df1_init_q15(&biquadRef, 1, biquadCoeffs, (q15_t *) chainBiquadStateRef, 1);
+    riscv_fir_decimate_init_q15(&decimRef, NUM_TAPS, M, firCoeffs32LP_q15, firStateq15, TEST_LENGTH_SAMPLES);
+    riscv_fir_halfband_decimate_init_q15(&hbRef, HB_NUM_TAPS, hbCoeffs32_q15, hbStateq15, TEST_LENGTH_SAMPLES / M);
+    riscv_biquad_cascade_df1_q15(&biquadRef, testInput_q15_50Hz_200Hz, pTmp, TEST_LENGTH_SAMPLES);
+    riscv_fir_decimate_q15(&decimRef, pTmp, testOutput_q15_ref, TEST_LENGTH_SAMPLES);
+    riscv_fir_halfband_decimate_q15(&hbRef, testOutput_q15_ref, pTmp, TEST_LENGTH_SAMPLES / M);
+    riscv_shift_q15(pTmp, -1, testOutput_q15_ref, TEST_LENGTH_SAMPLES / M / 2);
+
+    if (status != RISCV_MATH_SUCCESS) {
+        BENCH_ERROR(riscv_filter_chain_q15);
+        printf("q15 filter_chain init failed, status: %d\n", status);
+        test_flag_error = 1;
+    }
+    riscv_q15_to_float(testOutput_q15, testOutput_f32, TEST_LENGTH_SAMPLES / M / 2);
+    riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES / M / 2);
+    for (int i = 0; i < CHAIN_STAGES; i++)
+        cycles[i] = stages[i].cycles;
+    riscv_filter_chain_check("q15", cycles);
+    BENCH_STATUS(riscv_filter_chain_q15);
+}
+
 int main()
 {
     BENCH_INIT();
@@ -256,6 +657,14 @@ int main()
     riscv_fir_decimate_q15_lp();
     riscv_fir_decimate_fast_q31_lp();
     riscv_fir_decimate_fast_q15_lp();
+    riscv_fir_halfband_decimate_f32_lp();
+    riscv_fir_halfband_decimate_q31_lp();
+    riscv_fir_halfband_decimate_q15_lp();
+    riscv_cic_decimate_q15_lp();
+    riscv_cic_decimate_pdm_q15_lp();
+    riscv_filter_chain_f32_lp();
+    riscv_filter_chain_q31_lp();
+    riscv_filter_chain_q15_lp();
 
     if (test_flag_error) {
         printf("test error apprears, please recheck.\n");
@@ -60,6 +60,14 @@ q15_t testOutput_q15[TEST_LENGTH_SAMPLES * L];
 q15_t testOutput_q15_ref[TEST_LENGTH_SAMPLES * L];
 q15_t firCoeffs32LP_q15[NUM_TAPS];
 
+// rational resampler
+#define RESAMPLE_M       3      /* downsample factor */
+#define RESAMPLE_BLOCK   64     /* largest number of input samples per call */
+const uint32_t resampleChunks[] = {64, 17, 50, 1, 33};
+float32_t resampleStatef32[RESAMPLE_BLOCK + NUM_TAPS / L - 1];
+q31_t resampleStateq31[RESAMPLE_BLOCK + NUM_TAPS / L - 1];
+q15_t resampleStateq15[RESAMPLE_BLOCK + NUM_TAPS / L - 1];
+
 //***************************************************************************************
 //				fir Interpolator
 //***************************************************************************************
@@ -174,6 +182,134 @@ static void riscv_fir_interpolate_q15_lp(void)
 #endif
 }
 
+static void riscv_fir_resample_f32_lp(void)
+{
+    uint32_t i, blockSize, outCnt = 0, chunk = 0;
+    /* clang-format off */
+    riscv_fir_resample_instance_f32 S;
+    riscv_fir_interpolate_instance_f32 S_ref;
+    /* clang-format on */
+    riscv_fir_resample_init_f32(&S, L, RESAMPLE_M, NUM_TAPS, firCoeffs32LP,
+                              resampleStatef32, RESAMPLE_BLOCK);
+    BENCH_START(riscv_fir_resample_f32);
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i += blockSize) {
+        blockSize = resampleChunks[chunk++ % (sizeof(resampleChunks) / sizeof(resampleChunks[0]))];
+        blockSize = (blockSize < TEST_LENGTH_SAMPLES - i) ? blockSize : TEST_LENGTH_SAMPLES - i;
+        outCnt += riscv_fir_resample_f32(&S, &testInput_f32_50Hz_200Hz[i], &testOutput_f32[outCnt], blockSize);
+    }
+    BENCH_END(riscv_fir_resample_f32);
+
+    /* Interpolation followed by keeping one sample out of RESAMPLE_M */
+    riscv_fir_interpolate_init_f32(&S_ref, L, NUM_TAPS, firCoeffs32LP,
+                                 firStatef32, TEST_LENGTH_SAMPLES);
+    ref_fir_interpolate_f32(&S_ref, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    for (i = 0; i < TEST_LENGTH_SAMPLES * L / RESAMPLE_M; i++) {
+        testOutput_f32_ref[i] = testOutput_f32_ref[i * RESAMPLE_M + RESAMPLE_M - 1];
+    }
+    if (outCnt != TEST_LENGTH_SAMPLES * L / RESAMPLE_M) {
+        BENCH_ERROR(riscv_fir_resample_f32);
+        printf("f32 fir_resample failed with %d outputs\n", (int)outCnt);
+        test_flag_error = 1;
+        return;
+    }
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], outCnt);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_resample_f32);
+        printf("f32 fir_resample failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_resample_f32);
+}
+
+static void riscv_fir_resample_q31_lp(void)
+{
+    uint32_t i, blockSize, outCnt = 0, chunk = 0;
+    /* clang-format off */
+    riscv_fir_resample_instance_q31 S;
+    riscv_fir_interpolate_instance_q31 S_ref;
+    /* clang-format on */
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(firCoeffs32LP, firCoeffs32LP_q31, NUM_TAPS);
+    riscv_fir_resample_init_q31(&S, L, RESAMPLE_M, NUM_TAPS, firCoeffs32LP_q31,
+                              resampleStateq31, RESAMPLE_BLOCK);
+    BENCH_START(riscv_fir_resample_q31);
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i += blockSize) {
+        blockSize = resampleChunks[chunk++ % (sizeof(resampleChunks) / sizeof(resampleChunks[0]))];
+        blockSize = (blockSize < TEST_LENGTH_SAMPLES - i) ? blockSize : TEST_LENGTH_SAMPLES - i;
+        outCnt += riscv_fir_resample_q31(&S, &testInput_q31_50Hz_200Hz[i], &testOutput_q31[outCnt], blockSize);
+    }
+    BENCH_END(riscv_fir_resample_q31);
+
+    /* Interpolation followed by keeping one sample out of RESAMPLE_M */
+    riscv_fir_interpolate_init_q31(&S_ref, L, NUM_TAPS, firCoeffs32LP_q31,
+                                 firStateq31, TEST_LENGTH_SAMPLES);
+    ref_fir_interpolate_q31(&S_ref, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES);
+    for (i = 0; i < TEST_LENGTH_SAMPLES * L / RESAMPLE_M; i++) {
+        testOutput_q31_ref[i] = testOutput_q31_ref[i * RESAMPLE_M + RESAMPLE_M - 1];
+    }
+    if (outCnt != TEST_LENGTH_SAMPLES * L / RESAMPLE_M) {
+        BENCH_ERROR(riscv_fir_resample_q31);
+        printf("q31 fir_resample failed with %d outputs\n", (int)outCnt);
+        test_flag_error = 1;
+        return;
+    }
+    riscv_q31_to_float(testOutput_q31, testOutput_f32, outCnt);
+    riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, outCnt);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], outCnt);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_resample_q31);
+        printf("q31 fir_resample failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_resample_q31);
+}
+
+static void riscv_fir_resample_q15_lp(void)
+{
+    uint32_t i, blockSize, outCnt = 0, chunk = 0;
+    /* clang-format off */
+    riscv_fir_resample_instance_q15 S;
+    riscv_fir_interpolate_instance_q15 S_ref;
+    /* clang-format on */
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q15(firCoeffs32LP, firCoeffs32LP_q15, NUM_TAPS);
+    riscv_fir_resample_init_q15(&S, L, RESAMPLE_M, NUM_TAPS, firCoeffs32LP_q15,
+                              resampleStateq15, RESAMPLE_BLOCK);
+    BENCH_START(riscv_fir_resample_q15);
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i += blockSize) {
+        blockSize = resampleChunks[chunk++ % (sizeof(resampleChunks) / sizeof(resampleChunks[0]))];
+        blockSize = (blockSize < TEST_LENGTH_SAMPLES - i) ? blockSize : TEST_LENGTH_SAMPLES - i;
+        outCnt += riscv_fir_resample_q15(&S, &testInput_q15_50Hz_200Hz[i], &testOutput_q15[outCnt], blockSize);
+    }
+    BENCH_END(riscv_fir_resample_q15);
+
+    /* Interpolation followed by keeping one sample out of RESAMPLE_M */
+    riscv_fir_interpolate_init_q15(&S_ref, L, NUM_TAPS, firCoeffs32LP_q15,
+                                 firStateq15, TEST_LENGTH_SAMPLES);
+    ref_fir_interpolate_q15(&S_ref, testInput_q15_50Hz_200Hz, testOutput_q15_ref, TEST_LENGTH_SAMPLES);
+    for (i = 0; i < TEST_LENGTH_SAMPLES * L / RESAMPLE_M; i++) {
+        testOutput_q15_ref[i] = testOutput_q15_ref[i * RESAMPLE_M + RESAMPLE_M - 1];
+    }
+    if (outCnt != TEST_LENGTH_SAMPLES * L / RESAMPLE_M) {
+        BENCH_ERROR(riscv_fir_resample_q15);
+        printf("q15 fir_resample failed with %d outputs\n", (int)outCnt);
+        test_flag_error = 1;
+        return;
+    }
+    riscv_q15_to_float(testOutput_q15, testOutput_f32, outCnt);
+    riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, outCnt);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], outCnt);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_resample_q15);
+        printf("q15 fir_resample failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_resample_q15);
+}
+
 int main()
 {
     BENCH_INIT();
@@ -181,6 +317,9 @@ int main()
     riscv_fir_interpolate_f32_lp();
     riscv_fir_interpolate_q31_lp();
     riscv_fir_interpolate_q15_lp();
+    riscv_fir_resample_f32_lp();
+    riscv_fir_resample_q31_lp();
+    riscv_fir_resample_q15_lp();
 
     if (test_flag_error) {
         printf("test error apprears, please recheck.\n");
@@ -57,6 +57,13 @@ q15_t testOutput_q15[TEST_LENGTH_SAMPLES];
 q15_t testOutput_q15_ref[TEST_LENGTH_SAMPLES];
 q15_t firCoeffs32LP_q15[NUM_TAPS];
 
+// lattice orders of speech codecs
+#define LATTICE_MAX_ORDER 32
+const uint16_t latticeOrders[] = {10, 16, 32};
+float32_t latticeCoeffs_f32[LATTICE_MAX_ORDER];
+q31_t latticeCoeffs_q31[LATTICE_MAX_ORDER];
+q15_t latticeCoeffs_q15[LATTICE_MAX_ORDER];
+
 //***************************************************************************************
 //				fir Lattice Filters
 //***************************************************************************************
@@ -164,12 +171,109 @@ static void riscv_fir_lattice_q15_lp(void)
 #endif
 }
 
+static void riscv_fir_lattice_f32_orders_lp(void)
+{
+    uint32_t i;
+    uint16_t order;
+    /* clang-format off */
+    riscv_fir_lattice_instance_f32 S;
+    /* clang-format on */
+    /* Small input and reflection coefficients decreasing with the stage keep the fixed-point versions in range */
+    generate_rand_f32(testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_scale_f32(testInput_f32_50Hz_200Hz, 0.125f, testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    generate_rand_f32(latticeCoeffs_f32, LATTICE_MAX_ORDER);
+    for (i = 0; i < LATTICE_MAX_ORDER; i++) {
+        latticeCoeffs_f32[i] /= (float32_t)(i + 1);
+    }
+    for (i = 0; i < sizeof(latticeOrders) / sizeof(latticeOrders[0]); i++) {
+        order = latticeOrders[i];
+        printf("f32 fir_lattice order %d\n", order);
+        riscv_fir_lattice_init_f32(&S, order, latticeCoeffs_f32, firStatef32);
+        BENCH_START(riscv_fir_lattice_f32);
+        riscv_fir_lattice_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, TEST_LENGTH_SAMPLES);
+        BENCH_END(riscv_fir_lattice_f32);
+        riscv_fir_lattice_init_f32(&S, order, latticeCoeffs_f32, firStatef32);
+        ref_fir_lattice_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_fir_lattice_f32);
+            printf("f32 fir_lattice order %d failed with snr:%f\n", order, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_fir_lattice_f32);
+    }
+}
+static void riscv_fir_lattice_q31_orders_lp(void)
+{
+    uint32_t i;
+    uint16_t order;
+    /* clang-format off */
+    riscv_fir_lattice_instance_q31 S;
+    /* clang-format on */
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(latticeCoeffs_f32, latticeCoeffs_q31, LATTICE_MAX_ORDER);
+    for (i = 0; i < sizeof(latticeOrders) / sizeof(latticeOrders[0]); i++) {
+        order = latticeOrders[i];
+        printf("q31 fir_lattice order %d\n", order);
+        riscv_fir_lattice_init_q31(&S, order, latticeCoeffs_q31, firStateq31);
+        BENCH_START(riscv_fir_lattice_q31);
+        riscv_fir_lattice_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, TEST_LENGTH_SAMPLES);
+        BENCH_END(riscv_fir_lattice_q31);
+        riscv_fir_lattice_init_q31(&S, order, latticeCoeffs_q31, firStateq31);
+        ref_fir_lattice_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES);
+        riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_fir_lattice_q31);
+            printf("q31 fir_lattice order %d failed with snr:%f\n", order, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_fir_lattice_q31);
+    }
+}
+static void riscv_fir_lattice_q15_orders_lp(void)
+{
+    uint32_t i;
+    uint16_t order;
+    /* clang-format off */
+    riscv_fir_lattice_instance_q15 S;
+    /* clang-format on */
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q15(latticeCoeffs_f32, latticeCoeffs_q15, LATTICE_MAX_ORDER);
+    for (i = 0; i < sizeof(latticeOrders) / sizeof(latticeOrders[0]); i++) {
+        order = latticeOrders[i];
+        printf("q15 fir_lattice order %d\n", order);
+        riscv_fir_lattice_init_q15(&S, order, latticeCoeffs_q15, firStateq15);
+        BENCH_START(riscv_fir_lattice_q15);
+        riscv_fir_lattice_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15, TEST_LENGTH_SAMPLES);
+        BENCH_END(riscv_fir_lattice_q15);
+        riscv_fir_lattice_init_q15(&S, order, latticeCoeffs_q15, firStateq15);
+        ref_fir_lattice_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15_ref, TEST_LENGTH_SAMPLES);
+        riscv_q15_to_float(testOutput_q15, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_fir_lattice_q15);
+            printf("q15 fir_lattice order %d failed with snr:%f\n", order, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_fir_lattice_q15);
+    }
+}
+
 int main()
 {
     BENCH_INIT();
     riscv_fir_lattice_f32_lp();
     riscv_fir_lattice_q31_lp();
     riscv_fir_lattice_q15_lp();
+    riscv_fir_lattice_f32_orders_lp();
+    riscv_fir_lattice_q31_orders_lp();
+    riscv_fir_lattice_q15_orders_lp();
 
     if (test_flag_error) {
         printf("test error apprears, please recheck.\n");
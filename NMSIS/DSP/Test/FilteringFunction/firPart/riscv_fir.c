@@ -73,6 +73,31 @@ q7_t testOutput_q7[TEST_LENGTH_SAMPLES];
 q7_t testOutput_q7_ref[TEST_LENGTH_SAMPLES];
 q7_t firCoeffs32LP_q7[NUM_TAPS] = {0};
 
+// partitioned
+#define PART_BLOCK_LEN 32
+/* Call sizes not aligned on the partitions, adding up to TEST_LENGTH_SAMPLES */
+#define PART_CHUNKS 6
+const uint32_t firPartChunks[PART_CHUNKS] = {7, 32, 45, 1, 100, 135};
+float32_t firPartCoeffSpectra[RISCV_FIR_PARTITIONED_COEFFS_SIZE_F32(NUM_TAPS, PART_BLOCK_LEN)];
+float32_t firPartState[RISCV_FIR_PARTITIONED_STATE_SIZE_F32(NUM_TAPS, PART_BLOCK_LEN)];
+
+// multi-channel
+#define MULTI_CHANNELS 8
+#define MULTI_BLOCK (TEST_LENGTH_SAMPLES / MULTI_CHANNELS)
+float32_t firMultiStatef32[(NUM_TAPS + MULTI_BLOCK - 1) * MULTI_CHANNELS];
+float32_t firMultiChan_f32[2 * MULTI_BLOCK];
+q31_t firMultiStateq31[(NUM_TAPS + MULTI_BLOCK - 1) * MULTI_CHANNELS];
+q31_t firMultiChan_q31[2 * MULTI_BLOCK];
+q15_t firMultiStateq15[(NUM_TAPS + MULTI_BLOCK - 1) * MULTI_CHANNELS];
+q15_t firMultiChan_q15[2 * MULTI_BLOCK];
+
+// circular state
+#define CIRC_BLOCK 12           /* small blocks, TEST_LENGTH_SAMPLES is not a multiple */
+float32_t firCircStatef32[RISCV_FIR_CIRC_STATE_SIZE(NUM_TAPS, CIRC_BLOCK)];
+q31_t firCircStateq31[RISCV_FIR_CIRC_STATE_SIZE(NUM_TAPS, CIRC_BLOCK)];
+q15_t firCircStateq15[RISCV_FIR_CIRC_STATE_SIZE(NUM_TAPS, CIRC_BLOCK)];
+q7_t firCircStateq7[RISCV_FIR_CIRC_STATE_SIZE(NUM_TAPS, CIRC_BLOCK)];
+
 /* clang-format on */
 //***************************************************************************************
 //				fir
@@ -326,6 +351,305 @@ static int riscv_fir_fast_q15_lp(void)
 #endif
 }
 
+static int riscv_fir_partitioned_f32_lp(void)
+{
+    riscv_fir_instance_f32 S_ref;
+    riscv_fir_partitioned_instance_f32 S;
+
+    generate_rand_f32(testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_fir_partitioned_init_f32(&S, NUM_TAPS, firCoeffs32LP, firPartCoeffSpectra, firPartState, PART_BLOCK_LEN);
+    BENCH_START(riscv_fir_partitioned_f32);
+    riscv_fir_partitioned_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_fir_partitioned_f32);
+    riscv_fir_init_f32(&S_ref, NUM_TAPS, firCoeffs32LP, firStatef32, TEST_LENGTH_SAMPLES);
+    ref_fir_f32(&S_ref, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_partitioned_f32);
+        printf("f32 fir_partitioned failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+
+    /* Same input split in blocks ending inside the partitions */
+    riscv_fir_partitioned_init_f32(&S, NUM_TAPS, firCoeffs32LP, firPartCoeffSpectra, firPartState, PART_BLOCK_LEN);
+    for (uint32_t i = 0, n = 0; i < PART_CHUNKS; n += firPartChunks[i++])
+        riscv_fir_partitioned_f32(&S, testInput_f32_50Hz_200Hz + n, testOutput_f32 + n, firPartChunks[i]);
+    snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_partitioned_f32);
+        printf("f32 fir_partitioned unaligned blocks failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_partitioned_f32);
+}
+
+static int riscv_fir_partitioned_q31_lp(void)
+{
+    riscv_fir_instance_q31 S_ref;
+    riscv_fir_partitioned_instance_q31 S;
+
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(firCoeffs32LP, firCoeffs32LP_q31, NUM_TAPS);
+    riscv_fir_partitioned_init_q31(&S, NUM_TAPS, firCoeffs32LP_q31, firPartCoeffSpectra, firPartState, PART_BLOCK_LEN);
+    BENCH_START(riscv_fir_partitioned_q31);
+    riscv_fir_partitioned_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_fir_partitioned_q31);
+    riscv_fir_init_q31(&S_ref, NUM_TAPS, firCoeffs32LP_q31, firStateq31, TEST_LENGTH_SAMPLES);
+    ref_fir_q31(&S_ref, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES);
+    riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+    riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_partitioned_q31);
+        printf("q31 fir_partitioned failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+
+    /* Same input split in blocks ending inside the partitions */
+    riscv_fir_partitioned_init_q31(&S, NUM_TAPS, firCoeffs32LP_q31, firPartCoeffSpectra, firPartState, PART_BLOCK_LEN);
+    for (uint32_t i = 0, n = 0; i < PART_CHUNKS; n += firPartChunks[i++])
+        riscv_fir_partitioned_q31(&S, testInput_q31_50Hz_200Hz + n, testOutput_q31 + n, firPartChunks[i]);
+    riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+    snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_partitioned_q31);
+        printf("q31 fir_partitioned unaligned blocks failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_partitioned_q31);
+}
+
+static int riscv_fir_multi_f32_lp(void)
+{
+    uint32_t ch, n, layout;
+    uint32_t chanStride, sampleStride;
+    riscv_fir_instance_f32 S_ref;
+    riscv_fir_multi_instance_f32 S;
+
+    generate_rand_f32(testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    for (layout = RISCV_MULTICHANNEL_INTERLEAVED; layout <= RISCV_MULTICHANNEL_PLANAR; layout++) {
+        chanStride = (layout == RISCV_MULTICHANNEL_INTERLEAVED) ? 1 : MULTI_BLOCK;
+        sampleStride = (layout == RISCV_MULTICHANNEL_INTERLEAVED) ? MULTI_CHANNELS : 1;
+        riscv_fir_multi_init_f32(&S, NUM_TAPS, MULTI_CHANNELS, (riscv_multichannel_layout)layout, firCoeffs32LP, firMultiStatef32, MULTI_BLOCK);
+        BENCH_START(riscv_fir_multi_f32);
+        riscv_fir_multi_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, MULTI_BLOCK);
+        BENCH_END(riscv_fir_multi_f32);
+        for (ch = 0; ch < MULTI_CHANNELS; ch++) {
+            for (n = 0; n < MULTI_BLOCK; n++) {
+                firMultiChan_f32[n] = testInput_f32_50Hz_200Hz[n * sampleStride + ch * chanStride];
+            }
+            riscv_fir_init_f32(&S_ref, NUM_TAPS, firCoeffs32LP, firStatef32, MULTI_BLOCK);
+            ref_fir_f32(&S_ref, firMultiChan_f32, &firMultiChan_f32[MULTI_BLOCK], MULTI_BLOCK);
+            for (n = 0; n < MULTI_BLOCK; n++) {
+                testOutput_f32_ref[n * sampleStride + ch * chanStride] = firMultiChan_f32[MULTI_BLOCK + n];
+            }
+        }
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_fir_multi_f32);
+            printf("f32 fir_multi layout %d failed with snr:%f\n", (int)layout, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_fir_multi_f32);
+    }
+}
+
+static int riscv_fir_multi_q31_lp(void)
+{
+    uint32_t ch, n, layout;
+    uint32_t chanStride, sampleStride;
+    riscv_fir_instance_q31 S_ref;
+    riscv_fir_multi_instance_q31 S;
+
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(firCoeffs32LP, firCoeffs32LP_q31, NUM_TAPS);
+    for (layout = RISCV_MULTICHANNEL_INTERLEAVED; layout <= RISCV_MULTICHANNEL_PLANAR; layout++) {
+        chanStride = (layout == RISCV_MULTICHANNEL_INTERLEAVED) ? 1 : MULTI_BLOCK;
+        sampleStride = (layout == RISCV_MULTICHANNEL_INTERLEAVED) ? MULTI_CHANNELS : 1;
+        riscv_fir_multi_init_q31(&S, NUM_TAPS, MULTI_CHANNELS, (riscv_multichannel_layout)layout, firCoeffs32LP_q31, firMultiStateq31, MULTI_BLOCK);
+        BENCH_START(riscv_fir_multi_q31);
+        riscv_fir_multi_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, MULTI_BLOCK);
+        BENCH_END(riscv_fir_multi_q31);
+        for (ch = 0; ch < MULTI_CHANNELS; ch++) {
+            for (n = 0; n < MULTI_BLOCK; n++) {
+                firMultiChan_q31[n] = testInput_q31_50Hz_200Hz[n * sampleStride + ch * chanStride];
+            }
+            riscv_fir_init_q31(&S_ref, NUM_TAPS, firCoeffs32LP_q31, firStateq31, MULTI_BLOCK);
+            ref_fir_q31(&S_ref, firMultiChan_q31, &firMultiChan_q31[MULTI_BLOCK], MULTI_BLOCK);
+            for (n = 0; n < MULTI_BLOCK; n++) {
+                testOutput_q31_ref[n * sampleStride + ch * chanStride] = firMultiChan_q31[MULTI_BLOCK + n];
+            }
+        }
+        riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_fir_multi_q31);
+            printf("q31 fir_multi layout %d failed with snr:%f\n", (int)layout, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_fir_multi_q31);
+    }
+}
+
+static int riscv_fir_multi_q15_lp(void)
+{
+    uint32_t ch, n, layout;
+    uint32_t chanStride, sampleStride;
+    riscv_fir_instance_q15 S_ref;
+    riscv_fir_multi_instance_q15 S;
+
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q15(firCoeffs32LP, firCoeffs32LP_q15, NUM_TAPS);
+    for (layout = RISCV_MULTICHANNEL_INTERLEAVED; layout <= RISCV_MULTICHANNEL_PLANAR; layout++) {
+        chanStride = (layout == RISCV_MULTICHANNEL_INTERLEAVED) ? 1 : MULTI_BLOCK;
+        sampleStride = (layout == RISCV_MULTICHANNEL_INTERLEAVED) ? MULTI_CHANNELS : 1;
+        riscv_fir_multi_init_q15(&S, NUM_TAPS, MULTI_CHANNELS, (riscv_multichannel_layout)layout, firCoeffs32LP_q15, firMultiStateq15, MULTI_BLOCK);
+        BENCH_START(riscv_fir_multi_q15);
+        riscv_fir_multi_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15, MULTI_BLOCK);
+        BENCH_END(riscv_fir_multi_q15);
+        for (ch = 0; ch < MULTI_CHANNELS; ch++) {
+            for (n = 0; n < MULTI_BLOCK; n++) {
+                firMultiChan_q15[n] = testInput_q15_50Hz_200Hz[n * sampleStride + ch * chanStride];
+            }
+            riscv_fir_init_q15(&S_ref, NUM_TAPS, firCoeffs32LP_q15, firStateq15, MULTI_BLOCK);
+            ref_fir_q15(&S_ref, firMultiChan_q15, &firMultiChan_q15[MULTI_BLOCK], MULTI_BLOCK);
+            for (n = 0; n < MULTI_BLOCK; n++) {
+                testOutput_q15_ref[n * sampleStride + ch * chanStride] = firMultiChan_q15[MULTI_BLOCK + n];
+            }
+        }
+        riscv_q15_to_float(testOutput_q15, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_fir_multi_q15);
+            printf("q15 fir_multi layout %d failed with snr:%f\n", (int)layout, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_fir_multi_q15);
+    }
+}
+
+static int riscv_fir_circ_f32_lp(void)
+{
+    uint32_t i, blockSize;
+    riscv_fir_instance_f32 S_ref;
+    riscv_fir_circ_instance_f32 S;
+
+    generate_rand_f32(testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_fir_circ_init_f32(&S, NUM_TAPS, firCoeffs32LP, firCircStatef32, CIRC_BLOCK);
+    BENCH_START(riscv_fir_circ_f32);
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i += blockSize) {
+        blockSize = (TEST_LENGTH_SAMPLES - i < CIRC_BLOCK) ? TEST_LENGTH_SAMPLES - i : CIRC_BLOCK;
+        riscv_fir_circ_f32(&S, &testInput_f32_50Hz_200Hz[i], &testOutput_f32[i], blockSize);
+    }
+    BENCH_END(riscv_fir_circ_f32);
+    riscv_fir_init_f32(&S_ref, NUM_TAPS, firCoeffs32LP, firStatef32, TEST_LENGTH_SAMPLES);
+    ref_fir_f32(&S_ref, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_circ_f32);
+        printf("f32 fir_circ failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_circ_f32);
+}
+
+static int riscv_fir_circ_q31_lp(void)
+{
+    uint32_t i, blockSize;
+    riscv_fir_instance_q31 S_ref;
+    riscv_fir_circ_instance_q31 S;
+
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(firCoeffs32LP, firCoeffs32LP_q31, NUM_TAPS);
+    riscv_fir_circ_init_q31(&S, NUM_TAPS, firCoeffs32LP_q31, firCircStateq31, CIRC_BLOCK);
+    BENCH_START(riscv_fir_circ_q31);
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i += blockSize) {
+        blockSize = (TEST_LENGTH_SAMPLES - i < CIRC_BLOCK) ? TEST_LENGTH_SAMPLES - i : CIRC_BLOCK;
+        riscv_fir_circ_q31(&S, &testInput_q31_50Hz_200Hz[i], &testOutput_q31[i], blockSize);
+    }
+    BENCH_END(riscv_fir_circ_q31);
+    riscv_fir_init_q31(&S_ref, NUM_TAPS, firCoeffs32LP_q31, firStateq31, TEST_LENGTH_SAMPLES);
+    ref_fir_q31(&S_ref, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES);
+    riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+    riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_circ_q31);
+        printf("q31 fir_circ failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_circ_q31);
+}
+
+static int riscv_fir_circ_q15_lp(void)
+{
+    uint32_t i, blockSize;
+    riscv_fir_instance_q15 S_ref;
+    riscv_fir_circ_instance_q15 S;
+
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q15(firCoeffs32LP, firCoeffs32LP_q15, NUM_TAPS);
+    riscv_fir_circ_init_q15(&S, NUM_TAPS, firCoeffs32LP_q15, firCircStateq15, CIRC_BLOCK);
+    BENCH_START(riscv_fir_circ_q15);
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i += blockSize) {
+        blockSize = (TEST_LENGTH_SAMPLES - i < CIRC_BLOCK) ? TEST_LENGTH_SAMPLES - i : CIRC_BLOCK;
+        riscv_fir_circ_q15(&S, &testInput_q15_50Hz_200Hz[i], &testOutput_q15[i], blockSize);
+    }
+    BENCH_END(riscv_fir_circ_q15);
+    riscv_fir_init_q15(&S_ref, NUM_TAPS, firCoeffs32LP_q15, firStateq15, TEST_LENGTH_SAMPLES);
+    ref_fir_q15(&S_ref, testInput_q15_50Hz_200Hz, testOutput_q15_ref, TEST_LENGTH_SAMPLES);
+    riscv_q15_to_float(testOutput_q15, testOutput_f32, TEST_LENGTH_SAMPLES);
+    riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_circ_q15);
+        printf("q15 fir_circ failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_circ_q15);
+}
+
+static int riscv_fir_circ_q7_lp(void)
+{
+    uint32_t i, blockSize;
+    riscv_fir_instance_q7 S_ref;
+    riscv_fir_circ_instance_q7 S;
+
+    riscv_float_to_q7(testInput_f32_50Hz_200Hz, testInput_q7_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q7(firCoeffs32LP, firCoeffs32LP_q7, NUM_TAPS);
+    riscv_fir_circ_init_q7(&S, NUM_TAPS, firCoeffs32LP_q7, firCircStateq7, CIRC_BLOCK);
+    BENCH_START(riscv_fir_circ_q7);
+    for (i = 0; i < TEST_LENGTH_SAMPLES; i += blockSize) {
+        blockSize = (TEST_LENGTH_SAMPLES - i < CIRC_BLOCK) ? TEST_LENGTH_SAMPLES - i : CIRC_BLOCK;
+        riscv_fir_circ_q7(&S, &testInput_q7_50Hz_200Hz[i], &testOutput_q7[i], blockSize);
+    }
+    BENCH_END(riscv_fir_circ_q7);
+    riscv_fir_init_q7(&S_ref, NUM_TAPS, firCoeffs32LP_q7, firStateq7, TEST_LENGTH_SAMPLES);
+    ref_fir_q7(&S_ref, testInput_q7_50Hz_200Hz, testOutput_q7_ref, TEST_LENGTH_SAMPLES);
+    riscv_q7_to_float(testOutput_q7, testOutput_f32, TEST_LENGTH_SAMPLES);
+    riscv_q7_to_float(testOutput_q7_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_fir_circ_q7);
+        printf("q7 fir_circ failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_fir_circ_q7);
+}
+
 int main()
 {
     BENCH_INIT();
@@ -336,6 +660,15 @@ int main()
     riscv_fir_q7_lp();
     riscv_fir_fast_q31_lp();
     riscv_fir_fast_q15_lp();
+    riscv_fir_partitioned_f32_lp();
+    riscv_fir_partitioned_q31_lp();
+    riscv_fir_multi_f32_lp();
+    riscv_fir_multi_q31_lp();
+    riscv_fir_multi_q15_lp();
+    riscv_fir_circ_f32_lp();
+    riscv_fir_circ_q31_lp();
+    riscv_fir_circ_q15_lp();
+    riscv_fir_circ_q7_lp();
 #if defined (RISCV_FLOAT16_SUPPORTED)
     riscv_fir_f16_lp();
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
@@ -26,6 +26,12 @@
 #define NUM_TAPS 29             /* Must be even */
 #define MAXDelay 29             /* Must be even */
 
+/* Many taps spread over a long delay line, processed by small blocks without scratch buffers */
+#define GATHER_NUM_TAPS 64
+#define GATHER_MAX_DELAY 1000
+#define GATHER_BLOCK_SIZE 32
+#define GATHER_LENGTH 1024
+
 int test_flag_error = 0;
 
 BENCH_DECLARE_VAR();
@@ -71,6 +77,21 @@ q7_t testOutput_q7_ref[TEST_LENGTH_SAMPLES];
 q7_t firCoeffs32LP_q7[NUM_TAPS];
 q7_t pTapDelayScratch_q7[TEST_LENGTH_SAMPLES];
 
+// no scratch mode
+int32_t pTapDelayGather[GATHER_NUM_TAPS];
+float32_t gatherInput_f32[GATHER_LENGTH];
+float32_t gatherCoeffs_f32[GATHER_NUM_TAPS];
+float32_t gatherOutput_f32[GATHER_LENGTH];
+float32_t gatherOutput_f32_ref[GATHER_LENGTH];
+q31_t gatherState[GATHER_MAX_DELAY + GATHER_BLOCK_SIZE];
+q31_t gatherState_ref[GATHER_MAX_DELAY + GATHER_BLOCK_SIZE];
+q31_t gatherScratchIn[GATHER_BLOCK_SIZE];
+q31_t gatherScratchOut[GATHER_BLOCK_SIZE];
+q31_t gatherCoeffs[GATHER_NUM_TAPS];
+q31_t gatherInput[GATHER_LENGTH];
+q31_t gatherOutput[GATHER_LENGTH];
+q31_t gatherOutput_ref[GATHER_LENGTH];
+
 //***************************************************************************************
 //				fir Sparse Filters
 //***************************************************************************************
@@ -216,6 +237,113 @@ static void riscv_fir_Sparse_q7_lp(void)
 #endif
 }
 
+static void riscv_fir_Sparse_gather_init(void)
+{
+    generate_rand_f32(gatherInput_f32, GATHER_LENGTH);
+    generate_rand_f32(gatherCoeffs_f32, GATHER_NUM_TAPS);
+    riscv_scale_f32(gatherCoeffs_f32, 4.0f / GATHER_NUM_TAPS, gatherCoeffs_f32, GATHER_NUM_TAPS);
+    for (int i = 0; i < GATHER_NUM_TAPS; i++)
+        pTapDelayGather[i] = (i * 15 + 7) % GATHER_MAX_DELAY;
+}
+
+static void riscv_fir_Sparse_gather_check(const char *name)
+{
+    float snr = riscv_snr_f32(gatherOutput_f32_ref, gatherOutput_f32, GATHER_LENGTH);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        printf("%s fir_Sparse without scratch failed with snr:%f\n", name, snr);
+        test_flag_error = 1;
+    }
+}
+
+static void riscv_fir_Sparse_f32_gather(void)
+{
+    riscv_fir_sparse_instance_f32 S, S_ref;
+
+    riscv_fir_sparse_init_f32(&S, GATHER_NUM_TAPS, gatherCoeffs_f32, (float32_t *) gatherState, pTapDelayGather,
+                              GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    riscv_fir_sparse_init_f32(&S_ref, GATHER_NUM_TAPS, gatherCoeffs_f32, (float32_t *) gatherState_ref, pTapDelayGather,
+                              GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    BENCH_START(riscv_fir_sparse_f32_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        riscv_fir_sparse_f32(&S, gatherInput_f32 + i, gatherOutput_f32 + i, NULL, GATHER_BLOCK_SIZE);
+    BENCH_END(riscv_fir_sparse_f32_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        ref_fir_sparse_f32(&S_ref, gatherInput_f32 + i, gatherOutput_f32_ref + i, (float32_t *) gatherScratchIn, GATHER_BLOCK_SIZE);
+    riscv_fir_Sparse_gather_check("f32");
+    BENCH_STATUS(riscv_fir_sparse_f32_gather);
+}
+
+static void riscv_fir_Sparse_q31_gather(void)
+{
+    riscv_fir_sparse_instance_q31 S, S_ref;
+
+    riscv_float_to_q31(gatherInput_f32, gatherInput, GATHER_LENGTH);
+    riscv_float_to_q31(gatherCoeffs_f32, gatherCoeffs, GATHER_NUM_TAPS);
+    riscv_fir_sparse_init_q31(&S, GATHER_NUM_TAPS, gatherCoeffs, gatherState, pTapDelayGather,
+                              GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    riscv_fir_sparse_init_q31(&S_ref, GATHER_NUM_TAPS, gatherCoeffs, gatherState_ref, pTapDelayGather,
+                              GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    BENCH_START(riscv_fir_sparse_q31_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        riscv_fir_sparse_q31(&S, gatherInput + i, gatherOutput + i, NULL, GATHER_BLOCK_SIZE);
+    BENCH_END(riscv_fir_sparse_q31_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        ref_fir_sparse_q31(&S_ref, gatherInput + i, gatherOutput_ref + i, gatherScratchIn, GATHER_BLOCK_SIZE);
+    riscv_q31_to_float(gatherOutput, gatherOutput_f32, GATHER_LENGTH);
+    riscv_q31_to_float(gatherOutput_ref, gatherOutput_f32_ref, GATHER_LENGTH);
+    riscv_fir_Sparse_gather_check("q31");
+    BENCH_STATUS(riscv_fir_sparse_q31_gather);
+}
+
+static void riscv_fir_Sparse_q15_gather(void)
+{
+    riscv_fir_sparse_instance_q15 S, S_ref;
+    q15_t *pIn = (q15_t *) gatherInput, *pOut = (q15_t *) gatherOutput, *pOut_ref = (q15_t *) gatherOutput_ref;
+    q15_t *pCoeffs = (q15_t *) gatherCoeffs;
+
+    riscv_float_to_q15(gatherInput_f32, pIn, GATHER_LENGTH);
+    riscv_float_to_q15(gatherCoeffs_f32, pCoeffs, GATHER_NUM_TAPS);
+    riscv_fir_sparse_init_q15(&S, GATHER_NUM_TAPS, pCoeffs, (q15_t *) gatherState, pTapDelayGather,
+                              GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    riscv_fir_sparse_init_q15(&S_ref, GATHER_NUM_TAPS, pCoeffs, (q15_t *) gatherState_ref, pTapDelayGather,
+                              GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    BENCH_START(riscv_fir_sparse_q15_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        riscv_fir_sparse_q15(&S, pIn + i, pOut + i, NULL, NULL, GATHER_BLOCK_SIZE);
+    BENCH_END(riscv_fir_sparse_q15_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        ref_fir_sparse_q15(&S_ref, pIn + i, pOut_ref + i, (q15_t *) gatherScratchIn, gatherScratchOut, GATHER_BLOCK_SIZE);
+    riscv_q15_to_float(pOut, gatherOutput_f32, GATHER_LENGTH);
+    riscv_q15_to_float(pOut_ref, gatherOutput_f32_ref, GATHER_LENGTH);
+    riscv_fir_Sparse_gather_check("q15");
+    BENCH_STATUS(riscv_fir_sparse_q15_gather);
+}
+
+static void riscv_fir_Sparse_q7_gather(void)
+{
+    riscv_fir_sparse_instance_q7 S, S_ref;
+    q7_t *pIn = (q7_t *) gatherInput, *pOut = (q7_t *) gatherOutput, *pOut_ref = (q7_t *) gatherOutput_ref;
+    q7_t *pCoeffs = (q7_t *) gatherCoeffs;
+
+    riscv_float_to_q7(gatherInput_f32, pIn, GATHER_LENGTH);
+    riscv_float_to_q7(gatherCoeffs_f32, pCoeffs, GATHER_NUM_TAPS);
+    riscv_fir_sparse_init_q7(&S, GATHER_NUM_TAPS, pCoeffs, (q7_t *) gatherState, pTapDelayGather,
+                             GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    riscv_fir_sparse_init_q7(&S_ref, GATHER_NUM_TAPS, pCoeffs, (q7_t *) gatherState_ref, pTapDelayGather,
+                             GATHER_MAX_DELAY, GATHER_BLOCK_SIZE);
+    BENCH_START(riscv_fir_sparse_q7_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        riscv_fir_sparse_q7(&S, pIn + i, pOut + i, NULL, NULL, GATHER_BLOCK_SIZE);
+    BENCH_END(riscv_fir_sparse_q7_gather);
+    for (int i = 0; i < GATHER_LENGTH; i += GATHER_BLOCK_SIZE)
+        ref_fir_sparse_q7(&S_ref, pIn + i, pOut_ref + i, (q7_t *) gatherScratchIn, gatherScratchOut, GATHER_BLOCK_SIZE);
+    riscv_q7_to_float(pOut, gatherOutput_f32, GATHER_LENGTH);
+    riscv_q7_to_float(pOut_ref, gatherOutput_f32_ref, GATHER_LENGTH);
+    riscv_fir_Sparse_gather_check("q7");
+    BENCH_STATUS(riscv_fir_sparse_q7_gather);
+}
+
 int main()
 {
     BENCH_INIT();
@@ -225,6 +353,12 @@ int main()
     riscv_fir_Sparse_q15_lp();
     riscv_fir_Sparse_q7_lp();
 
+    riscv_fir_Sparse_gather_init();
+    riscv_fir_Sparse_f32_gather();
+    riscv_fir_Sparse_q31_gather();
+    riscv_fir_Sparse_q15_gather();
+    riscv_fir_Sparse_q7_gather();
+
     if (test_flag_error) {
         printf("test error apprears, please recheck.\n");
         return 1;
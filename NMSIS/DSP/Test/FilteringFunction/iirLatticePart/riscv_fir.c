@@ -50,6 +50,16 @@ q15_t IIRStateQ15[TEST_LENGTH_SAMPLES + numStages];
 q15_t IIRCoeffs32LP_K_q15[numStages];
 q15_t IIRCoeffs32LP_V_q15[numStages + 1];
 q15_t testInput_q15_50Hz_200Hz[TEST_LENGTH_SAMPLES];
+
+// lattice orders of speech codecs
+#define LATTICE_MAX_ORDER 32
+const uint16_t latticeOrders[] = {10, 16, 32};
+float32_t latticeStateF32[TEST_LENGTH_SAMPLES + LATTICE_MAX_ORDER];
+float32_t latticeCoeffs_K[LATTICE_MAX_ORDER], latticeCoeffs_V[LATTICE_MAX_ORDER + 1];
+q31_t latticeStateQ31[TEST_LENGTH_SAMPLES + LATTICE_MAX_ORDER];
+q31_t latticeCoeffs_K_q31[LATTICE_MAX_ORDER], latticeCoeffs_V_q31[LATTICE_MAX_ORDER + 1];
+q15_t latticeStateQ15[TEST_LENGTH_SAMPLES + LATTICE_MAX_ORDER];
+q15_t latticeCoeffs_K_q15[LATTICE_MAX_ORDER], latticeCoeffs_V_q15[LATTICE_MAX_ORDER + 1];
 //***************************************************************************************
 //				iir		Lattice Filters
 //***************************************************************************************
@@ -166,12 +176,113 @@ static void riscv_iir_q15_lattice_lp(void)
 #endif
 }
 
+static void riscv_iir_f32_lattice_orders_lp(void)
+{
+    uint32_t i;
+    uint16_t order;
+    /* clang-format off */
+    riscv_iir_lattice_instance_f32 S;
+    /* clang-format on */
+    /* Small input, reflection coefficients decreasing with the stage and small ladder coefficients */
+    generate_rand_f32(testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_scale_f32(testInput_f32_50Hz_200Hz, 0.125f, testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    generate_rand_f32(latticeCoeffs_K, LATTICE_MAX_ORDER);
+    for (i = 0; i < LATTICE_MAX_ORDER; i++) {
+        latticeCoeffs_K[i] /= (float32_t)(i + 1);
+    }
+    generate_rand_f32(latticeCoeffs_V, LATTICE_MAX_ORDER + 1);
+    riscv_scale_f32(latticeCoeffs_V, 0.125f, latticeCoeffs_V, LATTICE_MAX_ORDER + 1);
+    for (i = 0; i < sizeof(latticeOrders) / sizeof(latticeOrders[0]); i++) {
+        order = latticeOrders[i];
+        printf("f32 iir_lattice order %d\n", order);
+        riscv_iir_lattice_init_f32(&S, order, latticeCoeffs_K, latticeCoeffs_V, latticeStateF32, TEST_LENGTH_SAMPLES);
+        BENCH_START(riscv_iir_lattice_f32);
+        riscv_iir_lattice_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, TEST_LENGTH_SAMPLES);
+        BENCH_END(riscv_iir_lattice_f32);
+        riscv_iir_lattice_init_f32(&S, order, latticeCoeffs_K, latticeCoeffs_V, latticeStateF32, TEST_LENGTH_SAMPLES);
+        ref_iir_lattice_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_iir_lattice_f32);
+            printf("f32 iir_lattice order %d failed with snr:%f\n", order, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_iir_lattice_f32);
+    }
+}
+static void riscv_iir_q31_lattice_orders_lp(void)
+{
+    uint32_t i;
+    uint16_t order;
+    /* clang-format off */
+    riscv_iir_lattice_instance_q31 S;
+    /* clang-format on */
+    riscv_float_to_q31(testInput_f32_50Hz_200Hz, testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(latticeCoeffs_K, latticeCoeffs_K_q31, LATTICE_MAX_ORDER);
+    riscv_float_to_q31(latticeCoeffs_V, latticeCoeffs_V_q31, LATTICE_MAX_ORDER + 1);
+    for (i = 0; i < sizeof(latticeOrders) / sizeof(latticeOrders[0]); i++) {
+        order = latticeOrders[i];
+        printf("q31 iir_lattice order %d\n", order);
+        riscv_iir_lattice_init_q31(&S, order, latticeCoeffs_K_q31, latticeCoeffs_V_q31, latticeStateQ31, TEST_LENGTH_SAMPLES);
+        BENCH_START(riscv_iir_lattice_q31);
+        riscv_iir_lattice_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, TEST_LENGTH_SAMPLES);
+        BENCH_END(riscv_iir_lattice_q31);
+        riscv_iir_lattice_init_q31(&S, order, latticeCoeffs_K_q31, latticeCoeffs_V_q31, latticeStateQ31, TEST_LENGTH_SAMPLES);
+        ref_iir_lattice_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES);
+        riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_iir_lattice_q31);
+            printf("q31 iir_lattice order %d failed with snr:%f\n", order, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_iir_lattice_q31);
+    }
+}
+static void riscv_iir_q15_lattice_orders_lp(void)
+{
+    uint32_t i;
+    uint16_t order;
+    /* clang-format off */
+    riscv_iir_lattice_instance_q15 S;
+    /* clang-format on */
+    riscv_float_to_q15(testInput_f32_50Hz_200Hz, testInput_q15_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q15(latticeCoeffs_K, latticeCoeffs_K_q15, LATTICE_MAX_ORDER);
+    riscv_float_to_q15(latticeCoeffs_V, latticeCoeffs_V_q15, LATTICE_MAX_ORDER + 1);
+    for (i = 0; i < sizeof(latticeOrders) / sizeof(latticeOrders[0]); i++) {
+        order = latticeOrders[i];
+        printf("q15 iir_lattice order %d\n", order);
+        riscv_iir_lattice_init_q15(&S, order, latticeCoeffs_K_q15, latticeCoeffs_V_q15, latticeStateQ15, TEST_LENGTH_SAMPLES);
+        BENCH_START(riscv_iir_lattice_q15);
+        riscv_iir_lattice_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15, TEST_LENGTH_SAMPLES);
+        BENCH_END(riscv_iir_lattice_q15);
+        riscv_iir_lattice_init_q15(&S, order, latticeCoeffs_K_q15, latticeCoeffs_V_q15, latticeStateQ15, TEST_LENGTH_SAMPLES);
+        ref_iir_lattice_q15(&S, testInput_q15_50Hz_200Hz, testOutput_q15_ref, TEST_LENGTH_SAMPLES);
+        riscv_q15_to_float(testOutput_q15, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q15_to_float(testOutput_q15_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_iir_lattice_q15);
+            printf("q15 iir_lattice order %d failed with snr:%f\n", order, snr);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_iir_lattice_q15);
+    }
+}
+
 int main()
 {
     BENCH_INIT();
     riscv_iir_f32_lattice_lp();
     riscv_iir_q31_lattice_lp();
     riscv_iir_q15_lattice_lp();
+    riscv_iir_f32_lattice_orders_lp();
+    riscv_iir_q31_lattice_orders_lp();
+    riscv_iir_q15_lattice_orders_lp();
 
     if (test_flag_error) {
         printf("test error apprears, please recheck.\n");
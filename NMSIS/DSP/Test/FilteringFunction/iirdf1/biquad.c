@@ -335,6 +335,138 @@ void ref_biquad_cascade_df1_q31(const riscv_biquad_casd_df1_inst_q31 *S,
     } while (--stage);
 }
 
+void ref_biquad_cascade_multi_df1_q31(
+    const riscv_biquad_cascade_multi_df1_instance_q31 *S, q31_t *pSrc,
+    q31_t *pDst, uint32_t blockSize)
+{
+    q63_t acc; /*  accumulator                   */
+    uint32_t lShift = 31U - (uint32_t)S->postShift; /* Shift to be applied to the output */
+    q31_t *pIn = pSrc;                 /*  input pointer initialization  */
+    q31_t *pState = S->pState;         /*  pState pointer initialization */
+    const q31_t *pCoeffs = S->pCoeffs; /*  coeff pointer initialization  */
+    q31_t Xn1, Xn2, Yn1, Yn2;          /*  Filter state variables        */
+    q31_t b0, b1, b2, a1, a2;          /*  Filter coefficients           */
+    q31_t Xn;                          /*  temporary input               */
+    uint32_t numChans = S->numChans;
+    uint32_t chanStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? 1U : blockSize;
+    uint32_t sampleStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? numChans : 1U;
+    uint32_t ch, sample, stage;        /*  loop counters                 */
+
+    for (stage = 0U; stage < S->numStages; stage++) {
+        /* Reading the coefficients */
+        b0 = *pCoeffs++;
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        for (ch = 0U; ch < numChans; ch++) {
+            /* Reading the state values of the channel */
+            Xn1 = pState[ch];
+            Xn2 = pState[numChans + ch];
+            Yn1 = pState[2U * numChans + ch];
+            Yn2 = pState[3U * numChans + ch];
+
+            for (sample = 0U; sample < blockSize; sample++) {
+                Xn = pIn[ch * chanStride + sample * sampleStride];
+
+                /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                acc = (q63_t)b0 * Xn;
+                acc += (q63_t)b1 * Xn1;
+                acc += (q63_t)b2 * Xn2;
+                acc += (q63_t)a1 * Yn1;
+                acc += (q63_t)a2 * Yn2;
+
+                /* The result is converted to 1.31  */
+                acc = acc >> lShift;
+
+                Xn2 = Xn1;
+                Xn1 = Xn;
+                Yn2 = Yn1;
+                Yn1 = (q31_t)acc;
+
+                pDst[ch * chanStride + sample * sampleStride] = (q31_t)acc;
+            }
+
+            /*  Store the updated state variables back into the pState array */
+            pState[ch] = Xn1;
+            pState[numChans + ch] = Xn2;
+            pState[2U * numChans + ch] = Yn1;
+            pState[3U * numChans + ch] = Yn2;
+        }
+
+        pState += 4U * numChans;
+
+        /*  Subsequent stages occur in-place in the output buffer */
+        pIn = pDst;
+    }
+}
+
+void ref_biquad_cas_multi_df1_32x64_q31(
+    const riscv_biquad_cas_multi_df1_32x64_ins_q31 *S, q31_t *pSrc,
+    q31_t *pDst, uint32_t blockSize)
+{
+    q63_t acc; /*  accumulator                   */
+    uint32_t shift = (uint32_t)S->postShift + 1U; /* Shift to be applied to the state */
+    uint32_t lShift = 32U - shift;     /*  Shift to be applied to the output */
+    q31_t *pIn = pSrc;                 /*  input pointer initialization  */
+    q63_t *pState = S->pState;         /*  pState pointer initialization */
+    const q31_t *pCoeffs = S->pCoeffs; /*  coeff pointer initialization  */
+    q31_t Xn1, Xn2;                    /*  Input Filter state variables  */
+    q63_t Yn1, Yn2;                    /*  Output Filter state variables */
+    q31_t b0, b1, b2, a1, a2;          /*  Filter coefficients           */
+    q31_t Xn;                          /*  temporary input               */
+    uint32_t numChans = S->numChans;
+    uint32_t chanStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? 1U : blockSize;
+    uint32_t sampleStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? numChans : 1U;
+    uint32_t ch, sample, stage;        /*  loop counters                 */
+
+    for (stage = 0U; stage < S->numStages; stage++) {
+        /* Reading the coefficients */
+        b0 = *pCoeffs++;
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        for (ch = 0U; ch < numChans; ch++) {
+            /* Reading the state values of the channel */
+            Xn1 = (q31_t)pState[ch];
+            Xn2 = (q31_t)pState[numChans + ch];
+            Yn1 = pState[2U * numChans + ch];
+            Yn2 = pState[3U * numChans + ch];
+
+            for (sample = 0U; sample < blockSize; sample++) {
+                Xn = pIn[ch * chanStride + sample * sampleStride];
+
+                /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                acc = (q63_t)Xn * b0 + (q63_t)Xn1 * b1 + (q63_t)Xn2 * b2;
+                acc += mult32x64(Yn1, a1);
+                acc += mult32x64(Yn2, a2);
+
+                Xn2 = Xn1;
+                Xn1 = Xn;
+                Yn2 = Yn1;
+
+                /* The state is kept in 1.63 format, the output is converted to 1.31 */
+                Yn1 = acc << shift;
+                pDst[ch * chanStride + sample * sampleStride] = (q31_t)(acc >> lShift);
+            }
+
+            /*  Store the updated state variables back into the pState array */
+            pState[ch] = (q63_t)Xn1;
+            pState[numChans + ch] = (q63_t)Xn2;
+            pState[2U * numChans + ch] = Yn1;
+            pState[3U * numChans + ch] = Yn2;
+        }
+
+        pState += 4U * numChans;
+
+        /*  Subsequent stages occur in-place in the output buffer */
+        pIn = pDst;
+    }
+}
+
 void ref_biquad_cascade_df1_fast_q31(const riscv_biquad_casd_df1_inst_q31 *S,
                                      q31_t *pSrc, q31_t *pDst,
                                      uint32_t blockSize)
@@ -56,6 +56,9 @@ q31_t testOutput_q31_ref[TEST_LENGTH_SAMPLES];
 q31_t IIRCoeffsQ31LP[5 * numStages];
 q31_t IIRStateq31[4 * numStages];
 q63_t IIRState32x64[4 * numStages];
+#define MULTI_CHANNELS 8
+q31_t IIRStateMultiq31[4 * numStages * MULTI_CHANNELS];
+q63_t IIRStateMulti32x64[4 * numStages * MULTI_CHANNELS];
 
 // q15
 q15_t testInput_q15_50Hz_200Hz[TEST_LENGTH_SAMPLES];
@@ -349,6 +352,64 @@ static void riscv_iir_q31_32x64_lp(void)
 #endif
 }
 
+static void riscv_iir_multi_q31_lp(void)
+{
+    /* clang-format off */
+    riscv_biquad_cascade_multi_df1_instance_q31 S;
+    /* clang-format on */
+    riscv_multichannel_layout layout;
+    generate_rand_q31(testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(IIRCoeffs32LP, IIRCoeffsQ31LP, 5 * numStages);
+    for (layout = RISCV_MULTICHANNEL_INTERLEAVED; layout <= RISCV_MULTICHANNEL_PLANAR; layout++) {
+        riscv_biquad_cascade_multi_df1_init_q31(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffsQ31LP, IIRStateMultiq31, 0);
+        BENCH_START(riscv_biquad_cascade_multi_df1_q31);
+        riscv_biquad_cascade_multi_df1_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+        BENCH_END(riscv_biquad_cascade_multi_df1_q31);
+        riscv_biquad_cascade_multi_df1_init_q31(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffsQ31LP, IIRStateMultiq31, 0);
+        ref_biquad_cascade_multi_df1_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+
+        riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_biquad_cascade_multi_df1_q31);
+            printf("q31 biquad_cascade_multi_df1 failed with snr:%f, layout:%d\n", snr, layout);
+            test_flag_error = 1;
+        }
+    }
+    BENCH_STATUS(riscv_biquad_cascade_multi_df1_q31);
+}
+
+static void riscv_iir_multi_q31_32x64_lp(void)
+{
+    /* clang-format off */
+    riscv_biquad_cas_multi_df1_32x64_ins_q31 S;
+    /* clang-format on */
+    riscv_multichannel_layout layout;
+    generate_rand_q31(testInput_q31_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_float_to_q31(IIRCoeffs32LP, IIRCoeffsQ31LP, 5 * numStages);
+    for (layout = RISCV_MULTICHANNEL_INTERLEAVED; layout <= RISCV_MULTICHANNEL_PLANAR; layout++) {
+        riscv_biquad_cas_multi_df1_32x64_init_q31(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffsQ31LP, IIRStateMulti32x64, 0);
+        BENCH_START(riscv_biquad_cas_multi_df1_32x64_q31);
+        riscv_biquad_cas_multi_df1_32x64_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+        BENCH_END(riscv_biquad_cas_multi_df1_32x64_q31);
+        riscv_biquad_cas_multi_df1_32x64_init_q31(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffsQ31LP, IIRStateMulti32x64, 0);
+        ref_biquad_cas_multi_df1_32x64_q31(&S, testInput_q31_50Hz_200Hz, testOutput_q31_ref, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+
+        riscv_q31_to_float(testOutput_q31, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_q31_to_float(testOutput_q31_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_biquad_cas_multi_df1_32x64_q31);
+            printf("q31 biquad_cas_multi_df1_32x64 failed with snr:%f, layout:%d\n", snr, layout);
+            test_flag_error = 1;
+        }
+    }
+    BENCH_STATUS(riscv_biquad_cas_multi_df1_32x64_q31);
+}
+
 int main()
 {
     BENCH_INIT();
@@ -359,6 +420,8 @@ int main()
     riscv_iir_q31_fast_lp();
     riscv_iir_q15_fast_lp();
     riscv_iir_q31_32x64_lp();
+    riscv_iir_multi_q31_lp();
+    riscv_iir_multi_q31_32x64_lp();
 #if defined (RISCV_FLOAT16_SUPPORTED)
     riscv_iir_f16_lp();
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
@@ -66,6 +66,61 @@ void ref_biquad_cascade_df2T_f32(const riscv_biquad_cascade_df2T_instance_f32 *S
     } while (stage > 0U);
 }
 
+void ref_biquad_cascade_multi_df2T_f32(
+    const riscv_biquad_cascade_multi_df2T_instance_f32 *S, float32_t *pSrc,
+    float32_t *pDst, uint32_t blockSize)
+{
+    float32_t *pIn = pSrc;                   /*  source pointer            */
+    float32_t *pState = S->pState;           /*  State pointer             */
+    const float32_t *pCoeffs = S->pCoeffs;   /*  coefficient pointer       */
+    float32_t acc;                           /*  accumulator               */
+    float32_t b0, b1, b2, a1, a2;            /*  Filter coefficients       */
+    float32_t Xn;                            /*  temporary input           */
+    float32_t d1, d2;                        /*  state variables           */
+    uint32_t numChans = S->numChans;
+    uint32_t chanStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? 1U : blockSize;
+    uint32_t sampleStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? numChans : 1U;
+    uint32_t ch, sample, stage;          /*  loop counters             */
+
+    for (stage = 0U; stage < S->numStages; stage++) {
+        /* Reading the coefficients */
+        b0 = *pCoeffs++;
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        for (ch = 0U; ch < numChans; ch++) {
+            /* Reading the state values of the channel */
+            d1 = pState[ch];
+            d2 = pState[numChans + ch];
+
+            for (sample = 0U; sample < blockSize; sample++) {
+                Xn = pIn[ch * chanStride + sample * sampleStride];
+
+                /* y[n] = b0 * x[n] + d1 */
+                acc = (b0 * Xn) + d1;
+                pDst[ch * chanStride + sample * sampleStride] = acc;
+
+                /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+                d1 = (b1 * Xn + a1 * acc) + d2;
+
+                /* d2 = b2 * x[n] + a2 * y[n] */
+                d2 = (b2 * Xn) + (a2 * acc);
+            }
+
+            /* Store the updated state variables back into the state array */
+            pState[ch] = d1;
+            pState[numChans + ch] = d2;
+        }
+
+        pState += 2U * numChans;
+
+        /* The current stage input is given as the output to the next stage */
+        pIn = pDst;
+    }
+}
+
 #if defined (RISCV_FLOAT16_SUPPORTED)
 void ref_biquad_cascade_df2T_f16(
   const riscv_biquad_cascade_df2T_instance_f16 * S,
@@ -135,6 +190,61 @@ void ref_biquad_cascade_df2T_f16(
 
    } while (stage > 0U);
 }
+
+void ref_biquad_cascade_multi_df2T_f16(
+    const riscv_biquad_cascade_multi_df2T_instance_f16 *S, float16_t *pSrc,
+    float16_t *pDst, uint32_t blockSize)
+{
+    float16_t *pIn = pSrc;                   /*  source pointer            */
+    float16_t *pState = S->pState;           /*  State pointer             */
+    const float16_t *pCoeffs = S->pCoeffs;   /*  coefficient pointer       */
+    float16_t acc;                           /*  accumulator               */
+    float16_t b0, b1, b2, a1, a2;            /*  Filter coefficients       */
+    float16_t Xn;                            /*  temporary input           */
+    float16_t d1, d2;                        /*  state variables           */
+    uint32_t numChans = S->numChans;
+    uint32_t chanStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? 1U : blockSize;
+    uint32_t sampleStride = (S->layout == RISCV_MULTICHANNEL_INTERLEAVED) ? numChans : 1U;
+    uint32_t ch, sample, stage;          /*  loop counters             */
+
+    for (stage = 0U; stage < S->numStages; stage++) {
+        /* Reading the coefficients */
+        b0 = *pCoeffs++;
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        for (ch = 0U; ch < numChans; ch++) {
+            /* Reading the state values of the channel */
+            d1 = pState[ch];
+            d2 = pState[numChans + ch];
+
+            for (sample = 0U; sample < blockSize; sample++) {
+                Xn = pIn[ch * chanStride + sample * sampleStride];
+
+                /* y[n] = b0 * x[n] + d1 */
+                acc = (b0 * Xn) + d1;
+                pDst[ch * chanStride + sample * sampleStride] = acc;
+
+                /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+                d1 = (b1 * Xn + a1 * acc) + d2;
+
+                /* d2 = b2 * x[n] + a2 * y[n] */
+                d2 = (b2 * Xn) + (a2 * acc);
+            }
+
+            /* Store the updated state variables back into the state array */
+            pState[ch] = d1;
+            pState[numChans + ch] = d2;
+        }
+
+        pState += 2U * numChans;
+
+        /* The current stage input is given as the output to the next stage */
+        pIn = pDst;
+    }
+}
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
 
 void ref_biquad_cascade_stereo_df2T_f32(
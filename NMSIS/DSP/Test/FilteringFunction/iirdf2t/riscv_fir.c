@@ -32,12 +32,16 @@ BENCH_DECLARE_VAR();
 #define TEST_LENGTH_SAMPLES 320 /* 采样点数 */
 #define numStages 2             /* 2阶IIR滤波的个数 */
 // f32
-float32_t testInput_f32_50Hz_200Hz[TEST_LENGTH_SAMPLES];
+float32_t testInput_f32_50Hz_200Hz[TEST_LENGTH_SAMPLES * 2];
 float32_t testOutput_f32[TEST_LENGTH_SAMPLES * 2];
 float32_t testOutput_f32_ref[TEST_LENGTH_SAMPLES * 2];
 float32_t IIRCoeffs32LP[5 * numStages] = {1.0f, 2.0f, 1.0f,    1.11302985416334787593939381622476503253f,  - 0.574061915083954765748330828500911593437f,1.0f,  2.0f,  1.0f,   0.855397932775170177777113167394418269396f, - 0.209715357756554754420363906319835223258f};
 float32_t IIRStateF32[2 * numStages];
 float32_t IIRStateSteF32[4 * numStages];
+#define MULTI_CHANNELS 8
+float32_t IIRStateMultiF32[2 * numStages * MULTI_CHANNELS];
+#define BLOCK_LEN 12
+float32_t IIRBlockCoeffsF32[RISCV_BIQUAD_BLOCK_COEFFS_SIZE_F32(numStages, BLOCK_LEN)];
 #if defined (RISCV_FLOAT16_SUPPORTED)
 // f16
 float16_t testInput_f16_50Hz_200Hz[TEST_LENGTH_SAMPLES];
@@ -46,6 +50,7 @@ float16_t testOutput_f16_ref[TEST_LENGTH_SAMPLES * 2];
 float16_t IIRCoeffs16LP[5 * numStages];
 float16_t IIRStateF16[2 * numStages];
 float16_t IIRStateSteF16[4 * numStages];
+float16_t IIRStateMultiF16[2 * numStages * MULTI_CHANNELS];
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
 
 // f64
@@ -206,14 +211,99 @@ static void riscv_iir_stereo_df2t_f16_lp(void)
 }
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
 
+static void riscv_iir_df2t_block_f32_lp(void)
+{
+    /* clang-format off */
+    riscv_biquad_cascade_df2T_block_instance_f32 S;
+    riscv_biquad_cascade_df2T_instance_f32 SRef;
+    /* clang-format on */
+    generate_rand_f32(testInput_f32_50Hz_200Hz, TEST_LENGTH_SAMPLES);
+    riscv_status status = riscv_biquad_cascade_df2T_block_init_f32(&S, numStages, IIRCoeffs32LP, IIRBlockCoeffsF32, IIRStateF32, BLOCK_LEN);
+    if (status != RISCV_MATH_SUCCESS) {
+        BENCH_ERROR(riscv_biquad_cascade_df2T_block_f32);
+        printf("f32 biquad_cascade_df2T_block_init failed with status:%d\n", status);
+        test_flag_error = 1;
+        return;
+    }
+    BENCH_START(riscv_biquad_cascade_df2T_block_f32);
+    riscv_biquad_cascade_df2T_block_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_biquad_cascade_df2T_block_f32);
+    riscv_biquad_cascade_df2T_init_f32(&SRef, numStages, IIRCoeffs32LP, IIRStateF32);
+    ref_biquad_cascade_df2T_f32(&SRef, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+    /* Same filter as the direct form: compare all the outputs, including the last ones of the direct form tail */
+    float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_biquad_cascade_df2T_block_f32);
+        printf("f32 biquad_cascade_df2T_block failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_biquad_cascade_df2T_block_f32);
+}
+
+static void riscv_iir_multi_df2t_f32_lp(void)
+{
+    /* clang-format off */
+    riscv_biquad_cascade_multi_df2T_instance_f32 S;
+    /* clang-format on */
+    riscv_multichannel_layout layout;
+    for (layout = RISCV_MULTICHANNEL_INTERLEAVED; layout <= RISCV_MULTICHANNEL_PLANAR; layout++) {
+        riscv_biquad_cascade_multi_df2T_init_f32(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffs32LP, IIRStateMultiF32);
+        BENCH_START(riscv_biquad_cascade_multi_df2T_f32);
+        riscv_biquad_cascade_multi_df2T_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+        BENCH_END(riscv_biquad_cascade_multi_df2T_f32);
+        riscv_biquad_cascade_multi_df2T_init_f32(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffs32LP, IIRStateMultiF32);
+        ref_biquad_cascade_multi_df2T_f32(&S, testInput_f32_50Hz_200Hz, testOutput_f32_ref, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_biquad_cascade_multi_df2T_f32);
+            printf("f32 biquad_cascade_multi_df2T failed with snr:%f, layout:%d\n", snr, layout);
+            test_flag_error = 1;
+        }
+    }
+    BENCH_STATUS(riscv_biquad_cascade_multi_df2T_f32);
+}
+
+#if defined (RISCV_FLOAT16_SUPPORTED)
+static void riscv_iir_multi_df2t_f16_lp(void)
+{
+    /* clang-format off */
+    riscv_biquad_cascade_multi_df2T_instance_f16 S;
+    /* clang-format on */
+    riscv_multichannel_layout layout;
+    for (layout = RISCV_MULTICHANNEL_INTERLEAVED; layout <= RISCV_MULTICHANNEL_PLANAR; layout++) {
+        riscv_biquad_cascade_multi_df2T_init_f16(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffs16LP, IIRStateMultiF16);
+        BENCH_START(riscv_biquad_cascade_multi_df2T_f16);
+        riscv_biquad_cascade_multi_df2T_f16(&S, testInput_f16_50Hz_200Hz, testOutput_f16, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+        BENCH_END(riscv_biquad_cascade_multi_df2T_f16);
+        riscv_biquad_cascade_multi_df2T_init_f16(&S, numStages, MULTI_CHANNELS, layout, IIRCoeffs16LP, IIRStateMultiF16);
+        ref_biquad_cascade_multi_df2T_f16(&S, testInput_f16_50Hz_200Hz, testOutput_f16_ref, TEST_LENGTH_SAMPLES / MULTI_CHANNELS);
+        riscv_f16_to_float(testOutput_f16, testOutput_f32, TEST_LENGTH_SAMPLES);
+        riscv_f16_to_float(testOutput_f16_ref, testOutput_f32_ref, TEST_LENGTH_SAMPLES);
+        float snr = riscv_snr_f32(&testOutput_f32_ref[0], &testOutput_f32[0], TEST_LENGTH_SAMPLES);
+
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_biquad_cascade_multi_df2T_f16);
+            printf("f16 biquad_cascade_multi_df2T failed with snr:%f, layout:%d\n", snr, layout);
+            test_flag_error = 1;
+        }
+    }
+    BENCH_STATUS(riscv_biquad_cascade_multi_df2T_f16);
+}
+#endif /* defined (RISCV_FLOAT16_SUPPORTED) */
+
 int main()
 {
     BENCH_INIT();
     riscv_iir_df2t_f32_lp();
     riscv_iir_stereo_df2t_f32_lp();
+    riscv_iir_multi_df2t_f32_lp();
+    riscv_iir_df2t_block_f32_lp();
 #if defined (RISCV_FLOAT16_SUPPORTED)
     riscv_iir_df2t_f16_lp();
     riscv_iir_stereo_df2t_f16_lp();
+    riscv_iir_multi_df2t_f16_lp();
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
 
     if (test_flag_error) {
@@ -243,3 +243,75 @@ void ref_levinson_durbin_q31(const q31_t *phi,
    }
    *err = e;
 }
+
+void ref_lpc_analysis_f32(const float32_t *pSrc, const float32_t *pWindow, uint32_t blockSize,
+                          uint16_t order, float32_t *pCoeffs, float32_t *pErr)
+{
+   float32_t x[blockSize];
+   float32_t phi[order + 1];
+
+   for (uint32_t n = 0; n < blockSize; n++)
+   {
+      x[n] = (pWindow != NULL) ? pSrc[n] * pWindow[n] : pSrc[n];
+   }
+
+   for (uint32_t m = 0; m <= order; m++)
+   {
+      phi[m] = 0.0f;
+      for (uint32_t n = 0; n + m < blockSize; n++)
+      {
+         phi[m] += x[n] * x[n + m];
+      }
+   }
+
+   ref_levinson_durbin_f32(phi, pCoeffs, pErr, order);
+}
+
+void ref_lpc_analysis_q31(const q31_t *pSrc, const q31_t *pWindow, uint32_t blockSize,
+                          uint16_t order, q31_t *pCoeffs, q31_t *pErr)
+{
+   q31_t x[blockSize];
+   q31_t phi[order + 1];
+   q63_t r0, r;
+   int shift = 0;
+
+   for (uint32_t n = 0; n < blockSize; n++)
+   {
+      if (pWindow != NULL)
+      {
+         /* Same rounding as riscv_mult_q31 */
+         q63_t y = ((q63_t)pSrc[n] * pWindow[n]) >> 32;
+         x[n] = ((q31_t)(y > 0x3FFFFFFF ? 0x3FFFFFFF : y)) << 1;
+      }
+      else
+      {
+         x[n] = pSrc[n];
+      }
+   }
+
+   /* Lags in 16.48 format as riscv_dot_prod_q31, normalized by the lag 0 */
+   r0 = 0;
+   for (uint32_t n = 0; n < blockSize; n++)
+   {
+      r0 += ((q63_t)x[n] * x[n]) >> 14;
+   }
+
+   while ((r0 >> shift) > 0x7FFFFFFF)
+   {
+      shift++;
+   }
+
+   phi[0] = 0x7FFFFFFF;
+   for (uint32_t m = 1; m <= order; m++)
+   {
+      r = 0;
+      for (uint32_t n = 0; n + m < blockSize; n++)
+      {
+         r += ((q63_t)x[n] * x[n + m]) >> 14;
+      }
+      r = ((r >> shift) << 31) / (r0 >> shift);
+      phi[m] = (q31_t)(r > 0x7FFFFFFF ? 0x7FFFFFFF : (r < -0x7FFFFFFF - 1 ? -0x7FFFFFFF - 1 : r));
+   }
+
+   ref_levinson_durbin_q31(phi, pCoeffs, pErr, order);
+}
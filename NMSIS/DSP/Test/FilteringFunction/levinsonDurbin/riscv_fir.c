@@ -22,20 +22,48 @@
 
 #include <stdio.h>
 
+#define LD_SIGNAL_SIZE 1024
+#define LPC_BLOCK_SIZE 256
+#define LPC_ORDER 10
+#define SNR_THRESHOLD_F32 (80.0f)
+#define LPC_SNR_THRESHOLD_Q31 (100.0f)
+
 int test_flag_error = 0;
 
 BENCH_DECLARE_VAR();
 //***************************************************************************************
 //				iir		Lattice Filters
 //***************************************************************************************
+/* Second order autoregressive process */
+static void ar2_test_signal(float32_t *pSrc, int length)
+{
+    generate_rand_f32(pSrc, length);
+    for (int n = 0; n < length; n++) {
+        pSrc[n] *= 0.5f;
+        if (n > 0)
+            pSrc[n] += 0.6f * pSrc[n - 1];
+        if (n > 1)
+            pSrc[n] -= 0.3f * pSrc[n - 2];
+    }
+}
+
 static void DSP_levinson_durbin_f32(void)
 {
     int nbCoefs = 180;
     float32_t phi[256];
     float32_t a[256], a_ref[256];
     float32_t err, err_ref;
-    for(int i = 0; i < 256; i++)
-        phi[i] = (float32_t) rand();
+    float32_t acc;
+    static float32_t sig[LD_SIGNAL_SIZE];
+    /* phi must be an autocorrelation, otherwise the recursion is too badly
+       conditioned for the coefficients to be compared */
+    ar2_test_signal(sig, LD_SIGNAL_SIZE);
+    for(int i = 0; i < 256; i++) {
+        acc = 0.0f;
+        for(int n = i; n < LD_SIGNAL_SIZE; n++)
+            acc += sig[n] * sig[n - i];
+        phi[i] = acc / LD_SIGNAL_SIZE;
+    }
     BENCH_START(riscv_levinson_durbin_f32);
     riscv_levinson_durbin_f32(phi, a, &err, nbCoefs);
     BENCH_END(riscv_levinson_durbin_f32);
@@ -112,11 +140,116 @@ static void DSP_levinson_durbin_q31(void)
     BENCH_STATUS(riscv_levinson_durbin_q31);
 }
 
+/* Second order autoregressive process with a Hamming window */
+static void lpc_test_signal(float32_t *pSrc, float32_t *pWindow)
+{
+    ar2_test_signal(pSrc, LPC_BLOCK_SIZE);
+    for (int n = 0; n < LPC_BLOCK_SIZE; n++) {
+        pWindow[n] = 0.54f - 0.46f * cosf(2.0f * PI * n / (LPC_BLOCK_SIZE - 1));
+    }
+}
+
+static void DSP_lpc_analysis_f32(void)
+{
+    float32_t src[LPC_BLOCK_SIZE], window[LPC_BLOCK_SIZE];
+    float32_t scratch[LPC_BLOCK_SIZE + LPC_ORDER + 1];
+    float32_t a[LPC_ORDER], a_ref[LPC_ORDER], k[LPC_ORDER];
+    float32_t err, err_ref;
+    float32_t latticeState[LPC_BLOCK_SIZE + LPC_ORDER];
+    float32_t res[LPC_BLOCK_SIZE], res_ref[LPC_BLOCK_SIZE];
+    riscv_fir_lattice_instance_f32 S;
+    riscv_status status;
+
+    lpc_test_signal(src, window);
+    BENCH_START(riscv_lpc_analysis_f32);
+    status = riscv_lpc_analysis_f32(src, window, LPC_BLOCK_SIZE, LPC_ORDER, a, k, &err, scratch);
+    BENCH_END(riscv_lpc_analysis_f32);
+    ref_lpc_analysis_f32(src, window, LPC_BLOCK_SIZE, LPC_ORDER, a_ref, &err_ref);
+    float snr = riscv_snr_f32(a_ref, a, LPC_ORDER);
+    if ((status != RISCV_MATH_SUCCESS) || (snr < SNR_THRESHOLD_F32) ||
+        (fabs(err_ref - err) > 1.0e-5f * err_ref)) {
+        BENCH_ERROR(riscv_lpc_analysis_f32);
+        printf("lpc_analysis failed, status: %d, snr: %f, err expect: %f, actual: %f\n", status, snr, err_ref, err);
+        test_flag_error = 1;
+    }
+
+    /* The FIR lattice filter with the reflection coefficients is the whitening filter */
+    riscv_fir_lattice_init_f32(&S, LPC_ORDER, k, latticeState);
+    riscv_fir_lattice_f32(&S, scratch, res, LPC_BLOCK_SIZE);
+    for (int n = 0; n < LPC_BLOCK_SIZE; n++) {
+        res_ref[n] = src[n] * window[n];
+        for (int i = 0; (i < LPC_ORDER) && (i < n); i++)
+            res_ref[n] -= a_ref[i] * src[n - 1 - i] * window[n - 1 - i];
+    }
+    snr = riscv_snr_f32(res_ref, res, LPC_BLOCK_SIZE);
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_lpc_analysis_f32);
+        printf("lpc_analysis reflection coefficients failed, snr: %f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_lpc_analysis_f32);
+}
+
+static void DSP_lpc_analysis_q31(void)
+{
+    float32_t src_f32[LPC_BLOCK_SIZE], window_f32[LPC_BLOCK_SIZE];
+    float32_t scratch_f32[LPC_BLOCK_SIZE + LPC_ORDER + 1];
+    float32_t a_f32[LPC_ORDER], k_f32[LPC_ORDER], k_q31_f32[LPC_ORDER];
+    float32_t err_f32;
+    q31_t src[LPC_BLOCK_SIZE], window[LPC_BLOCK_SIZE];
+    q31_t scratch[LPC_BLOCK_SIZE + LPC_ORDER + 1];
+    q31_t a[LPC_ORDER], a_ref[LPC_ORDER], k[LPC_ORDER];
+    q31_t err, err_ref;
+    riscv_status status;
+
+    lpc_test_signal(src_f32, window_f32);
+    riscv_scale_f32(src_f32, 0.5f, src_f32, LPC_BLOCK_SIZE);
+    riscv_scale_f32(window_f32, 0.99f, window_f32, LPC_BLOCK_SIZE);
+    riscv_float_to_q31(src_f32, src, LPC_BLOCK_SIZE);
+    riscv_float_to_q31(window_f32, window, LPC_BLOCK_SIZE);
+    BENCH_START(riscv_lpc_analysis_q31);
+    status = riscv_lpc_analysis_q31(src, window, LPC_BLOCK_SIZE, LPC_ORDER, a, k, &err, scratch);
+    BENCH_END(riscv_lpc_analysis_q31);
+    ref_lpc_analysis_q31(src, window, LPC_BLOCK_SIZE, LPC_ORDER, a_ref, &err_ref);
+    if (status != RISCV_MATH_SUCCESS) {
+        BENCH_ERROR(riscv_lpc_analysis_q31);
+        printf("lpc_analysis failed, status: %d\n", status);
+        test_flag_error = 1;
+    }
+    for (int i = 0; i < LPC_ORDER; i++) {
+        if (a_ref[i] != a[i]) {
+            BENCH_ERROR(riscv_lpc_analysis_q31);
+            printf("lpc_analysis a failed, index: %d, expect: %d, actual: %d\n", i, a_ref[i], a[i]);
+            test_flag_error = 1;
+        }
+    }
+    if (err_ref != err) {
+        BENCH_ERROR(riscv_lpc_analysis_q31);
+        printf("lpc_analysis err failed, expect: %x, actual: %x\n", err_ref, err);
+        test_flag_error = 1;
+    }
+
+    /* Reflection coefficients of the same block computed in floating-point */
+    riscv_q31_to_float(src, src_f32, LPC_BLOCK_SIZE);
+    riscv_q31_to_float(window, window_f32, LPC_BLOCK_SIZE);
+    riscv_lpc_analysis_f32(src_f32, window_f32, LPC_BLOCK_SIZE, LPC_ORDER, a_f32, k_f32, &err_f32, scratch_f32);
+    riscv_q31_to_float(k, k_q31_f32, LPC_ORDER);
+    float snr = riscv_snr_f32(k_f32, k_q31_f32, LPC_ORDER);
+    if (snr < LPC_SNR_THRESHOLD_Q31) {
+        BENCH_ERROR(riscv_lpc_analysis_q31);
+        printf("lpc_analysis reflection coefficients failed, snr: %f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_lpc_analysis_q31);
+}
+
 int main(void)
 {
     BENCH_INIT();
     DSP_levinson_durbin_f32();
     DSP_levinson_durbin_q31();
+    DSP_lpc_analysis_f32();
+    DSP_lpc_analysis_q31();
 #if defined (RISCV_FLOAT16_SUPPORTED)
     DSP_levinson_durbin_f16();
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
@@ -67,6 +67,32 @@ void ref_cfft_f32(const riscv_cfft_instance_f32 *S, float32_t *p1,
     }
 }
 
+void ref_cfft_f64(const riscv_cfft_instance_f64 *S, float64_t *p1,
+                  uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+    uint32_t n, k;
+    uint32_t N = S->fftLen;
+    float64_t sumR, sumI, phi, c, s;
+    float64_t pIn[S->fftLen * 2];
+    float64_t dir = (ifftFlag) ? 1.0 : -1.0;
+
+    // direct DFT in double precision, independent of the FFT decomposition
+    memcpy(pIn, p1, 2 * N * sizeof(float64_t));
+    for (k = 0; k < N; k++) {
+        sumR = 0.0;
+        sumI = 0.0;
+        for (n = 0; n < N; n++) {
+            phi = dir * 6.283185307179586 * (float64_t)((k * n) % N) / N;
+            c = cos(phi);
+            s = sin(phi);
+            sumR += pIn[2 * n] * c - pIn[2 * n + 1] * s;
+            sumI += pIn[2 * n] * s + pIn[2 * n + 1] * c;
+        }
+        p1[2 * k] = (ifftFlag) ? sumR / N : sumR;
+        p1[2 * k + 1] = (ifftFlag) ? sumI / N : sumI;
+    }
+}
+
 #if defined (RISCV_FLOAT16_SUPPORTED)
 void ref_cfft_f16(const riscv_cfft_instance_f16 *S, float16_t *pSrc, uint8_t ifftFlag,
                   uint8_t bitReverseFlag)
@@ -797,3 +823,73 @@ void ref_cfft_radix4_q15(const riscv_cfft_radix4_instance_q15 *S, q15_t *pSrc)
         }
     }
 }
+
+void ref_cfft_mixed_f32(const riscv_cfft_mixed_instance_f32 *S,
+                        const float32_t *pSrc, float32_t *pDst, uint8_t ifftFlag)
+{
+    uint32_t n, k;
+    uint32_t N = S->fftLen;
+    float64_t sumR, sumI, phi;
+    float64_t dir = (ifftFlag) ? 1.0 : -1.0;
+
+    // direct DFT, accumulated in double precision
+    for (k = 0; k < N; k++) {
+        sumR = 0.0;
+        sumI = 0.0;
+        for (n = 0; n < N; n++) {
+            phi = dir * 6.283185307179586 * (float64_t)((k * n) % N) / N;
+            sumR += pSrc[2 * n] * cos(phi) - pSrc[2 * n + 1] * sin(phi);
+            sumI += pSrc[2 * n] * sin(phi) + pSrc[2 * n + 1] * cos(phi);
+        }
+        if (ifftFlag) {
+            sumR /= N;
+            sumI /= N;
+        }
+        pDst[2 * k] = (float32_t)sumR;
+        pDst[2 * k + 1] = (float32_t)sumI;
+    }
+}
+
+void ref_cfft2d_f32(const riscv_cfft2d_instance_f32 *S, float32_t *p1,
+                    uint8_t ifftFlag)
+{
+    uint32_t r, c;
+    float32_t col[S->numRows * 2];
+
+    for (r = 0; r < S->numRows; r++) {
+        ref_cfft_f32(&S->rowCfft, p1 + 2 * r * S->numCols, ifftFlag, 1);
+    }
+    for (c = 0; c < S->numCols; c++) {
+        for (r = 0; r < S->numRows; r++) {
+            col[2 * r] = p1[2 * (r * S->numCols + c)];
+            col[2 * r + 1] = p1[2 * (r * S->numCols + c) + 1];
+        }
+        ref_cfft_f32(&S->colCfft, col, ifftFlag, 1);
+        for (r = 0; r < S->numRows; r++) {
+            p1[2 * (r * S->numCols + c)] = col[2 * r];
+            p1[2 * (r * S->numCols + c) + 1] = col[2 * r + 1];
+        }
+    }
+}
+
+void ref_cfft2d_q31(const riscv_cfft2d_instance_q31 *S, q31_t *p1,
+                    uint8_t ifftFlag)
+{
+    uint32_t r, c;
+    q31_t col[S->numRows * 2];
+
+    for (r = 0; r < S->numRows; r++) {
+        ref_cfft_q31(&S->rowCfft, p1 + 2 * r * S->numCols, ifftFlag, 1);
+    }
+    for (c = 0; c < S->numCols; c++) {
+        for (r = 0; r < S->numRows; r++) {
+            col[2 * r] = p1[2 * (r * S->numCols + c)];
+            col[2 * r + 1] = p1[2 * (r * S->numCols + c) + 1];
+        }
+        ref_cfft_q31(&S->colCfft, col, ifftFlag, 1);
+        for (r = 0; r < S->numRows; r++) {
+            p1[2 * (r * S->numCols + c)] = col[2 * r];
+            p1[2 * (r * S->numCols + c) + 1] = col[2 * r + 1];
+        }
+    }
+}
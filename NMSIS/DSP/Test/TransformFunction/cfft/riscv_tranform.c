@@ -21,6 +21,11 @@
 #define SNR_THRESHOLD_F32 120
 #define SNR_THRESHOLD_Q15 30
 #define SNR_THRESHOLD_Q31 90
+#define SNR_THRESHOLD_BFP_Q15 55
+#define SNR_THRESHOLD_GOERTZEL_F32 90
+#define SNR_THRESHOLD_GOERTZEL_Q15 45
+#define SNR_THRESHOLD_SDFT_F32 90
+#define SNR_THRESHOLD_SDFT_Q31 110
 
 float32_t scratchArray[CFFTSIZE * 2];
 
@@ -339,6 +344,413 @@ void DSP_cfftx4_test(void)
     BENCH_STATUS(riscv_cfft_radix4_q15);
 }
 
+#define CFFTMIXEDSIZE 480
+float32_t cfft_mixed_twiddle_f32[CFFTMIXEDSIZE * 2];
+uint16_t cfft_mixed_digitrev[CFFTMIXEDSIZE];
+
+void DSP_cfft_mixed_test(void)
+{
+    // f32
+    riscv_cfft_mixed_instance_f32 f32_S;
+    riscv_status status;
+
+    status = riscv_cfft_mixed_init_f32(&f32_S, CFFTMIXEDSIZE, cfft_mixed_twiddle_f32, cfft_mixed_digitrev);
+    if (status != RISCV_MATH_SUCCESS) {
+        printf("riscv_cfft_mixed_init_f32 failed with status:%d\n", status);
+        test_flag_error = 1;
+        return;
+    }
+    generate_rand_f32(cfft_testinput_f32_50hz_200Hz, CFFTMIXEDSIZE * 2);
+    BENCH_START(riscv_cfft_mixed_f32);
+    riscv_cfft_mixed_f32(&f32_S, cfft_testinput_f32_50hz_200Hz, testOutput_f32, ifftFlag);
+    BENCH_END(riscv_cfft_mixed_f32);
+    ref_cfft_mixed_f32(&f32_S, cfft_testinput_f32_50hz_200Hz, testOutput_f32_ref, ifftFlag);
+    float snr = riscv_snr_f32(testOutput_f32, testOutput_f32_ref, CFFTMIXEDSIZE * 2);
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_cfft_mixed_f32);
+        printf("riscv_cfft_mixed_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_cfft_mixed_f32);
+}
+
+float32_t cfft_dynamic_buffer_f32[RISCV_CFFT_DYNAMIC_BUFFER_SIZE_F32(CFFTSIZE)];
+
+/* radix-2, radix-4 and radix-8 only first stage */
+#define CFFT_DYNAMIC_LENS 3
+const uint16_t cfftDynamicLens[CFFT_DYNAMIC_LENS] = {128, 256, CFFTSIZE};
+
+void DSP_cfft_dynamic_test(void)
+{
+    // f32
+    riscv_cfft_instance_f32 f32_S;
+    riscv_status status;
+    uint16_t fftLen;
+    float snr;
+
+    for (int i = 0; i < CFFT_DYNAMIC_LENS; i++) {
+        fftLen = cfftDynamicLens[i];
+        BENCH_START(riscv_cfft_init_dynamic_f32);
+        status = riscv_cfft_init_dynamic_f32(&f32_S, fftLen, cfft_dynamic_buffer_f32);
+        BENCH_END(riscv_cfft_init_dynamic_f32);
+        if (status != RISCV_MATH_SUCCESS) {
+            BENCH_ERROR(riscv_cfft_init_dynamic_f32);
+            printf("riscv_cfft_init_dynamic_f32 failed with status:%d for fftLen %d\n", status, fftLen);
+            test_flag_error = 1;
+            return;
+        }
+        BENCH_STATUS(riscv_cfft_init_dynamic_f32);
+
+        generate_rand_f32(cfft_testinput_f32_50hz_200Hz, fftLen * 2);
+        memcpy(cfft_testinput_f32_50hz_200Hz_ref, cfft_testinput_f32_50hz_200Hz, fftLen * 2 * sizeof(float32_t));
+        BENCH_START(riscv_cfft_f32);
+        riscv_cfft_f32(&f32_S, cfft_testinput_f32_50hz_200Hz, ifftFlag, doBitReverse);
+        BENCH_END(riscv_cfft_f32);
+        ref_cfft_f32(&f32_S, cfft_testinput_f32_50hz_200Hz_ref, ifftFlag, doBitReverse);
+        snr = riscv_snr_f32(cfft_testinput_f32_50hz_200Hz, cfft_testinput_f32_50hz_200Hz_ref, fftLen * 2);
+        if (snr < SNR_THRESHOLD_F32) {
+            BENCH_ERROR(riscv_cfft_f32);
+            printf("riscv_cfft_f32 with runtime tables failed with snr:%f for fftLen %d\n", snr, fftLen);
+            test_flag_error = 1;
+        }
+        BENCH_STATUS(riscv_cfft_f32);
+
+        /* inverse transform */
+        memcpy(cfft_testinput_f32_50hz_200Hz_ref, cfft_testinput_f32_50hz_200Hz, fftLen * 2 * sizeof(float32_t));
+        riscv_cfft_f32(&f32_S, cfft_testinput_f32_50hz_200Hz, 1, doBitReverse);
+        ref_cfft_f32(&f32_S, cfft_testinput_f32_50hz_200Hz_ref, 1, doBitReverse);
+        snr = riscv_snr_f32(cfft_testinput_f32_50hz_200Hz, cfft_testinput_f32_50hz_200Hz_ref, fftLen * 2);
+        if (snr < SNR_THRESHOLD_F32) {
+            printf("riscv_cifft_f32 with runtime tables failed with snr:%f for fftLen %d\n", snr, fftLen);
+            test_flag_error = 1;
+        }
+    }
+}
+
+#define CFFT_BFP_LENS 3
+const uint16_t cfftBfpLens[CFFT_BFP_LENS] = {16, 128, CFFTSIZE};
+
+void DSP_cfft_bfp_test(void)
+{
+    // q15, low level input to check the dynamic range
+    riscv_cfft_instance_q15 q15_S;
+    riscv_cfft_instance_f32 f32_S;
+    int32_t exponent;
+    uint8_t dir;
+    uint16_t fftLen;
+    q15_t maxValue;
+    uint32_t index;
+    float snr;
+
+    for (int n = 0; n < CFFT_BFP_LENS; n++) {
+        fftLen = cfftBfpLens[n];
+        riscv_cfft_init_q15(&q15_S, fftLen);
+        riscv_cfft_init_f32(&f32_S, fftLen);
+        for (dir = 0; dir < 2; dir++) {
+            for (int i = 0; i < fftLen * 2; i++) {
+                cfft_testinput_q15_50hz_200Hz[i] = (q15_t)(rand() % 256 - 128);
+            }
+            riscv_q15_to_float(cfft_testinput_q15_50hz_200Hz, testOutput_f32_ref, fftLen * 2);
+            BENCH_START(riscv_cfft_bfp_q15);
+            exponent = riscv_cfft_bfp_q15(&q15_S, cfft_testinput_q15_50hz_200Hz, dir, doBitReverse);
+            BENCH_END(riscv_cfft_bfp_q15);
+            ref_cfft_f32(&f32_S, testOutput_f32_ref, dir, doBitReverse);
+            riscv_q15_to_float(cfft_testinput_q15_50hz_200Hz, testOutput_f32, fftLen * 2);
+            riscv_scale_f32(testOutput_f32, ldexpf(1.0f, exponent), testOutput_f32, fftLen * 2);
+            snr = riscv_snr_f32(testOutput_f32, testOutput_f32_ref, fftLen * 2);
+            if (snr < SNR_THRESHOLD_BFP_Q15) {
+                BENCH_ERROR(riscv_cfft_bfp_q15);
+                printf("riscv_cfft_bfp_q15 failed with snr:%f for fftLen %d ifftFlag %d\n", snr, fftLen, dir);
+                test_flag_error = 1;
+            }
+            /* The exponent must keep the result within three bits of full scale */
+            riscv_absmax_q15(cfft_testinput_q15_50hz_200Hz, fftLen * 2, &maxValue, &index);
+            if (maxValue < 0x1000) {
+                BENCH_ERROR(riscv_cfft_bfp_q15);
+                printf("riscv_cfft_bfp_q15 exponent %d leaves max %d for fftLen %d ifftFlag %d\n",
+                       exponent, maxValue, fftLen, dir);
+                test_flag_error = 1;
+            }
+            BENCH_STATUS(riscv_cfft_bfp_q15);
+        }
+    }
+}
+
+#define GOERTZEL_BINS 4
+static const uint16_t goertzel_bin_index[GOERTZEL_BINS] = {20, 50, 101, 200};
+
+/* Reference: bins of the CFFT of the real input */
+static void ref_dft_bins_f32(const float32_t *pSrc, float32_t *pDst)
+{
+    for (int i = 0; i < CFFTSIZE; i++) {
+        cfft_testinput_f32_50hz_200Hz_ref[2 * i] = pSrc[i];
+        cfft_testinput_f32_50hz_200Hz_ref[2 * i + 1] = 0.0f;
+    }
+    ref_cfft_f32(&riscv_cfft_sR_f32_len512, cfft_testinput_f32_50hz_200Hz_ref, 0, 1);
+    for (int k = 0; k < GOERTZEL_BINS; k++) {
+        pDst[2 * k] = cfft_testinput_f32_50hz_200Hz_ref[2 * goertzel_bin_index[k]];
+        pDst[2 * k + 1] = cfft_testinput_f32_50hz_200Hz_ref[2 * goertzel_bin_index[k] + 1];
+    }
+}
+
+void DSP_goertzel_test(void)
+{
+    float32_t freqs[GOERTZEL_BINS], coeffs_f32[3 * GOERTZEL_BINS];
+    q15_t coeffs_q15[3 * GOERTZEL_BINS];
+    q31_t output_q15[2 * GOERTZEL_BINS];
+    riscv_goertzel_instance_f32 f32_S;
+    riscv_goertzel_instance_q15 q15_S;
+    float snr;
+
+    for (int k = 0; k < GOERTZEL_BINS; k++) {
+        freqs[k] = (float32_t)goertzel_bin_index[k] / CFFTSIZE;
+    }
+    generate_rand_q15(cfft_testinput_q15_50hz_200Hz, CFFTSIZE);
+    riscv_q15_to_float(cfft_testinput_q15_50hz_200Hz, cfft_testinput_f32_50hz_200Hz, CFFTSIZE);
+    ref_dft_bins_f32(cfft_testinput_f32_50hz_200Hz, testOutput_f32_ref);
+
+    // f32
+    riscv_goertzel_init_f32(&f32_S, GOERTZEL_BINS, freqs, coeffs_f32);
+    BENCH_START(riscv_goertzel_f32);
+    riscv_goertzel_f32(&f32_S, cfft_testinput_f32_50hz_200Hz, CFFTSIZE, testOutput_f32);
+    BENCH_END(riscv_goertzel_f32);
+    snr = riscv_snr_f32(testOutput_f32, testOutput_f32_ref, 2 * GOERTZEL_BINS);
+    if (snr < SNR_THRESHOLD_GOERTZEL_F32) {
+        BENCH_ERROR(riscv_goertzel_f32);
+        printf("riscv_goertzel_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_goertzel_f32);
+
+    // q15
+    riscv_goertzel_init_q15(&q15_S, GOERTZEL_BINS, freqs, coeffs_q15);
+    BENCH_START(riscv_goertzel_q15);
+    riscv_goertzel_q15(&q15_S, cfft_testinput_q15_50hz_200Hz, CFFTSIZE, output_q15);
+    BENCH_END(riscv_goertzel_q15);
+    for (int k = 0; k < 2 * GOERTZEL_BINS; k++) {
+        testOutput_f32[k] = (float32_t)output_q15[k] / 32768.0f;
+    }
+    snr = riscv_snr_f32(testOutput_f32, testOutput_f32_ref, 2 * GOERTZEL_BINS);
+    if (snr < SNR_THRESHOLD_GOERTZEL_Q15) {
+        BENCH_ERROR(riscv_goertzel_q15);
+        printf("riscv_goertzel_q15 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_goertzel_q15);
+}
+
+float32_t sdft_delay_f32[CFFTSIZE];
+q31_t sdft_delay_q31[CFFTSIZE];
+
+void DSP_sdft_test(void)
+{
+    float32_t twiddle_f32[2 * GOERTZEL_BINS], bins_f32[2 * GOERTZEL_BINS];
+    q31_t twiddle_q31[2 * GOERTZEL_BINS];
+    q63_t bins_q31[2 * GOERTZEL_BINS];
+    riscv_sdft_instance_f32 f32_S;
+    riscv_sdft_instance_q31 q31_S;
+    float snr;
+
+    // After CFFTSIZE samples the window holds the whole input
+    generate_rand_q31(cfft_testinput_q31_50hz_200Hz, CFFTSIZE);
+    riscv_q31_to_float(cfft_testinput_q31_50hz_200Hz, cfft_testinput_f32_50hz_200Hz, CFFTSIZE);
+    ref_dft_bins_f32(cfft_testinput_f32_50hz_200Hz, testOutput_f32_ref);
+
+    // f32
+    riscv_sdft_init_f32(&f32_S, CFFTSIZE, GOERTZEL_BINS, goertzel_bin_index, twiddle_f32, bins_f32, sdft_delay_f32);
+    BENCH_START(riscv_sdft_f32);
+    riscv_sdft_f32(&f32_S, cfft_testinput_f32_50hz_200Hz, CFFTSIZE);
+    BENCH_END(riscv_sdft_f32);
+    snr = riscv_snr_f32(bins_f32, testOutput_f32_ref, 2 * GOERTZEL_BINS);
+    if (snr < SNR_THRESHOLD_SDFT_F32) {
+        BENCH_ERROR(riscv_sdft_f32);
+        printf("riscv_sdft_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_sdft_f32);
+
+    // q31
+    riscv_sdft_init_q31(&q31_S, CFFTSIZE, GOERTZEL_BINS, goertzel_bin_index, twiddle_q31, bins_q31, sdft_delay_q31);
+    BENCH_START(riscv_sdft_q31);
+    riscv_sdft_q31(&q31_S, cfft_testinput_q31_50hz_200Hz, CFFTSIZE);
+    BENCH_END(riscv_sdft_q31);
+    for (int k = 0; k < 2 * GOERTZEL_BINS; k++) {
+        testOutput_f32[k] = (float32_t)bins_q31[k] / 2147483648.0f;
+    }
+    snr = riscv_snr_f32(testOutput_f32, testOutput_f32_ref, 2 * GOERTZEL_BINS);
+    if (snr < SNR_THRESHOLD_SDFT_Q31) {
+        BENCH_ERROR(riscv_sdft_q31);
+        printf("riscv_sdft_q31 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_sdft_q31);
+}
+
+#define BITREVSIZE 2048
+
+extern void riscv_bitreversal_32(
+        uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+extern void riscv_bitreversal_16(
+        uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+q31_t bitrev_testinput_q31[BITREVSIZE * 2];
+q31_t bitrev_testinput_q31_ref[BITREVSIZE * 2];
+
+/* Butterflies and permutation benchmarked separately, the result must match the full transform */
+void DSP_cfft_bitrev_test(void)
+{
+    q15_t *bitrev_testinput_q15 = (q15_t *)bitrev_testinput_q31;
+    q15_t *bitrev_testinput_q15_ref = (q15_t *)bitrev_testinput_q31_ref;
+
+    // f32
+    generate_rand_f32(cfft_testinput_f32_50hz_200Hz, CFFTSIZE * 2);
+    memcpy(cfft_testinput_f32_50hz_200Hz_ref, cfft_testinput_f32_50hz_200Hz, sizeof(cfft_testinput_f32_50hz_200Hz));
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len512, cfft_testinput_f32_50hz_200Hz_ref, ifftFlag, 1);
+    BENCH_START(riscv_cfft_f32_butterflies);
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len512, cfft_testinput_f32_50hz_200Hz, ifftFlag, 0);
+    BENCH_END(riscv_cfft_f32_butterflies);
+    BENCH_START(riscv_bitreversal_32);
+    riscv_bitreversal_32((uint32_t *)cfft_testinput_f32_50hz_200Hz, riscv_cfft_sR_f32_len512.bitRevLength,
+                         riscv_cfft_sR_f32_len512.pBitRevTable);
+    BENCH_END(riscv_bitreversal_32);
+    if (memcmp(cfft_testinput_f32_50hz_200Hz, cfft_testinput_f32_50hz_200Hz_ref, sizeof(cfft_testinput_f32_50hz_200Hz)) != 0) {
+        BENCH_ERROR(riscv_bitreversal_32);
+        printf("riscv_bitreversal_32 f32 %d points failed\n", CFFTSIZE);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_bitreversal_32);
+
+    // q31
+    generate_rand_q31(bitrev_testinput_q31, BITREVSIZE * 2);
+    memcpy(bitrev_testinput_q31_ref, bitrev_testinput_q31, sizeof(bitrev_testinput_q31));
+    riscv_cfft_q31(&riscv_cfft_sR_q31_len2048, bitrev_testinput_q31_ref, ifftFlag, 1);
+    BENCH_START(riscv_cfft_q31_butterflies);
+    riscv_cfft_q31(&riscv_cfft_sR_q31_len2048, bitrev_testinput_q31, ifftFlag, 0);
+    BENCH_END(riscv_cfft_q31_butterflies);
+    BENCH_START(riscv_bitreversal_32);
+    riscv_bitreversal_32((uint32_t *)bitrev_testinput_q31, riscv_cfft_sR_q31_len2048.bitRevLength,
+                         riscv_cfft_sR_q31_len2048.pBitRevTable);
+    BENCH_END(riscv_bitreversal_32);
+    if (memcmp(bitrev_testinput_q31, bitrev_testinput_q31_ref, sizeof(bitrev_testinput_q31)) != 0) {
+        BENCH_ERROR(riscv_bitreversal_32);
+        printf("riscv_bitreversal_32 q31 %d points failed\n", BITREVSIZE);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_bitreversal_32);
+
+    // q15
+    generate_rand_q15(bitrev_testinput_q15, BITREVSIZE * 2);
+    memcpy(bitrev_testinput_q15_ref, bitrev_testinput_q15, BITREVSIZE * 2 * sizeof(q15_t));
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len2048, bitrev_testinput_q15_ref, ifftFlag, 1);
+    BENCH_START(riscv_cfft_q15_butterflies);
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len2048, bitrev_testinput_q15, ifftFlag, 0);
+    BENCH_END(riscv_cfft_q15_butterflies);
+    BENCH_START(riscv_bitreversal_16);
+    riscv_bitreversal_16((uint16_t *)bitrev_testinput_q15, riscv_cfft_sR_q15_len2048.bitRevLength,
+                         riscv_cfft_sR_q15_len2048.pBitRevTable);
+    BENCH_END(riscv_bitreversal_16);
+    if (memcmp(bitrev_testinput_q15, bitrev_testinput_q15_ref, BITREVSIZE * 2 * sizeof(q15_t)) != 0) {
+        BENCH_ERROR(riscv_bitreversal_16);
+        printf("riscv_bitreversal_16 q15 %d points failed\n", BITREVSIZE);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_bitreversal_16);
+}
+
+float64_t cfft_testinput_f64[CFFTSIZE * 2], cfft_testinput_f64_ref[CFFTSIZE * 2];
+
+void DSP_cfft_f64_test(void)
+{
+    generate_rand_f32(cfft_testinput_f32_50hz_200Hz, CFFTSIZE * 2);
+    riscv_float_to_f64(cfft_testinput_f32_50hz_200Hz, cfft_testinput_f64, CFFTSIZE * 2);
+    BENCH_START(riscv_cfft_f64);
+    riscv_cfft_f64(&riscv_cfft_sR_f64_len512, cfft_testinput_f64, ifftFlag, doBitReverse);
+    BENCH_END(riscv_cfft_f64);
+    riscv_float_to_f64(cfft_testinput_f32_50hz_200Hz, cfft_testinput_f64_ref, CFFTSIZE * 2);
+    ref_cfft_f64(&riscv_cfft_sR_f64_len512, cfft_testinput_f64_ref, ifftFlag, doBitReverse);
+    if (verify_results_f64_high_precision(cfft_testinput_f64_ref, cfft_testinput_f64, CFFTSIZE * 2)) {
+        BENCH_ERROR(riscv_cfft_f64);
+        printf("riscv_cfft_f64 failed\n");
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_cfft_f64);
+
+    /* The inverse transform must give the input back */
+    generate_rand_f32(cfft_testinput_f32_50hz_200Hz_ref, CFFTSIZE * 2);
+    riscv_float_to_f64(cfft_testinput_f32_50hz_200Hz_ref, cfft_testinput_f64_ref, CFFTSIZE * 2);
+    memcpy(cfft_testinput_f64, cfft_testinput_f64_ref, sizeof(cfft_testinput_f64));
+    riscv_cfft_f64(&riscv_cfft_sR_f64_len512, cfft_testinput_f64, 0, doBitReverse);
+    BENCH_START(riscv_cifft_f64);
+    riscv_cfft_f64(&riscv_cfft_sR_f64_len512, cfft_testinput_f64, 1, doBitReverse);
+    BENCH_END(riscv_cifft_f64);
+    if (verify_results_f64_high_precision(cfft_testinput_f64_ref, cfft_testinput_f64, CFFTSIZE * 2)) {
+        BENCH_ERROR(riscv_cifft_f64);
+        printf("riscv_cfft_f64 inverse failed\n");
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_cifft_f64);
+}
+
+#define CFFT2D_ROWS 32
+#define CFFT2D_COLS 64
+q31_t cfft2d_testinput_q31[CFFT2D_ROWS * CFFT2D_COLS * 2];
+q31_t cfft2d_testinput_q31_ref[CFFT2D_ROWS * CFFT2D_COLS * 2];
+q31_t cfft2d_scratch_q31[RISCV_CFFT2D_SCRATCH_SIZE(CFFT2D_ROWS)];
+
+void DSP_cfft2d_test(void)
+{
+    float32_t *cfft2d_testinput_f32 = (float32_t *)cfft2d_testinput_q31;
+    float32_t *cfft2d_testinput_f32_ref = (float32_t *)cfft2d_testinput_q31_ref;
+    riscv_cfft2d_instance_f32 f32_S;
+    riscv_cfft2d_instance_q31 q31_S;
+    uint32_t i;
+    float snr, snr_tile;
+
+    // f32
+    riscv_cfft2d_init_f32(&f32_S, CFFT2D_ROWS, CFFT2D_COLS, (float32_t *)cfft2d_scratch_q31);
+    generate_rand_f32(cfft2d_testinput_f32, CFFT2D_ROWS * CFFT2D_COLS * 2);
+    memcpy(cfft2d_testinput_f32_ref, cfft2d_testinput_f32, CFFT2D_ROWS * CFFT2D_COLS * 2 * sizeof(float32_t));
+    BENCH_START(riscv_cfft2d_f32);
+    riscv_cfft2d_f32(&f32_S, cfft2d_testinput_f32, ifftFlag);
+    BENCH_END(riscv_cfft2d_f32);
+    ref_cfft2d_f32(&f32_S, cfft2d_testinput_f32_ref, ifftFlag);
+    snr = riscv_snr_f32(cfft2d_testinput_f32, cfft2d_testinput_f32_ref, CFFT2D_ROWS * CFFT2D_COLS * 2);
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_cfft2d_f32);
+        printf("riscv_cfft2d_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_cfft2d_f32);
+
+    // q31
+    riscv_cfft2d_init_q31(&q31_S, CFFT2D_ROWS, CFFT2D_COLS, cfft2d_scratch_q31);
+    generate_rand_q31(cfft2d_testinput_q31, CFFT2D_ROWS * CFFT2D_COLS * 2);
+    memcpy(cfft2d_testinput_q31_ref, cfft2d_testinput_q31, sizeof(cfft2d_testinput_q31));
+    BENCH_START(riscv_cfft2d_q31);
+    riscv_cfft2d_q31(&q31_S, cfft2d_testinput_q31, ifftFlag);
+    BENCH_END(riscv_cfft2d_q31);
+    ref_cfft2d_q31(&q31_S, cfft2d_testinput_q31_ref, ifftFlag);
+    snr = 1000.0f;
+    /* Compared CFFTSIZE complex values at a time */
+    for (i = 0; i < CFFT2D_ROWS * CFFT2D_COLS * 2; i += CFFTSIZE * 2) {
+        riscv_q31_to_float(cfft2d_testinput_q31_ref + i, testOutput_f32_ref, CFFTSIZE * 2);
+        riscv_q31_to_float(cfft2d_testinput_q31 + i, testOutput_f32, CFFTSIZE * 2);
+        snr_tile = riscv_snr_f32(testOutput_f32, testOutput_f32_ref, CFFTSIZE * 2);
+        snr = MIN(snr, snr_tile);
+    }
+    if (snr < SNR_THRESHOLD_Q31) {
+        BENCH_ERROR(riscv_cfft2d_q31);
+        printf("riscv_cfft2d_q31 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_cfft2d_q31);
+}
+
 int main(void)
 {
     BENCH_INIT();
@@ -346,6 +758,14 @@ int main(void)
     DSP_cfft_test();
     DSP_cfftx2_test();
     DSP_cfftx4_test();
+    DSP_cfft_mixed_test();
+    DSP_cfft_dynamic_test();
+    DSP_cfft_bfp_test();
+    DSP_goertzel_test();
+    DSP_sdft_test();
+    DSP_cfft_bitrev_test();
+    DSP_cfft_f64_test();
+    DSP_cfft2d_test();
 
     if (test_flag_error) {
         printf("test error apprears, please recheck.\n");
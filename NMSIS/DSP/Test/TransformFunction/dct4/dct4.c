@@ -79,3 +79,26 @@ void ref_dct4_q15(const riscv_dct4_instance_q15 *S, q15_t *pState,
         pInlineBuffer[i] = (q15_t)fSrc[i];
     }
 }
+
+void ref_dct2_f32(const riscv_dct2_instance_f32 *S, float32_t *pState,
+                  float32_t *pInlineBuffer)
+{
+    uint32_t n, k;
+    float64_t sum;
+    float64_t pi_by_2N = 3.14159265358979323846 / (2.0 * (float64_t)S->N);
+
+    for (k = 0; k < S->N; k++) {
+        sum = 0.0;
+        for (n = 0; n < S->N; n++) {
+            sum += (float64_t)pInlineBuffer[n] * cos(pi_by_2N * (float64_t)((2 * n + 1) * k));
+        }
+        if (k == 0) {
+            sum *= 0.70710678118654752440;
+        }
+        scratchArray[k] = (float32_t)(sqrt(2.0 / (float64_t)S->N) * sum);
+    }
+
+    for (k = 0; k < S->N; k++) {
+        pInlineBuffer[k] = scratchArray[k];
+    }
+}
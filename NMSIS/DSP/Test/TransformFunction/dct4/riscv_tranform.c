@@ -32,6 +32,7 @@ float32_t dct4_testinput_f32_50hz_200Hz[DCT4SIZE];
 float32_t dct4_testinput_f32_50hz_200Hz_ref[DCT4SIZE];
 float32_t dct4_testinput_f32_50hz_200Hz_q31[DCT4SIZE];
 float32_t testOutput_f32[DCT4SIZE], testOutput_f32_ref[DCT4SIZE];
+float32_t dct2_twiddle_f32[DCT4SIZE];
 //q31_t
 q31_t q31_state[DCT4SIZE] = {0};
 
@@ -67,6 +68,43 @@ static int DSP_dct4_f32(void)
     }
     BENCH_STATUS(riscv_dct4_f32);
 }
+static int DSP_dct2_f32(void)
+{
+    riscv_dct2_instance_f32 S;
+    generate_rand_f32(dct4_testinput_f32_50hz_200Hz, DCT4SIZE);
+    memcpy(dct4_testinput_f32_50hz_200Hz_ref, dct4_testinput_f32_50hz_200Hz, sizeof(dct4_testinput_f32_50hz_200Hz));
+    memcpy(testOutput_f32, dct4_testinput_f32_50hz_200Hz, sizeof(dct4_testinput_f32_50hz_200Hz));
+    riscv_status status = riscv_dct2_init_f32(&S, DCT4SIZE, dct2_twiddle_f32);
+    if (status != RISCV_MATH_SUCCESS) {
+        BENCH_ERROR(riscv_dct2_f32);
+        printf("f32 dct2_init_f32 failed with status:%d\n", status);
+        test_flag_error = 1;
+        return 1;
+    }
+    BENCH_START(riscv_dct2_f32);
+    riscv_dct2_f32(&S, f32_state, dct4_testinput_f32_50hz_200Hz);
+    BENCH_END(riscv_dct2_f32);
+    ref_dct2_f32(&S, f32_state, dct4_testinput_f32_50hz_200Hz_ref);
+    float snr = riscv_snr_f32(dct4_testinput_f32_50hz_200Hz, dct4_testinput_f32_50hz_200Hz_ref, DCT4SIZE);
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_dct2_f32);
+        printf("f32 dct2_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_dct2_f32);
+
+    /* DCT-III is the inverse of the orthonormal DCT-II */
+    BENCH_START(riscv_dct3_f32);
+    riscv_dct3_f32(&S, f32_state, dct4_testinput_f32_50hz_200Hz);
+    BENCH_END(riscv_dct3_f32);
+    snr = riscv_snr_f32(dct4_testinput_f32_50hz_200Hz, testOutput_f32, DCT4SIZE);
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_dct3_f32);
+        printf("f32 dct3_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_dct3_f32);
+}
 static int DSP_dct4_q31(void)
 {
     generate_rand_q31(dct4_testinput_q31_50hz_200Hz, DCT4SIZE);
@@ -130,6 +168,7 @@ int main()
     BENCH_INIT();
 
     DSP_dct4_f32();
+    DSP_dct2_f32();
     DSP_dct4_q31();
     DSP_dct4_q15();
 
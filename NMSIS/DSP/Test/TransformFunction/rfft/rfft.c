@@ -348,3 +348,57 @@ void ref_rfft_q15(const riscv_rfft_instance_q15 *S, q15_t *pSrc, q15_t *pDst)
         }
     }
 }
+
+void ref_rfft_fast_f64(const riscv_rfft_fast_instance_f64 *S,
+                       const float64_t *pSrc, float64_t *pDst)
+{
+    uint32_t n, k;
+    uint32_t N = S->fftLenRFFT;
+    float64_t sumR, sumI, phi;
+
+    // direct DFT in double precision of the first N/2+1 bins, in the packed format of rfft_fast
+    for (k = 0; k <= N / 2; k++) {
+        sumR = 0.0;
+        sumI = 0.0;
+        for (n = 0; n < N; n++) {
+            phi = -6.283185307179586 * (float64_t)((k * n) % N) / N;
+            sumR += pSrc[n] * cos(phi);
+            sumI += pSrc[n] * sin(phi);
+        }
+        if (k == 0) {
+            pDst[0] = sumR;
+        } else if (k == N / 2) {
+            pDst[1] = sumR;
+        } else {
+            pDst[2 * k] = sumR;
+            pDst[2 * k + 1] = sumI;
+        }
+    }
+}
+
+void ref_rfft_mixed_f32(const riscv_rfft_mixed_instance_f32 *S,
+                        const float32_t *pSrc, float32_t *pDst)
+{
+    uint32_t n, k;
+    uint32_t N = S->fftLenRFFT;
+    float64_t sumR, sumI, phi;
+
+    // direct DFT of the first N/2+1 bins, in the packed format of rfft_fast
+    for (k = 0; k <= N / 2; k++) {
+        sumR = 0.0;
+        sumI = 0.0;
+        for (n = 0; n < N; n++) {
+            phi = -6.283185307179586 * (float64_t)((k * n) % N) / N;
+            sumR += pSrc[n] * cos(phi);
+            sumI += pSrc[n] * sin(phi);
+        }
+        if (k == 0) {
+            pDst[0] = (float32_t)sumR;
+        } else if (k == N / 2) {
+            pDst[1] = (float32_t)sumR;
+        } else {
+            pDst[2 * k] = (float32_t)sumR;
+            pDst[2 * k + 1] = (float32_t)sumI;
+        }
+    }
+}
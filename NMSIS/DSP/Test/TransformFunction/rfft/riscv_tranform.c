@@ -21,6 +21,8 @@
 #define SNR_THRESHOLD_F32 120
 #define SNR_THRESHOLD_Q15 30
 #define SNR_THRESHOLD_Q31 90
+#define SNR_THRESHOLD_BFP_Q15 55
+#define SNR_THRESHOLD_MFCC_F32 100
 float32_t scratchArray[RFFTSIZE * 2];
 
 int test_flag_error = 0;
@@ -105,6 +107,67 @@ static int DSP_rfft_q15(void)
     BENCH_STATUS(riscv_rfft_q15);
 }
 
+static int DSP_rfft_bfp_q15(void)
+{
+    // q15, low level input to check the dynamic range
+    riscv_rfft_instance_q15 SS;
+    riscv_rfft_fast_instance_f32 SF;
+    int32_t exponent;
+    q15_t maxValue;
+    uint32_t index;
+    float32_t maxRef, gain;
+    float snr;
+
+    for (int i = 0; i < RFFTSIZE; i++) {
+        rfft_testinput_q15_50hz_200Hz[i] = (q15_t)(rand() % 256 - 128);
+    }
+    riscv_q15_to_float(rfft_testinput_q15_50hz_200Hz, rfft_testinput_f32_50hz_200Hz_fast, RFFTSIZE);
+    memcpy(rfft_testinput_f32_50hz_200Hz_fast_ref, rfft_testinput_f32_50hz_200Hz_fast, sizeof(rfft_testinput_f32_50hz_200Hz_fast));
+    riscv_rfft_init_q15(&SS, RFFTSIZE, 0, doBitReverse);
+    riscv_rfft_fast_init_f32(&SF, RFFTSIZE);
+    BENCH_START(riscv_rfft_bfp_q15);
+    exponent = riscv_rfft_bfp_q15(&SS, rfft_testinput_q15_50hz_200Hz, q15_testOutput);
+    BENCH_END(riscv_rfft_bfp_q15);
+    ref_rfft_fast_f32(&SF, rfft_testinput_f32_50hz_200Hz_fast, f32_testOutput_ref, 0);
+    /* the float RFFT packs the real part of the Nyquist bin in place of the DC imaginary part */
+    q15_testOutput[1] = q15_testOutput[RFFTSIZE];
+    riscv_q15_to_float(q15_testOutput, f32_testOutput, RFFTSIZE);
+    riscv_scale_f32(f32_testOutput, ldexpf(1.0f, exponent), f32_testOutput, RFFTSIZE);
+    snr = riscv_snr_f32(f32_testOutput, f32_testOutput_ref, RFFTSIZE);
+    /* the exponent must keep the result within four bits of full scale */
+    riscv_absmax_q15(q15_testOutput, RFFTSIZE, &maxValue, &index);
+    if ((snr < SNR_THRESHOLD_BFP_Q15) || (maxValue < 0x0800)) {
+        BENCH_ERROR(riscv_rfft_bfp_q15);
+        printf("riscv_rfft_bfp_q15 failed with snr:%f, exponent %d leaves max %d\n", snr, exponent, maxValue);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_rfft_bfp_q15);
+
+    /* inverse: the spectrum above scaled to half of full scale gives back the scaled input */
+    riscv_absmax_f32(f32_testOutput_ref, RFFTSIZE, &maxRef, &index);
+    gain = 0.5f / maxRef;
+    riscv_scale_f32(f32_testOutput_ref, gain, f32_testOutput_ref, RFFTSIZE);
+    riscv_float_to_q15(f32_testOutput_ref, q15_testOutput_ref, RFFTSIZE);
+    q15_testOutput_ref[RFFTSIZE] = q15_testOutput_ref[1];
+    q15_testOutput_ref[RFFTSIZE + 1] = 0;
+    q15_testOutput_ref[1] = 0;
+    riscv_rfft_init_q15(&SS, RFFTSIZE, 1, doBitReverse);
+    BENCH_START(riscv_rifft_bfp_q15);
+    exponent = riscv_rfft_bfp_q15(&SS, q15_testOutput_ref, q15_testOutput);
+    BENCH_END(riscv_rifft_bfp_q15);
+    riscv_q15_to_float(q15_testOutput, f32_testOutput, RFFTSIZE);
+    riscv_scale_f32(f32_testOutput, ldexpf(1.0f, exponent), f32_testOutput, RFFTSIZE);
+    riscv_scale_f32(rfft_testinput_f32_50hz_200Hz_fast_ref, gain, f32_testOutput_ref, RFFTSIZE);
+    snr = riscv_snr_f32(f32_testOutput, f32_testOutput_ref, RFFTSIZE);
+    riscv_absmax_q15(q15_testOutput, RFFTSIZE, &maxValue, &index);
+    if ((snr < SNR_THRESHOLD_BFP_Q15) || (maxValue < 0x0800)) {
+        BENCH_ERROR(riscv_rifft_bfp_q15);
+        printf("riscv_rifft_bfp_q15 failed with snr:%f, exponent %d leaves max %d\n", snr, exponent, maxValue);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_rifft_bfp_q15);
+}
+
 static int DSP_rfft_fast_f32(void)
 {
     generate_rand_f32(rfft_testinput_f32_50hz_200Hz_fast, RFFTSIZE);
@@ -128,6 +191,135 @@ static int DSP_rfft_fast_f32(void)
     BENCH_STATUS(riscv_rfft_fast_f32);
 }
 
+float32_t rfft_dynamic_buffer_f32[RISCV_RFFT_FAST_DYNAMIC_BUFFER_SIZE_F32(RFFTSIZE)];
+
+/* internal CFFT with a radix-8, radix-2 and radix-4 first stage */
+#define RFFT_DYNAMIC_LENS 3
+const uint16_t rfftDynamicLens[RFFT_DYNAMIC_LENS] = {128, 256, RFFTSIZE};
+
+static int DSP_rfft_fast_dynamic_f32(void)
+{
+    riscv_rfft_fast_instance_f32 SS;
+    riscv_status status;
+    uint16_t fftLen;
+    float snr;
+
+    for (int i = 0; i < RFFT_DYNAMIC_LENS; i++) {
+        fftLen = rfftDynamicLens[i];
+        BENCH_START(riscv_rfft_fast_init_dynamic_f32);
+        status = riscv_rfft_fast_init_dynamic_f32(&SS, fftLen, rfft_dynamic_buffer_f32);
+        BENCH_END(riscv_rfft_fast_init_dynamic_f32);
+        if (status != RISCV_MATH_SUCCESS) {
+            BENCH_ERROR(riscv_rfft_fast_init_dynamic_f32);
+            printf("riscv_rfft_fast_init_dynamic_f32 failed with status:%d for fftLen %d\n", status, fftLen);
+            test_flag_error = 1;
+            return 1;
+        }
+        BENCH_STATUS(riscv_rfft_fast_init_dynamic_f32);
+
+        generate_rand_f32(rfft_testinput_f32_50hz_200Hz_fast, fftLen);
+        memcpy(rfft_testinput_f32_50hz_200Hz_fast_ref, rfft_testinput_f32_50hz_200Hz_fast, fftLen * sizeof(float32_t));
+        riscv_rfft_fast_f32(&SS, rfft_testinput_f32_50hz_200Hz_fast, f32_testOutput, 0);
+        ref_rfft_fast_f32(&SS, rfft_testinput_f32_50hz_200Hz_fast_ref, f32_testOutput_ref, 0);
+        snr = riscv_snr_f32(f32_testOutput, f32_testOutput_ref, fftLen);
+        if (snr < SNR_THRESHOLD_F32) {
+            printf("riscv_rfft_fast_f32 with runtime tables failed with snr:%f for fftLen %d\n", snr, fftLen);
+            test_flag_error = 1;
+        }
+
+        /* inverse transform back to the input */
+        riscv_rfft_fast_f32(&SS, f32_testOutput, rfft_testinput_f32_50hz_200Hz_fast, 1);
+        snr = riscv_snr_f32(rfft_testinput_f32_50hz_200Hz_fast, rfft_testinput_f32_50hz_200Hz_fast_ref, fftLen);
+        if (snr < SNR_THRESHOLD_F32) {
+            printf("riscv_rifft_fast_f32 with runtime tables failed with snr:%f for fftLen %d\n", snr, fftLen);
+            test_flag_error = 1;
+        }
+    }
+    return 0;
+}
+
+float64_t rfft_testinput_f64[RFFTSIZE], f64_testOutput[RFFTSIZE], f64_testOutput_ref[RFFTSIZE];
+
+static int DSP_rfft_fast_f64(void)
+{
+    generate_rand_f32(rfft_testinput_f32_50hz_200Hz_fast, RFFTSIZE);
+    riscv_float_to_f64(rfft_testinput_f32_50hz_200Hz_fast, rfft_testinput_f64, RFFTSIZE);
+    riscv_rfft_fast_instance_f64 SS;
+
+    riscv_rfft_fast_init_f64(&SS, RFFTSIZE);
+    /* The input is modified by the transform */
+    ref_rfft_fast_f64(&SS, rfft_testinput_f64, f64_testOutput_ref);
+    BENCH_START(riscv_rfft_fast_f64);
+    riscv_rfft_fast_f64(&SS, rfft_testinput_f64, f64_testOutput, 0);
+    BENCH_END(riscv_rfft_fast_f64);
+    if (verify_results_f64_high_precision(f64_testOutput_ref, f64_testOutput, RFFTSIZE)) {
+        BENCH_ERROR(riscv_rfft_fast_f64);
+        printf("riscv_rfft_fast_f64 failed\n");
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_rfft_fast_f64);
+
+    /* The inverse transform must give the input back */
+    generate_rand_f32(rfft_testinput_f32_50hz_200Hz_fast_ref, RFFTSIZE);
+    riscv_float_to_f64(rfft_testinput_f32_50hz_200Hz_fast_ref, f64_testOutput_ref, RFFTSIZE);
+    memcpy(rfft_testinput_f64, f64_testOutput_ref, sizeof(rfft_testinput_f64));
+    riscv_rfft_fast_f64(&SS, rfft_testinput_f64, f64_testOutput, 0);
+    BENCH_START(riscv_rifft_fast_f64);
+    riscv_rfft_fast_f64(&SS, f64_testOutput, rfft_testinput_f64, 1);
+    BENCH_END(riscv_rifft_fast_f64);
+    if (verify_results_f64_high_precision(f64_testOutput_ref, rfft_testinput_f64, RFFTSIZE)) {
+        BENCH_ERROR(riscv_rifft_fast_f64);
+        printf("riscv_rfft_fast_f64 inverse failed\n");
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_rifft_fast_f64);
+}
+
+#define RFFTMIXEDSIZE 480
+float32_t rfft_mixed_twiddle_f32[RFFTMIXEDSIZE];
+float32_t rfft_mixed_twiddle_rfft_f32[RFFTMIXEDSIZE];
+uint16_t rfft_mixed_digitrev[RFFTMIXEDSIZE / 2];
+float32_t rfft_mixed_input_f32[RFFTMIXEDSIZE];
+float32_t rfft_mixed_input_f32_ref[RFFTMIXEDSIZE];
+
+static int DSP_rfft_mixed_f32(void)
+{
+    riscv_rfft_mixed_instance_f32 SS;
+    riscv_status status;
+
+    status = riscv_rfft_mixed_init_f32(&SS, RFFTMIXEDSIZE, rfft_mixed_twiddle_f32, rfft_mixed_twiddle_rfft_f32, rfft_mixed_digitrev);
+    if (status != RISCV_MATH_SUCCESS) {
+        printf("riscv_rfft_mixed_init_f32 failed with status:%d\n", status);
+        test_flag_error = 1;
+        return 1;
+    }
+    generate_rand_f32(rfft_mixed_input_f32_ref, RFFTMIXEDSIZE);
+    memcpy(rfft_mixed_input_f32, rfft_mixed_input_f32_ref, sizeof(rfft_mixed_input_f32));
+    BENCH_START(riscv_rfft_mixed_f32);
+    riscv_rfft_mixed_f32(&SS, rfft_mixed_input_f32, f32_testOutput, 0);
+    BENCH_END(riscv_rfft_mixed_f32);
+    ref_rfft_mixed_f32(&SS, rfft_mixed_input_f32_ref, f32_testOutput_ref);
+    float snr = riscv_snr_f32(f32_testOutput_ref, f32_testOutput, RFFTMIXEDSIZE);
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_rfft_mixed_f32);
+        printf("riscv_rfft_mixed_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_rfft_mixed_f32);
+
+    /* The inverse transform must give the input back */
+    BENCH_START(riscv_rifft_mixed_f32);
+    riscv_rfft_mixed_f32(&SS, f32_testOutput, rfft_mixed_input_f32, 1);
+    BENCH_END(riscv_rifft_mixed_f32);
+    snr = riscv_snr_f32(rfft_mixed_input_f32_ref, rfft_mixed_input_f32, RFFTMIXEDSIZE);
+    if (snr < SNR_THRESHOLD_F32) {
+        BENCH_ERROR(riscv_rifft_mixed_f32);
+        printf("riscv_rfft_mixed_f32 inverse failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_rifft_mixed_f32);
+}
+
 #if defined (RISCV_FLOAT16_SUPPORTED)
 static int DSP_rfft_fast_f16(void)
 {
@@ -177,14 +369,122 @@ static int DSP_rfft_f32(void)
     BENCH_STATUS(riscv_rfft_f32);
 }
 
+#define STFTSIZE 256
+#define STFTHOP 64
+#define STFTBLOCK 100
+#define STFTLEN 2048
+float32_t stft_window_f32[STFTSIZE], istft_window_f32[STFTSIZE];
+float32_t stft_state_f32[STFTSIZE], stft_scratch_f32[STFTSIZE];
+float32_t istft_state_f32[STFTSIZE], istft_scratch_f32[STFTSIZE];
+float32_t stft_frames_f32[STFTSIZE * ((STFTBLOCK + STFTHOP - 1) / STFTHOP)];
+float32_t stft_input_f32[STFTLEN], stft_output_f32[STFTLEN];
+
+static int DSP_stft_f32(void)
+{
+    riscv_stft_instance_f32 SA;
+    riscv_istft_instance_f32 SS;
+    uint32_t i, f, nbFrames, nbOut = 0;
+
+    generate_rand_f32(stft_input_f32, STFTLEN);
+    riscv_hanning_f32(stft_window_f32, STFTSIZE);
+    riscv_stft_init_f32(&SA, STFTSIZE, STFTHOP, stft_window_f32, stft_state_f32, stft_scratch_f32);
+    riscv_istft_init_f32(&SS, STFTSIZE, STFTHOP, stft_window_f32, istft_window_f32, istft_state_f32, istft_scratch_f32);
+
+    // analysis and synthesis of a stream cut in blocks unrelated to the hop size
+    BENCH_START(riscv_stft_f32);
+    for (i = 0; i < STFTLEN; i += STFTBLOCK) {
+        nbFrames = riscv_stft_f32(&SA, stft_input_f32 + i, (STFTLEN - i) < STFTBLOCK ? (STFTLEN - i) : STFTBLOCK, stft_frames_f32);
+        for (f = 0; f < nbFrames; f++) {
+            riscv_istft_f32(&SS, stft_frames_f32 + f * STFTSIZE, stft_output_f32 + nbOut);
+            nbOut += STFTHOP;
+        }
+    }
+    BENCH_END(riscv_stft_f32);
+
+    // output is the input delayed by STFTSIZE - STFTHOP samples
+    float snr = riscv_snr_f32(stft_output_f32 + STFTSIZE - STFTHOP, stft_input_f32, nbOut - (STFTSIZE - STFTHOP));
+    if ((nbOut != STFTLEN) || (snr < SNR_THRESHOLD_F32)) {
+        BENCH_ERROR(riscv_stft_f32);
+        printf("riscv_stft_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_stft_f32);
+}
+
+#define MFCCSIZE 256
+#define MFCCMELS 20
+#define MFCCDCT 13
+#define MFCCHOP 128
+#define MFCCFRAMES 6
+#define MFCCLEN ((MFCCFRAMES - 1) * MFCCHOP + MFCCSIZE)
+float32_t mfcc_window_f32[MFCCSIZE];
+float32_t mfcc_dct_f32[MFCCDCT * MFCCMELS];
+uint32_t mfcc_filter_pos[MFCCMELS], mfcc_filter_len[MFCCMELS];
+float32_t mfcc_filter_coefs_f32[2 * MFCCSIZE];
+float32_t mfcc_input_f32[MFCCLEN], mfcc_frame_f32[MFCCSIZE];
+float32_t mfcc_tmp_f32[2 * MFCCSIZE + 2];
+float32_t mfcc_output_f32[MFCCFRAMES * MFCCDCT], mfcc_output_f32_ref[MFCCFRAMES * MFCCDCT];
+
+static int DSP_mfcc_batch_f32(void)
+{
+    riscv_mfcc_instance_f32 S;
+    uint32_t i, j, f, nbCoefs = 0;
+    uint32_t start, center, stop;
+
+    // triangular filters evenly spaced over the bins 1 .. MFCCSIZE/2 - 1, packed one after the other
+    for (i = 0; i < MFCCMELS; i++) {
+        start = 1 + i * (MFCCSIZE / 2 - 2) / (MFCCMELS + 1);
+        center = 1 + (i + 1) * (MFCCSIZE / 2 - 2) / (MFCCMELS + 1);
+        stop = 1 + (i + 2) * (MFCCSIZE / 2 - 2) / (MFCCMELS + 1);
+        mfcc_filter_pos[i] = start;
+        mfcc_filter_len[i] = stop - start + 1;
+        for (j = start; j <= stop; j++) {
+            mfcc_filter_coefs_f32[nbCoefs++] = (j <= center) ? (float32_t)(j - start + 1) / (center - start + 1)
+                                                              : (float32_t)(stop - j + 1) / (stop - center + 1);
+        }
+    }
+    for (i = 0; i < MFCCDCT; i++) {
+        for (j = 0; j < MFCCMELS; j++) {
+            mfcc_dct_f32[i * MFCCMELS + j] = cosf(3.14159265358979f * i * (j + 0.5f) / MFCCMELS);
+        }
+    }
+    riscv_hanning_f32(mfcc_window_f32, MFCCSIZE);
+    riscv_mfcc_init_f32(&S, MFCCSIZE, MFCCMELS, MFCCDCT, mfcc_dct_f32, mfcc_filter_pos, mfcc_filter_len,
+                        mfcc_filter_coefs_f32, mfcc_window_f32);
+    generate_rand_f32(mfcc_input_f32, MFCCLEN);
+
+    BENCH_START(riscv_mfcc_batch_f32);
+    riscv_mfcc_batch_f32(&S, mfcc_input_f32, MFCCFRAMES, MFCCHOP, mfcc_output_f32, mfcc_tmp_f32);
+    BENCH_END(riscv_mfcc_batch_f32);
+
+    // each row must match the MFCC of the frame computed on its own
+    for (f = 0; f < MFCCFRAMES; f++) {
+        memcpy(mfcc_frame_f32, mfcc_input_f32 + f * MFCCHOP, sizeof(mfcc_frame_f32));
+        riscv_mfcc_f32(&S, mfcc_frame_f32, mfcc_output_f32_ref + f * MFCCDCT, mfcc_tmp_f32);
+    }
+    float snr = riscv_snr_f32(mfcc_output_f32_ref, mfcc_output_f32, MFCCFRAMES * MFCCDCT);
+    if (snr < SNR_THRESHOLD_MFCC_F32) {
+        BENCH_ERROR(riscv_mfcc_batch_f32);
+        printf("riscv_mfcc_batch_f32 failed with snr:%f\n", snr);
+        test_flag_error = 1;
+    }
+    BENCH_STATUS(riscv_mfcc_batch_f32);
+}
+
 int main()
 {
     BENCH_INIT();
 
     DSP_rfft_q31();
     DSP_rfft_q15();
+    DSP_rfft_bfp_q15();
     DSP_rfft_f32();
     DSP_rfft_fast_f32();
+    DSP_rfft_fast_dynamic_f32();
+    DSP_rfft_fast_f64();
+    DSP_rfft_mixed_f32();
+    DSP_stft_f32();
+    DSP_mfcc_batch_f32();
 #if defined (RISCV_FLOAT16_SUPPORTED)
     DSP_rfft_fast_f16();
 #endif /* defined (RISCV_FLOAT16_SUPPORTED) */
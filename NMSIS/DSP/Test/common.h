@@ -24,6 +24,7 @@
 #define DELTAQ15_LOW_PRECISION (5)
 #define DELTAQ31_LOW_PRECISION (64)
 #define DELTAF32_LOW_PRECISION (2.0f)
+#define DELTAF64_HIGH_PRECISION (1.0e-9)
 
 // #define LOG_DEBUG
 
@@ -274,6 +275,28 @@ int8_t verify_results_f64(float64_t * ref, float64_t * opt, int length)
     return flag;
 }
 
+int8_t verify_results_f64_high_precision(float64_t * ref, float64_t * opt, int length)
+{
+
+    int8_t flag = 0;
+
+    for (int i = 0; i < length; i++)
+    {
+        if (fabs(ref[i] - opt[i]) > DELTAF64_HIGH_PRECISION)
+        {
+            printf("f64 Output mismatch at %d, expected %.15f, actual %.15f\r\n", i, ref[i], opt[i]);
+
+            flag = 1;
+            break;
+        }
+#ifdef LOG_DEBUG
+        printf("f64 Output at %d, expected %.15f, actual %.15f\r\n", i, ref[i], opt[i]);
+#endif
+    }
+
+    return flag;
+}
+
 int8_t verify_results_u8(uint8_t * ref, uint8_t * opt, int length)
 {
     int8_t flag = 0;
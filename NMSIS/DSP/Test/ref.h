@@ -393,6 +393,18 @@ void ref_biquad_cascade_stereo_df2T_f32(
     const riscv_biquad_cascade_stereo_df2T_instance_f32 *S, float32_t *pSrc,
     float32_t *pDst, uint32_t blockSize);
 
+void ref_biquad_cascade_multi_df2T_f32(
+    const riscv_biquad_cascade_multi_df2T_instance_f32 *S, float32_t *pSrc,
+    float32_t *pDst, uint32_t blockSize);
+
+void ref_biquad_cascade_multi_df1_q31(
+    const riscv_biquad_cascade_multi_df1_instance_q31 *S, q31_t *pSrc,
+    q31_t *pDst, uint32_t blockSize);
+
+void ref_biquad_cas_multi_df1_32x64_q31(
+    const riscv_biquad_cas_multi_df1_32x64_ins_q31 *S, q31_t *pSrc,
+    q31_t *pDst, uint32_t blockSize);
+
 void ref_biquad_cascade_df2T_f64(const riscv_biquad_cascade_df2T_instance_f64 *S,
                                  float64_t *pSrc, float64_t *pDst,
                                  uint32_t blockSize);
@@ -552,6 +564,12 @@ void ref_fir_decimate_q15(const riscv_fir_decimate_instance_q15 *S, q15_t *pSrc,
 void ref_fir_decimate_fast_q15(const riscv_fir_decimate_instance_q15 *S,
                                q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
 
+void ref_cic_decimate_q15(const riscv_cic_decimate_instance_q15 *S, q15_t *pSrc,
+                          q15_t *pDst, uint32_t blockSize);
+
+void ref_cic_decimate_pdm_q15(const riscv_cic_decimate_pdm_instance_q15 *S,
+                              uint8_t *pSrc, q15_t *pDst, uint32_t blockSize);
+
 void ref_fir_lattice_f32(const riscv_fir_lattice_instance_f32 *S, float32_t *pSrc,
                          float32_t *pDst, uint32_t blockSize);
 
@@ -618,6 +636,12 @@ void ref_fir_interpolate_q15(const riscv_fir_interpolate_instance_q15 *S,
 void ref_levinson_durbin_f32(const float32_t *phi, float32_t *a, float32_t *err, int nbCoefs);
 
 void ref_levinson_durbin_q31(const q31_t *phi, q31_t *a, q31_t *err, int nbCoefs);
+
+void ref_lpc_analysis_f32(const float32_t *pSrc, const float32_t *pWindow, uint32_t blockSize,
+                          uint16_t order, float32_t *pCoeffs, float32_t *pErr);
+
+void ref_lpc_analysis_q31(const q31_t *pSrc, const q31_t *pWindow, uint32_t blockSize,
+                          uint16_t order, q31_t *pCoeffs, q31_t *pErr);
 /*
  * Matrix Functions
  */
@@ -978,6 +1002,21 @@ void ref_cfft_f32(const riscv_cfft_instance_f32 *S, float32_t *p1,
 void ref_cfft_q31(const riscv_cfft_instance_q31 *S, q31_t *p1, uint8_t ifftFlag,
                   uint8_t bitReverseFlag);
 
+void ref_cfft_f64(const riscv_cfft_instance_f64 *S, float64_t *p1,
+                  uint8_t ifftFlag, uint8_t bitReverseFlag);
+
+void ref_cfft_mixed_f32(const riscv_cfft_mixed_instance_f32 *S,
+                        const float32_t *pSrc, float32_t *pDst, uint8_t ifftFlag);
+
+void ref_rfft_mixed_f32(const riscv_rfft_mixed_instance_f32 *S,
+                        const float32_t *pSrc, float32_t *pDst);
+
+void ref_cfft2d_f32(const riscv_cfft2d_instance_f32 *S, float32_t *p1,
+                    uint8_t ifftFlag);
+
+void ref_cfft2d_q31(const riscv_cfft2d_instance_q31 *S, q31_t *p1,
+                    uint8_t ifftFlag);
+
 void ref_cfft_q15(const riscv_cfft_instance_q15 *S, q15_t *p1, uint8_t ifftFlag,
                   uint8_t bitReverseFlag);
 
@@ -1000,6 +1039,9 @@ void ref_rfft_f32(riscv_rfft_instance_f32 *S, float32_t *pSrc, float32_t *pDst);
 void ref_rfft_fast_f32(riscv_rfft_fast_instance_f32 *S, float32_t *p,
                        float32_t *pOut, uint8_t ifftFlag);
 
+void ref_rfft_fast_f64(const riscv_rfft_fast_instance_f64 *S,
+                       const float64_t *pSrc, float64_t *pDst);
+
 void ref_rfft_q31(const riscv_rfft_instance_q31 *S, q31_t *pSrc, q31_t *pDst);
 
 void ref_rfft_q15(const riscv_rfft_instance_q15 *S, q15_t *pSrc, q15_t *pDst);
@@ -1013,6 +1055,9 @@ void ref_dct4_q31(const riscv_dct4_instance_q31 *S, q31_t *pState,
 void ref_dct4_q15(const riscv_dct4_instance_q15 *S, q15_t *pState,
                   q15_t *pInlineBuffer);
 
+void ref_dct2_f32(const riscv_dct2_instance_f32 *S, float32_t *pState,
+                  float32_t *pInlineBuffer);
+
 
 #if defined (RISCV_FLOAT16_SUPPORTED)
 void ref_abs_f16(float16_t *pSrc, float16_t *pDst, uint32_t blockSize);
@@ -1086,6 +1131,10 @@ void ref_biquad_cascade_df2T_f16(const riscv_biquad_cascade_df2T_instance_f16 *S
                                  float16_t *pSrc, float16_t *pDst,
                                  uint32_t blockSize);
 
+void ref_biquad_cascade_multi_df2T_f16(
+    const riscv_biquad_cascade_multi_df2T_instance_f16 *S, float16_t *pSrc,
+    float16_t *pDst, uint32_t blockSize);
+
 void ref_biquad_cascade_df1_f16(const riscv_biquad_casd_df1_inst_f16 *S,
                                 float16_t *pSrc, float16_t *pDst,
                                 uint32_t blockSize);